@@ -5,13 +5,28 @@ CONFIG += ordered
 SUBDIRS = src/src.pro \
           app/FourInALine.pro \
           app/app.pro \
+          tools/OpeningBookGenerator/OpeningBookGenerator.pro \
+          tools/TablebaseGenerator/TablebaseGenerator.pro \
+          tools/Tournament/Tournament.pro \
+          benchmarks/Benchmarks.pro \
           tests/Game/BoardTest.pro \
           tests/Game/CellSetTest.pro \
           tests/Game/CellSetIteratorTest.pro \
+          tests/Game/GameControllerTest.pro \
           tests/Game/FourInALine/ArtificialIntelligenceTest.pro \
           tests/Game/FourInALine/AsynchronousArtificialIntelligenceTest.pro \
+          tests/Game/FourInALine/BitBoardTest.pro \
           tests/Game/FourInALine/BoardTest.pro \
           tests/Game/FourInALine/GameTest.pro \
+          tests/Game/FourInALine/MonteCarloTreeSearchTest.pro \
+          tests/Game/FourInALine/MoveOrderingTest.pro \
+          tests/Game/FourInALine/OpeningBookTest.pro \
+          tests/Game/FourInALine/SearchArenaTest.pro \
+          tests/Game/FourInALine/SearchWorkerTest.pro \
+          tests/Game/FourInALine/TablebaseTest.pro \
+          tests/Game/FourInALine/TournamentTest.pro \
+          tests/Game/FourInALine/TranspositionTableTest.pro \
+          tests/Game/FourInALine/WindowTableTest.pro \
           tests/GUI/NewGameTest.pro
 
 TRANSLATIONS = resources/i18n/fourinaline_en.ts \
@@ -1,10 +1,14 @@
 #include "FourInALine.hpp"
 #include "../src/Settings/FourInALine.hpp"
+#include "../src/GameLogic/FourInALine/OpeningBook.hpp"
+#include "../src/GameLogic/FourInALine/Tablebase.hpp"
 
 #include <QDir>
 #include <QLibraryInfo>
 #include <QDebug>
 
+#include <exception>
+
 /**
  * Creates a new application.
  *
@@ -22,6 +26,9 @@ FourInALine::FourInALine(int& argc, char** argv)
 	this->settings = new Settings::FourInALine(this);
     this->highscore = new Database();
 
+	this->loadOpeningBooks();
+	this->loadTablebases();
+
 	this->setLanguage(this->settings->getApplicationSettings()->getLanguage());
 	this->installTranslator(&this->qtTranslator);
 	this->installTranslator(&this->appTranslator);
@@ -48,6 +55,48 @@ Database* FourInALine::getDatabase() const
     return this->highscore;
 }
 
+/**
+ * Returns the opening book for the given board size.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @return The opening book or nullptr when there is no book for the board size.
+ */
+std::shared_ptr<const GameLogic::FourInALine::OpeningBook> FourInALine::getOpeningBook(unsigned int nColumns,
+                                                                                       unsigned int nRows) const
+{
+	for (auto& openingBook : this->openingBooks)
+	{
+		if (openingBook->getNumberOfColumns() == nColumns && openingBook->getNumberOfRows() == nRows)
+		{
+			return openingBook;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Returns the tablebase for the given board size.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @return The tablebase or nullptr when there is no tablebase for the board size.
+ */
+std::shared_ptr<const GameLogic::FourInALine::Tablebase> FourInALine::getTablebase(unsigned int nColumns,
+                                                                                   unsigned int nRows) const
+{
+	for (auto& tablebase : this->tablebases)
+	{
+		if (tablebase->getNumberOfColumns() == nColumns && tablebase->getNumberOfRows() == nRows)
+		{
+			return tablebase;
+		}
+	}
+
+	return nullptr;
+}
+
 /**
  * Returns settings object.
  *
@@ -134,6 +183,64 @@ QString FourInALine::getLanguage() const
 	return this->currentLanguage;
 }
 
+/**
+ * Loads the opening books from the directory "openingbooks" next to the executable.
+ *
+ * The books are only mapped into memory, they are not read.
+ */
+void FourInALine::loadOpeningBooks()
+{
+	QDir bookDirectory(QCoreApplication::applicationDirPath() + "/openingbooks");
+	QStringList bookFiles = bookDirectory.entryList(QStringList("*.book"), QDir::Files);
+
+	for (int i = 0; i < bookFiles.size(); ++i)
+	{
+		auto openingBook = std::make_shared<GameLogic::FourInALine::OpeningBook>();
+
+		try
+		{
+			openingBook->load(bookDirectory.filePath(bookFiles[i]));
+			this->openingBooks.push_back(openingBook);
+
+			qDebug() << "[" << this << "] Loaded opening book: " << bookFiles[i];
+		}
+		catch (std::exception& exception)
+		{
+			qWarning() << "[" << this << "] Could not load opening book" << bookFiles[i] << ":"
+			           << exception.what();
+		}
+	}
+}
+
+/**
+ * Loads the tablebases from the directory "tablebases" next to the executable.
+ *
+ * The tablebases are only mapped into memory, they are not read.
+ */
+void FourInALine::loadTablebases()
+{
+	QDir tablebaseDirectory(QCoreApplication::applicationDirPath() + "/tablebases");
+	QStringList tablebaseFiles = tablebaseDirectory.entryList(QStringList("*.tablebase"), QDir::Files);
+
+	for (int i = 0; i < tablebaseFiles.size(); ++i)
+	{
+		auto tablebase = std::make_shared<GameLogic::FourInALine::Tablebase>();
+
+		try
+		{
+			tablebase->load(tablebaseDirectory.filePath(tablebaseFiles[i]));
+			this->tablebases.push_back(tablebase);
+
+			qDebug() << "[" << this << "] Loaded tablebase: " << tablebaseFiles[i];
+		}
+		catch (std::exception& exception)
+		{
+			qWarning() << "[" << this << "] Could not load tablebase" << tablebaseFiles[i] << ":"
+			           << exception.what();
+		}
+	}
+}
+
 /**
  * Changes the application language to the language currently configured in the settings.
  */
@@ -7,11 +7,23 @@
 #include <QTranslator>
 #include "../src/Highscore/database.h"
 
+#include <memory>
+#include <vector>
+
 namespace Settings
 {
 	class FourInALine;
 }
 
+namespace GameLogic
+{
+namespace FourInALine
+{
+	class OpeningBook;
+	class Tablebase;
+}
+}
+
 /**
  * Sets up application at start and contains frequently used objects.
  */
@@ -27,6 +39,11 @@ class FourInALine : public QApplication
 		Settings::FourInALine* getSettings() const;
         Database* getDatabase() const;
 
+		std::shared_ptr<const GameLogic::FourInALine::OpeningBook> getOpeningBook(unsigned int nColumns,
+		                                                                          unsigned int nRows) const;
+		std::shared_ptr<const GameLogic::FourInALine::Tablebase> getTablebase(unsigned int nColumns,
+		                                                                      unsigned int nRows) const;
+
 		QMap<QString, QString> getAvailableLanguages() const;
 		void setLanguage(QString locale);
 		QString getLanguage() const;
@@ -43,6 +60,9 @@ class FourInALine : public QApplication
 	private:
 		Q_DISABLE_COPY(FourInALine)
 
+		void loadOpeningBooks();
+		void loadTablebases();
+
 		/**
 		 * The application's settings.
 		 */
@@ -67,6 +87,16 @@ class FourInALine : public QApplication
          * Highscore database connection;
          */
         Database* highscore;
+
+		/**
+		 * Opening books of the artificial intelligence, one per board size.
+		 */
+		std::vector<std::shared_ptr<const GameLogic::FourInALine::OpeningBook> > openingBooks;
+
+		/**
+		 * Tablebases of the artificial intelligence, one per board size.
+		 */
+		std::vector<std::shared_ptr<const GameLogic::FourInALine::Tablebase> > tablebases;
 };
 
 #endif // APP_FOUR_IN_A_LINE_HPP
@@ -0,0 +1,122 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Benchmarks
+{
+
+/**
+ * Receives the values passed to Benchmark::consume(), it is volatile so the compiler can not
+ * remove the computation of the values.
+ */
+static volatile unsigned long long sink = 0;
+
+/**
+ * Creates a new benchmark.
+ *
+ * @param name Name of the benchmark, used to compare it with the baseline.
+ * @param function Function which runs the operation the given number of times.
+ */
+Benchmark::Benchmark(const std::string& name, Benchmark::FunctionType function)
+    : name(name), function(function)
+{
+	if (!function)
+	{
+		throw std::invalid_argument("The benchmark function must not be empty.");
+	}
+}
+
+/**
+ * Frees all used resources.
+ */
+Benchmark::~Benchmark()
+{
+
+}
+
+/**
+ * Returns the name of the benchmark.
+ *
+ * @return Name of the benchmark.
+ */
+const std::string& Benchmark::getName() const
+{
+	return this->name;
+}
+
+/**
+ * Runs the benchmark.
+ *
+ * @param minimumTime Minimum total time of all samples, longer when one iteration takes longer.
+ * @param nSamples Number of samples, at least 1.
+ * @return The median time per iteration.
+ */
+Benchmark::Result Benchmark::run(std::chrono::milliseconds minimumTime, unsigned int nSamples) const
+{
+	nSamples = std::max(1u, nSamples);
+
+	std::chrono::nanoseconds sampleTime = minimumTime / nSamples;
+	unsigned long long nIterations = 1;
+	std::chrono::nanoseconds time = this->measure(nIterations);
+
+	// Calibrate the number of iterations so that one sample takes about the sample time.
+
+	while (time < sampleTime / 8)
+	{
+		nIterations *= 2;
+		time = this->measure(nIterations);
+	}
+
+	if (time < sampleTime)
+	{
+		nIterations = std::max(1ull, static_cast<unsigned long long>(
+		                           static_cast<double>(nIterations) * sampleTime.count() /
+		                           std::max<std::chrono::nanoseconds::rep>(1, time.count())));
+	}
+
+	std::vector<double> samples;
+
+	for (unsigned int i = 0; i < nSamples; ++i)
+	{
+		samples.push_back(static_cast<double>(this->measure(nIterations).count()) / nIterations);
+	}
+
+	std::sort(samples.begin(), samples.end());
+
+	Result result;
+
+	result.name = this->name;
+	result.nanosecondsPerIteration = samples[samples.size() / 2];
+	result.nIterations = nIterations;
+	result.nSamples = nSamples;
+
+	return result;
+}
+
+/**
+ * Uses the given value, so the compiler can not remove the computation of the value.
+ *
+ * @param value The value.
+ */
+void Benchmark::consume(unsigned long long value)
+{
+	sink = sink + value;
+}
+
+/**
+ * Measures the time of the given number of iterations.
+ *
+ * @param nIterations Number of iterations.
+ * @return Time of all iterations.
+ */
+std::chrono::nanoseconds Benchmark::measure(unsigned long long nIterations) const
+{
+	auto startTime = std::chrono::steady_clock::now();
+
+	this->function(nIterations);
+
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+}
+
+}
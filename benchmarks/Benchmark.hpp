@@ -0,0 +1,85 @@
+#ifndef BENCHMARKS_BENCHMARK_HPP
+#define BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+
+/**
+ * Micro-benchmark which measures the time of one iteration of an operation.
+ *
+ * The benchmark function gets the number of iterations and runs the operation that often, so the
+ * call of the function does not distort the time of very fast operations like Board::getCell().
+ * Results of the operation should be passed to consume(), otherwise the compiler may remove the
+ * operation.
+ *
+ * run() first doubles the number of iterations until a run takes a measurable time, then measures
+ * several samples with a fixed number of iterations and takes the median, which is robust against
+ * single slow samples (e.g. when the thread was descheduled).
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class Benchmark
+{
+	public:
+		/**
+		 * Function which runs the operation the given number of times.
+		 */
+		using FunctionType = std::function<void(unsigned long long nIterations)>;
+
+		/**
+		 * Result of a benchmark.
+		 */
+		struct Result
+		{
+			/**
+			 * Name of the benchmark.
+			 */
+			std::string name;
+
+			/**
+			 * Median time of one iteration in nanoseconds.
+			 */
+			double nanosecondsPerIteration;
+
+			/**
+			 * Number of iterations per sample.
+			 */
+			unsigned long long nIterations;
+
+			/**
+			 * Number of samples.
+			 */
+			unsigned int nSamples;
+		};
+
+		Benchmark(const std::string& name, FunctionType function);
+		virtual ~Benchmark();
+
+		const std::string& getName() const;
+
+		Result run(std::chrono::milliseconds minimumTime, unsigned int nSamples) const;
+
+		static void consume(unsigned long long value);
+
+	private:
+		std::chrono::nanoseconds measure(unsigned long long nIterations) const;
+
+		/**
+		 * Name of the benchmark.
+		 */
+		std::string name;
+
+		/**
+		 * Function which runs the operation.
+		 */
+		FunctionType function;
+};
+
+}
+
+#endif // BENCHMARKS_BENCHMARK_HPP
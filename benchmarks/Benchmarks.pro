@@ -0,0 +1,19 @@
+# Builds the micro-benchmarks, see main.cpp for their usage. They link the same libraries as the
+# tests.
+
+include(../tests/Defines.pri)
+
+TEMPLATE = app
+TARGET = Benchmarks
+CONFIG += console
+
+SOURCES += main.cpp \
+           Benchmark.cpp \
+           Report.cpp \
+           GameLogicBenchmarks.cpp \
+           GameBenchmarks.cpp
+
+HEADERS += Benchmark.hpp \
+           Report.hpp \
+           GameLogicBenchmarks.hpp \
+           GameBenchmarks.hpp
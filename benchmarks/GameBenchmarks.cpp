@@ -0,0 +1,140 @@
+#include "GameBenchmarks.hpp"
+#include "../src/Game/Game.hpp"
+#include "../src/Game/GameReader.hpp"
+#include "../src/Game/GameWriter.hpp"
+#include "../src/Game/Players/Placeholder.hpp"
+#include "../src/Highscore/database.h"
+
+#include <QBuffer>
+#include <QDir>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+
+#include <memory>
+#include <stdexcept>
+
+namespace Benchmarks
+{
+
+/**
+ * Creates a game with placeholder players on a 7x6 board in which the given number of moves were
+ * made without ending the game.
+ *
+ * @param nMoves Number of moves.
+ * @return The game.
+ */
+static QSharedPointer< ::Game::Game> createGame(unsigned int nMoves)
+{
+	auto gameLogic = QSharedPointer< ::GameLogic::FourInALine::Game>::create(6, 7, 1);
+	auto firstPlayer = QSharedPointer< ::Game::Players::Placeholder>::create(1, "First player");
+	auto secondPlayer = QSharedPointer< ::Game::Players::Placeholder>::create(2, "Second player");
+
+	for (unsigned int i = 0; i < nMoves && !gameLogic->isOver(); ++i)
+	{
+		// Take the first column, starting at a column depending on the move, which does not end the
+		// game.
+
+		for (unsigned int j = 0; j < 7; ++j)
+		{
+			unsigned int column = (3 * i + j) % 7;
+
+			if (!gameLogic->isMovePossible(column))
+			{
+				continue;
+			}
+
+			gameLogic->makeMove(column);
+
+			if (!gameLogic->isOver())
+			{
+				break;
+			}
+
+			gameLogic->undoLastMove();
+		}
+	}
+
+	return QSharedPointer< ::Game::Game>::create(gameLogic, firstPlayer, secondPlayer);
+}
+
+/**
+ * Adds the benchmarks of savegames: writing a game with GameWriter and reading it back with
+ * GameReader.
+ *
+ * @param benchmarks The benchmarks are added to this vector.
+ */
+void addGameBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+	auto game = createGame(30);
+
+	benchmarks.emplace_back("GameWriter+GameReader round-trip 7x6 30 moves",
+	                        [game](unsigned long long nIterations)
+	{
+		unsigned long long sum = 0;
+
+		for (unsigned long long i = 0; i < nIterations; ++i)
+		{
+			QBuffer buffer;
+			buffer.open(QIODevice::ReadWrite);
+
+			::Game::GameWriter writer;
+			writer.writeXML(&buffer, game, true);
+
+			buffer.seek(0);
+
+			::Game::GameReader reader;
+			auto readGame = reader.readGame(&buffer);
+
+			sum += readGame->getGameLogic()->getReplay().size();
+		}
+
+		Benchmark::consume(sum);
+	});
+}
+
+/**
+ * Adds the benchmark of inserting highscores into the database.
+ *
+ * The database file is created in a temporary directory, because Database always uses the file
+ * "DB.db3" in the current directory.
+ *
+ * @param benchmarks The benchmarks are added to this vector.
+ */
+void addHighscoreBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+	auto directory = std::make_shared<QTemporaryDir>();
+
+	if (!directory->isValid())
+	{
+		throw std::runtime_error("Could not create a temporary directory for the highscore database.");
+	}
+
+	QString currentPath = QDir::currentPath();
+
+	QDir::setCurrent(directory->path());
+	auto database = std::make_shared<Database>();
+	QDir::setCurrent(currentPath);
+
+	auto nPlayers = std::make_shared<unsigned long long>(0);
+
+	benchmarks.emplace_back("Database::insertHighscore", [directory, database, nPlayers](unsigned long long nIterations)
+	{
+		QString currentPath = QDir::currentPath();
+
+		QDir::setCurrent(directory->path());
+
+		// Every game has two new players, so the players are inserted and not updated.
+
+		for (unsigned long long i = 0; i < nIterations; ++i)
+		{
+			QString firstName = QString("Player %1").arg((*nPlayers)++);
+			QString secondName = QString("Player %1").arg((*nPlayers)++);
+
+			database->insertHighscore(firstName, secondName, i % 3);
+		}
+
+		QDir::setCurrent(currentPath);
+	});
+}
+
+}
@@ -0,0 +1,16 @@
+#ifndef BENCHMARKS_GAMEBENCHMARKS_HPP
+#define BENCHMARKS_GAMEBENCHMARKS_HPP
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+namespace Benchmarks
+{
+
+void addGameBenchmarks(std::vector<Benchmark>& benchmarks);
+void addHighscoreBenchmarks(std::vector<Benchmark>& benchmarks);
+
+}
+
+#endif // BENCHMARKS_GAMEBENCHMARKS_HPP
@@ -0,0 +1,243 @@
+#include "GameLogicBenchmarks.hpp"
+#include "../src/GameLogic/Board.hpp"
+#include "../src/GameLogic/CellSet.hpp"
+#include "../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
+#include "../src/GameLogic/FourInALine/Board.hpp"
+#include "../src/GameLogic/FourInALine/Game.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Benchmarks
+{
+
+/**
+ * Artificial intelligence which makes the method computing the score of a player public.
+ */
+class EvaluatingArtificialIntelligence : public GameLogic::FourInALine::ArtificialIntelligence
+{
+	public:
+		EvaluatingArtificialIntelligence() : ArtificialIntelligence(1) {}
+
+		using ArtificialIntelligence::computePlayerScore;
+};
+
+/**
+ * Sizes of the boards used by the benchmarks (columns, rows).
+ */
+static const unsigned int BOARD_SIZES[][2] = { { 7, 6 }, { 9, 7 }, { 12, 10 } };
+
+/**
+ * Returns the name of a board size, e.g. "7x6".
+ *
+ * @param nColumns Number of columns.
+ * @param nRows Number of rows.
+ * @return Name of the board size.
+ */
+static std::string getSizeName(unsigned int nColumns, unsigned int nRows)
+{
+	return std::to_string(nColumns) + "x" + std::to_string(nRows);
+}
+
+/**
+ * Creates a game of the given size in which four tokens were dropped into the center columns.
+ *
+ * @param nColumns Number of columns.
+ * @param nRows Number of rows.
+ * @return The game.
+ */
+static std::shared_ptr<GameLogic::FourInALine::Game> createGame(unsigned int nColumns, unsigned int nRows)
+{
+	auto game = std::make_shared<GameLogic::FourInALine::Game>(nRows, nColumns, 1);
+	unsigned int center = nColumns / 2;
+
+	for (unsigned int column : { center, center, center - 1, center + 1 })
+	{
+		game->makeMove(column);
+	}
+
+	return game;
+}
+
+/**
+ * Adds the benchmarks of the boards: cell access, dropping tokens, finding winning cells, rows,
+ * cell set iteration and the evaluation of the artificial intelligence.
+ *
+ * @param benchmarks The benchmarks are added to this vector.
+ */
+void addBoardBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+	auto board = std::make_shared<GameLogic::Board>(7, 6);
+
+	benchmarks.emplace_back("Board::getCell 7x6", [board](unsigned long long nIterations)
+	{
+		unsigned long long sum = 0;
+
+		for (unsigned long long i = 0; i < nIterations; ++i)
+		{
+			sum += board->getCell(i % 7, i % 6);
+		}
+
+		Benchmark::consume(sum);
+	});
+
+	benchmarks.emplace_back("Board::setCell 7x6", [board](unsigned long long nIterations)
+	{
+		for (unsigned long long i = 0; i < nIterations; ++i)
+		{
+			board->setCell(i % 7, i % 6, i % 3);
+		}
+
+		Benchmark::consume(board->getCell(0, 0));
+	});
+
+	for (const auto& size : BOARD_SIZES)
+	{
+		unsigned int nColumns = size[0];
+		unsigned int nRows = size[1];
+		std::string sizeName = getSizeName(nColumns, nRows);
+		auto game = createGame(nColumns, nRows);
+		auto emptyBoard = std::make_shared<GameLogic::FourInALine::Board>(nColumns, nRows);
+
+		benchmarks.emplace_back("FourInALine::Board::dropToken+removeToken " + sizeName,
+		                        [emptyBoard, nColumns](unsigned long long nIterations)
+		{
+			for (unsigned long long i = 0; i < nIterations; ++i)
+			{
+				unsigned int x = i % nColumns;
+
+				emptyBoard->dropToken(x, 1 + i % 2);
+				emptyBoard->removeToken(x);
+			}
+
+			Benchmark::consume(emptyBoard->getHashKey());
+		});
+
+		benchmarks.emplace_back("FourInALine::Board::findWinningCells " + sizeName,
+		                        [game](unsigned long long nIterations)
+		{
+			const GameLogic::FourInALine::Board& board = *game->getBoard();
+			unsigned long long sum = 0;
+
+			// The result of findWinningCells() is cached, scanForWinningCells() always scans.
+
+			for (unsigned long long i = 0; i < nIterations; ++i)
+			{
+				sum += board.scanForWinningCells().getLength();
+			}
+
+			Benchmark::consume(sum);
+		});
+
+		benchmarks.emplace_back("Board::getAllRows " + sizeName, [game](unsigned long long nIterations)
+		{
+			unsigned long long sum = 0;
+
+			for (unsigned long long i = 0; i < nIterations; ++i)
+			{
+				sum += game->getBoard()->getAllRows().size();
+			}
+
+			Benchmark::consume(sum);
+		});
+
+		auto rows = std::make_shared<std::vector<GameLogic::CellSet> >(game->getBoard()->getAllRows());
+
+		benchmarks.emplace_back("CellSet iteration " + sizeName, [game, rows](unsigned long long nIterations)
+		{
+			unsigned long long sum = 0;
+
+			for (unsigned long long i = 0; i < nIterations; ++i)
+			{
+				for (const auto& row : *rows)
+				{
+					for (auto it = row.begin(); it != row.end(); ++it)
+					{
+						sum += *it;
+					}
+				}
+			}
+
+			Benchmark::consume(sum);
+		});
+
+		auto ai = std::make_shared<EvaluatingArtificialIntelligence>();
+
+		benchmarks.emplace_back("ArtificialIntelligence::computePlayerScore " + sizeName,
+		                        [game, ai](unsigned long long nIterations)
+		{
+			const GameLogic::FourInALine::Board& board = *game->getBoard();
+			long long sum = 0;
+
+			for (unsigned long long i = 0; i < nIterations; ++i)
+			{
+				sum += ai->computePlayerScore(board, 1 + i % 2);
+			}
+
+			Benchmark::consume(sum);
+		});
+	}
+}
+
+/**
+ * Adds the benchmarks of the search of the artificial intelligence, with search depths from 1 to 8
+ * on several board sizes, and of the Monte Carlo tree search with 10000 playouts on 7x6 and 15x15.
+ *
+ * @param benchmarks The benchmarks are added to this vector.
+ */
+void addArtificialIntelligenceBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+	for (const auto& size : BOARD_SIZES)
+	{
+		unsigned int nColumns = size[0];
+		unsigned int nRows = size[1];
+		auto game = createGame(nColumns, nRows);
+
+		for (unsigned int depth = 1; depth <= 8; ++depth)
+		{
+			// The transposition table is cleared before every computation, so every iteration
+			// searches the same positions.
+
+			auto ai = std::make_shared<GameLogic::FourInALine::ArtificialIntelligence>(depth);
+
+			benchmarks.emplace_back("ArtificialIntelligence::computeNextMove " +
+			                        getSizeName(nColumns, nRows) + " depth " + std::to_string(depth),
+			                        [game, ai](unsigned long long nIterations)
+			{
+				unsigned long long sum = 0;
+
+				for (unsigned long long i = 0; i < nIterations; ++i)
+				{
+					sum += ai->computeNextMove(*game);
+				}
+
+				Benchmark::consume(sum);
+			});
+		}
+	}
+
+	for (unsigned int nColumns : { 7u, 15u })
+	{
+		unsigned int nRows = (nColumns == 7) ? 6 : 15;
+		auto game = createGame(nColumns, nRows);
+		auto ai = std::make_shared<GameLogic::FourInALine::ArtificialIntelligence>(1);
+
+		ai->setSearchAlgorithm(GameLogic::FourInALine::ArtificialIntelligence::SearchAlgorithm::MONTE_CARLO_TREE_SEARCH);
+		ai->setNodeBudget(10000);
+
+		benchmarks.emplace_back("ArtificialIntelligence::computeNextMove " + getSizeName(nColumns, nRows) +
+		                        " mcts 10000 playouts", [game, ai](unsigned long long nIterations)
+		{
+			unsigned long long sum = 0;
+
+			for (unsigned long long i = 0; i < nIterations; ++i)
+			{
+				sum += ai->computeNextMove(*game);
+			}
+
+			Benchmark::consume(sum);
+		});
+	}
+}
+
+}
@@ -0,0 +1,16 @@
+#ifndef BENCHMARKS_GAMELOGICBENCHMARKS_HPP
+#define BENCHMARKS_GAMELOGICBENCHMARKS_HPP
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+namespace Benchmarks
+{
+
+void addBoardBenchmarks(std::vector<Benchmark>& benchmarks);
+void addArtificialIntelligenceBenchmarks(std::vector<Benchmark>& benchmarks);
+
+}
+
+#endif // BENCHMARKS_GAMELOGICBENCHMARKS_HPP
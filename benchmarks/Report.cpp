@@ -0,0 +1,195 @@
+#include "Report.hpp"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <stdexcept>
+
+namespace Benchmarks
+{
+
+const int Report::VERSION = 1;
+
+/**
+ * Creates an empty report.
+ */
+Report::Report()
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+Report::~Report()
+{
+
+}
+
+/**
+ * Adds the result of a benchmark.
+ *
+ * @param result The result.
+ */
+void Report::addResult(const Benchmark::Result& result)
+{
+	this->results.push_back(result);
+}
+
+/**
+ * Returns the results of all benchmarks.
+ *
+ * @return The results, in the order they were added.
+ */
+const std::vector<Benchmark::Result>& Report::getResults() const
+{
+	return this->results;
+}
+
+/**
+ * Returns the JSON representation of the report.
+ *
+ * @return Indented JSON document.
+ */
+QByteArray Report::toJson() const
+{
+	QJsonArray benchmarks;
+
+	for (const auto& result : this->results)
+	{
+		QJsonObject benchmark;
+
+		benchmark["name"] = QString::fromStdString(result.name);
+		benchmark["nanosecondsPerIteration"] = result.nanosecondsPerIteration;
+		benchmark["iterations"] = static_cast<double>(result.nIterations);
+		benchmark["samples"] = static_cast<int>(result.nSamples);
+
+		benchmarks.append(benchmark);
+	}
+
+	QJsonObject root;
+
+	root["version"] = Report::VERSION;
+	root["benchmarks"] = benchmarks;
+
+	return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+/**
+ * Creates a report from its JSON representation.
+ *
+ * @param json JSON document written by toJson().
+ * @return The report.
+ */
+Report Report::fromJson(const QByteArray& json)
+{
+	QJsonParseError error;
+	QJsonDocument document = QJsonDocument::fromJson(json, &error);
+
+	if (error.error != QJsonParseError::NoError || !document.isObject())
+	{
+		throw std::runtime_error("The benchmark report is not a valid JSON document.");
+	}
+
+	QJsonObject root = document.object();
+
+	if (root["version"].toInt() != Report::VERSION || !root["benchmarks"].isArray())
+	{
+		throw std::runtime_error("The benchmark report has an unsupported format.");
+	}
+
+	Report report;
+
+	for (const QJsonValue& value : root["benchmarks"].toArray())
+	{
+		QJsonObject benchmark = value.toObject();
+		Benchmark::Result result;
+
+		result.name = benchmark["name"].toString().toStdString();
+		result.nanosecondsPerIteration = benchmark["nanosecondsPerIteration"].toDouble();
+		result.nIterations = static_cast<unsigned long long>(benchmark["iterations"].toDouble());
+		result.nSamples = static_cast<unsigned int>(benchmark["samples"].toInt());
+
+		report.addResult(result);
+	}
+
+	return report;
+}
+
+/**
+ * Writes the JSON representation of the report to the given file.
+ *
+ * @param fileName Name of the file.
+ */
+void Report::save(const QString& fileName) const
+{
+	QFile file(fileName);
+	QByteArray json = this->toJson();
+
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(json) != json.size())
+	{
+		throw std::runtime_error("Could not write the benchmark report.");
+	}
+}
+
+/**
+ * Reads a report from the given file.
+ *
+ * @param fileName Name of the file.
+ * @return The report.
+ */
+Report Report::load(const QString& fileName)
+{
+	QFile file(fileName);
+
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		throw std::runtime_error("Could not open the benchmark report.");
+	}
+
+	return Report::fromJson(file.readAll());
+}
+
+/**
+ * Compares the results with the given baseline.
+ *
+ * @param baseline The baseline.
+ * @param tolerance Relative change up to which a slower benchmark is no regression, e.g. 0.1.
+ * @return One comparison per result, in the order of the results.
+ */
+std::vector<Report::Comparison> Report::compare(const Report& baseline, double tolerance) const
+{
+	std::vector<Comparison> comparisons;
+
+	for (const auto& result : this->results)
+	{
+		Comparison comparison;
+
+		comparison.result = result;
+		comparison.hasBaseline = false;
+		comparison.baselineNanosecondsPerIteration = 0.0;
+		comparison.change = 0.0;
+		comparison.isRegression = false;
+
+		for (const auto& baselineResult : baseline.results)
+		{
+			if (baselineResult.name == result.name && baselineResult.nanosecondsPerIteration > 0.0)
+			{
+				comparison.hasBaseline = true;
+				comparison.baselineNanosecondsPerIteration = baselineResult.nanosecondsPerIteration;
+				comparison.change = result.nanosecondsPerIteration /
+				                    baselineResult.nanosecondsPerIteration - 1.0;
+				comparison.isRegression = comparison.change > tolerance;
+				break;
+			}
+		}
+
+		comparisons.push_back(comparison);
+	}
+
+	return comparisons;
+}
+
+}
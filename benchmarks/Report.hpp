@@ -0,0 +1,90 @@
+#ifndef BENCHMARKS_REPORT_HPP
+#define BENCHMARKS_REPORT_HPP
+
+#include "Benchmark.hpp"
+
+#include <QByteArray>
+#include <QString>
+
+#include <vector>
+
+namespace Benchmarks
+{
+
+/**
+ * Results of a benchmark run, stored as JSON and compared with a baseline.
+ *
+ * The JSON document contains the version of the format and an array with one object per benchmark:
+ *
+ *     { "version": 1, "benchmarks": [ { "name": "...", "nanosecondsPerIteration": 1.5,
+ *                                       "iterations": 1000, "samples": 5 }, ... ] }
+ *
+ * A baseline is a report of an earlier run, e.g. written with --output and kept next to the build.
+ * compare() matches the benchmarks by name, a benchmark is a regression when it is slower than the
+ * baseline by more than the tolerance.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class Report
+{
+	public:
+		/**
+		 * Version of the JSON format.
+		 */
+		static const int VERSION;
+
+		/**
+		 * Comparison of a benchmark with the baseline.
+		 */
+		struct Comparison
+		{
+			/**
+			 * The result of the current run.
+			 */
+			Benchmark::Result result;
+
+			/**
+			 * Whether the baseline contains the benchmark.
+			 */
+			bool hasBaseline;
+
+			/**
+			 * Time per iteration of the baseline in nanoseconds, 0 without baseline.
+			 */
+			double baselineNanosecondsPerIteration;
+
+			/**
+			 * Relative change of the time, e.g. 0.1 when the benchmark is 10% slower.
+			 */
+			double change;
+
+			/**
+			 * Whether the benchmark is slower than the baseline by more than the tolerance.
+			 */
+			bool isRegression;
+		};
+
+		Report();
+		virtual ~Report();
+
+		void addResult(const Benchmark::Result& result);
+		const std::vector<Benchmark::Result>& getResults() const;
+
+		QByteArray toJson() const;
+		static Report fromJson(const QByteArray& json);
+
+		void save(const QString& fileName) const;
+		static Report load(const QString& fileName);
+
+		std::vector<Comparison> compare(const Report& baseline, double tolerance) const;
+
+	private:
+		/**
+		 * The results of all benchmarks, in the order they were run.
+		 */
+		std::vector<Benchmark::Result> results;
+};
+
+}
+
+#endif // BENCHMARKS_REPORT_HPP
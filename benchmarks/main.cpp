@@ -0,0 +1,136 @@
+#include "Benchmark.hpp"
+#include "GameBenchmarks.hpp"
+#include "GameLogicBenchmarks.hpp"
+#include "Report.hpp"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+
+#include <chrono>
+#include <exception>
+#include <vector>
+
+/**
+ * Runs the micro-benchmarks, writes the results as JSON and compares them with a baseline.
+ *
+ * Usage: Benchmarks [--filter text] [--time ms] [--samples n] [--output file] [--baseline file]
+ *                   [--tolerance percent]
+ *
+ * A baseline is the output of an earlier run on the same machine, e.g. of the last release. Every
+ * benchmark which is slower than the baseline by more than the tolerance is marked as regression.
+ *
+ * @param argc Argument count.
+ * @param argv Array of command line arguments.
+ * @return 0 on success, 1 if an error occurs, 2 if there is a regression.
+ */
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName("Benchmarks");
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("Runs the benchmarks and compares them with a baseline.");
+	parser.addHelpOption();
+
+	QCommandLineOption filterOption("filter", "Only run benchmarks whose name contains the text.", "text");
+	QCommandLineOption timeOption("time", "Minimum time per benchmark in milliseconds.", "ms", "500");
+	QCommandLineOption samplesOption("samples", "Number of samples per benchmark.", "n", "5");
+	QCommandLineOption outputOption("output", "File to which the results are written.", "file",
+	                                "benchmarks.json");
+	QCommandLineOption baselineOption("baseline", "File with the results of an earlier run.", "file");
+	QCommandLineOption toleranceOption("tolerance", "Slowdown in percent up to which a benchmark is "
+	                                   "no regression.", "percent", "10");
+
+	parser.addOption(filterOption);
+	parser.addOption(timeOption);
+	parser.addOption(samplesOption);
+	parser.addOption(outputOption);
+	parser.addOption(baselineOption);
+	parser.addOption(toleranceOption);
+	parser.process(app);
+
+	QTextStream out(stdout);
+	std::chrono::milliseconds minimumTime(parser.value(timeOption).toUInt());
+	unsigned int nSamples = parser.value(samplesOption).toUInt();
+	double tolerance = parser.value(toleranceOption).toDouble() / 100.0;
+	QString filter = parser.value(filterOption);
+
+	try
+	{
+		std::vector<Benchmarks::Benchmark> benchmarks;
+
+		Benchmarks::addBoardBenchmarks(benchmarks);
+		Benchmarks::addArtificialIntelligenceBenchmarks(benchmarks);
+		Benchmarks::addGameBenchmarks(benchmarks);
+		Benchmarks::addHighscoreBenchmarks(benchmarks);
+
+		Benchmarks::Report report;
+
+		for (const auto& benchmark : benchmarks)
+		{
+			if (!filter.isEmpty() && !QString::fromStdString(benchmark.getName()).contains(filter))
+			{
+				continue;
+			}
+
+			report.addResult(benchmark.run(minimumTime, nSamples));
+		}
+
+		report.save(parser.value(outputOption));
+
+		Benchmarks::Report baseline;
+		bool hasBaseline = parser.isSet(baselineOption);
+
+		if (hasBaseline)
+		{
+			baseline = Benchmarks::Report::load(parser.value(baselineOption));
+		}
+
+		unsigned int nRegressions = 0;
+
+		for (const auto& comparison : report.compare(baseline, tolerance))
+		{
+			out << qSetFieldWidth(60) << left << QString::fromStdString(comparison.result.name)
+			    << qSetFieldWidth(14) << right << QString::number(comparison.result.nanosecondsPerIteration, 'f', 1)
+			    << qSetFieldWidth(0) << " ns";
+
+			if (comparison.hasBaseline)
+			{
+				out << qSetFieldWidth(14) << QString::number(comparison.baselineNanosecondsPerIteration, 'f', 1)
+				    << qSetFieldWidth(9) << QString::number(comparison.change * 100.0, 'f', 1)
+				    << qSetFieldWidth(0) << " %";
+
+				if (comparison.isRegression)
+				{
+					out << "  REGRESSION";
+					nRegressions++;
+				}
+			}
+			else if (hasBaseline)
+			{
+				out << "  (not in baseline)";
+			}
+
+			out << endl;
+		}
+
+		if (hasBaseline)
+		{
+			out << nRegressions << " regression(s) with a tolerance of "
+			    << parser.value(toleranceOption) << " %" << endl;
+		}
+
+		if (nRegressions > 0)
+		{
+			return 2;
+		}
+	}
+	catch (std::exception& exception)
+	{
+		out << "Could not run the benchmarks: " << exception.what() << endl;
+		return 1;
+	}
+
+	return 0;
+}
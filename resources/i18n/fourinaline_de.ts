@@ -133,6 +133,16 @@
         <source>Shows a hint for the next move.</source>
         <translation>Zeigt eine Empfehlung für den nächsten Spielzug an.</translation>
     </message>
+    <message>
+        <location filename="../../src/GUI/Actions/Move.cpp" line="155"/>
+        <source>&amp;Analysis mode</source>
+        <translation>&amp;Analysemodus</translation>
+    </message>
+    <message>
+        <location filename="../../src/GUI/Actions/Move.cpp" line="156"/>
+        <source>Continuously shows the scores of all columns.</source>
+        <translation>Zeigt fortlaufend die Bewertungen aller Spalten an.</translation>
+    </message>
     <message>
         <location filename="../../src/GUI/Actions/Move.cpp" line="136"/>
         <source>&amp;Move</source>
@@ -543,6 +553,16 @@
         <source>Language</source>
         <translation>Sprache</translation>
     </message>
+    <message>
+        <location filename="../../src/GUI/Widgets/ApplicationSettings.cpp" line="119"/>
+        <source>Limit computer players by a node budget instead of a search depth</source>
+        <translation>Computerspieler durch eine Knotenanzahl statt einer Suchtiefe begrenzen</translation>
+    </message>
+    <message>
+        <location filename="../../src/GUI/Widgets/ApplicationSettings.cpp" line="120"/>
+        <source>Log the search statistics of computer players</source>
+        <translation>Suchstatistiken der Computerspieler protokollieren</translation>
+    </message>
 </context>
 <context>
     <name>GUI::Widgets::Board</name>
@@ -684,6 +704,11 @@
         <source>Challenge</source>
         <translation>Herausforderung</translation>
     </message>
+    <message>
+        <location filename="../../src/GUI/Widgets/PlayerConfiguration.cpp" line="417"/>
+        <source>Perfect</source>
+        <translation>Perfekt</translation>
+    </message>
     <message>
         <location filename="../../src/GUI/Widgets/PlayerConfiguration.cpp" line="427"/>
         <source>Name</source>
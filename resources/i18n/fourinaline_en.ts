@@ -133,6 +133,16 @@
         <source>Shows a hint for the next move.</source>
         <translation type="unfinished"></translation>
     </message>
+    <message>
+        <location filename="../../src/GUI/Actions/Move.cpp" line="155"/>
+        <source>&amp;Analysis mode</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../../src/GUI/Actions/Move.cpp" line="156"/>
+        <source>Continuously shows the scores of all columns.</source>
+        <translation type="unfinished"></translation>
+    </message>
     <message>
         <location filename="../../src/GUI/Actions/Move.cpp" line="136"/>
         <source>&amp;Move</source>
@@ -539,6 +549,16 @@
         <source>Language</source>
         <translation type="unfinished"></translation>
     </message>
+    <message>
+        <location filename="../../src/GUI/Widgets/ApplicationSettings.cpp" line="119"/>
+        <source>Limit computer players by a node budget instead of a search depth</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../../src/GUI/Widgets/ApplicationSettings.cpp" line="120"/>
+        <source>Log the search statistics of computer players</source>
+        <translation type="unfinished"></translation>
+    </message>
 </context>
 <context>
     <name>GUI::Widgets::Board</name>
@@ -680,6 +700,11 @@
         <source>Challenge</source>
         <translation type="unfinished"></translation>
     </message>
+    <message>
+        <location filename="../../src/GUI/Widgets/PlayerConfiguration.cpp" line="417"/>
+        <source>Perfect</source>
+        <translation type="unfinished"></translation>
+    </message>
     <message>
         <location filename="../../src/GUI/Widgets/PlayerConfiguration.cpp" line="427"/>
         <source>Name</source>
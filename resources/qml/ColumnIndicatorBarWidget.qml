@@ -104,6 +104,31 @@ AbstractWidget
         }
     }
 
+    /**
+     * Marks the columns of the given principal variation.
+     *
+     * The first move of a column in the principal variation is used.
+     *
+     * @param moves List of columns, the best move followed by the expected moves of both players.
+     */
+    function setPrincipalVariation(moves)
+    {
+        var i;
+
+        for (i = 0; i < nColumns; ++i)
+        {
+            indicatorRow.children[i].principalVariationIndex = -1;
+        }
+
+        for (i = moves.length - 1; i >= 0; --i)
+        {
+            if (moves[i] < nColumns)
+            {
+                indicatorRow.children[moves[i]].principalVariationIndex = i;
+            }
+        }
+    }
+
     /**
      * Shows/hides column scores.
      *
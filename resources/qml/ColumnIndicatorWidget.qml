@@ -20,6 +20,12 @@ AbstractWidget
      */
     property bool showScore: false
 
+    /**
+     * Position of this column in the principal variation shown with the column scores, 0 when it is
+     * the best move, -1 when it is not part of it.
+     */
+    property int principalVariationIndex: -1
+
     /**
      * Whether the column is hovered or not.
      */
@@ -43,7 +43,8 @@ AbstractStyle
         radius: 5
         opacity: 0
         visible: true
-        border.width: 0
+        border.color: "#40822b"
+        border.width: (_widget.principalVariationIndex === 0) ? 2 : 0
 
         /**
          * The column score text.
@@ -42,7 +42,8 @@ AbstractStyle
         color: "#00000000"
         opacity: 0
         visible: true
-        border.width: 0
+        border.color: "#1999b9"
+        border.width: (_widget.principalVariationIndex === 0) ? 2 : 0
 
         /**
          * The column score text.
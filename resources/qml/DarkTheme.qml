@@ -273,8 +273,13 @@ Item
 
         onColumnHintsShown: {
             columnIndicatorBar.setColumnScores(columnScores);
+            columnIndicatorBar.setPrincipalVariation(principalVariation);
             columnIndicatorBar.setShowColumnScores(true);
         }
+
+        onColumnHintsHidden: {
+            columnIndicatorBar.setShowColumnScores(false);
+        }
     }
 
     Component.onCompleted: {
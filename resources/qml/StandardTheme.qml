@@ -280,8 +280,13 @@ Item
 
         onColumnHintsShown: {
             columnIndicatorBar.setColumnScores(columnScores);
+            columnIndicatorBar.setPrincipalVariation(principalVariation);
             columnIndicatorBar.setShowColumnScores(true);
         }
+
+        onColumnHintsHidden: {
+            columnIndicatorBar.setShowColumnScores(false);
+        }
     }
 
     Component.onCompleted: {
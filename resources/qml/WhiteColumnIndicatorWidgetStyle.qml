@@ -42,7 +42,8 @@ AbstractStyle
         radius: 3
         opacity: 0
         visible: true
-        border.width: 0
+        border.color: "#ffffff"
+        border.width: (_widget.principalVariationIndex === 0) ? 2 : 0
 
         /**
          * The column score text.
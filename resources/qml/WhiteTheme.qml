@@ -293,8 +293,13 @@ Item
 
         onColumnHintsShown: {
             columnIndicatorBar.setColumnScores(columnScores);
+            columnIndicatorBar.setPrincipalVariation(principalVariation);
             columnIndicatorBar.setShowColumnScores(true);
         }
+
+        onColumnHintsHidden: {
+            columnIndicatorBar.setShowColumnScores(false);
+        }
     }
 
     Component.onCompleted: {
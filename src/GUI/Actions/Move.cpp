@@ -59,6 +59,16 @@ QAction* Move::getHintAction() const
 	return this->hintAction;
 }
 
+/**
+ * Returns the analysis action.
+ *
+ * @return Checkable action for enabling/disabling the analysis mode.
+ */
+QAction* Move::getAnalysisAction() const
+{
+	return this->analysisAction;
+}
+
 /**
  * Returns the move menu.
  *
@@ -80,6 +90,8 @@ void Move::updateActions()
 
 	this->undoAction->setEnabled(false);
 	this->hintAction->setEnabled(false);
+	this->analysisAction->setEnabled(false);
+	this->analysisAction->setChecked(this->gameView->isAnalysisEnabled());
 
 	// Check which actions should be enabled.
 
@@ -87,6 +99,7 @@ void Move::updateActions()
 	{
 		this->undoAction->setEnabled(this->gameView->isUndoPossible());
 		this->hintAction->setEnabled(this->gameView->isShowHintPossible());
+		this->analysisAction->setEnabled(this->gameView->hasGame());
 	}
 }
 
@@ -110,6 +123,11 @@ void Move::createActions()
 
 	this->connect(this->hintAction, &QAction::triggered,
 				  this->gameView, &::GUI::GameView::showHint);
+
+	this->analysisAction = new QAction(this);
+	this->analysisAction->setCheckable(true);
+	this->connect(this->analysisAction, &QAction::toggled,
+				  this->gameView, &::GUI::GameView::setAnalysisEnabled);
 }
 
 /**
@@ -120,6 +138,7 @@ void Move::createMenu()
 	this->menu.reset(new QMenu(0));
 	this->menu->addAction(this->undoAction);
 	this->menu->addAction(this->hintAction);
+	this->menu->addAction(this->analysisAction);
 }
 
 /**
@@ -133,6 +152,9 @@ void Move::retranslateUI()
 	this->hintAction->setText(tr("&Show hint"));
 	this->hintAction->setStatusTip(tr("Shows a hint for the next move."));
 
+	this->analysisAction->setText(tr("&Analysis mode"));
+	this->analysisAction->setStatusTip(tr("Continuously shows the scores of all columns."));
+
 	this->menu->setTitle(tr("&Move"));
 }
 
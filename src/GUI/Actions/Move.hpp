@@ -19,7 +19,8 @@ namespace Actions
 /**
  * Contains actions regarding game moves, like undo/show hint, etc.
  *
- * Provides an action for undoing the last move, and an action for showing a hint for the next move.
+ * Provides an action for undoing the last move, an action for showing a hint for the next move and
+ * an action for enabling the analysis mode.
  */
 class Move : public QObject
 {
@@ -31,6 +32,7 @@ class Move : public QObject
 
 		QAction* getUndoAction() const;
 		QAction* getHintAction() const;
+		QAction* getAnalysisAction() const;
 
 		QMenu* getMenu() const;
 
@@ -67,6 +69,11 @@ class Move : public QObject
 		 */
 		QAction* hintAction;
 
+		/**
+		 * Enables/disables the analysis mode.
+		 */
+		QAction* analysisAction;
+
 		/**
 		 * Menu containing the move actions.
 		 */
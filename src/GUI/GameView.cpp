@@ -5,6 +5,7 @@
 #include "Dialogs/GameOver.hpp"
 
 #include "../Game/Players/AbstractPlayer.hpp"
+#include "../Game/Players/Factory.hpp"
 
 #include "../Game/GameWriter.hpp"
 #include "../Game/GameReader.hpp"
@@ -76,6 +77,9 @@ GameView::GameView(ViewManager* manager)
 	this->connect(this->gameController, &::Game::GameController::showColumnHints,
 	              this->widget->getBoardWidget(), &Widgets::Board::showColumnHints);
 
+	this->connect(this->gameController, &::Game::GameController::hideColumnHints,
+	              this->widget->getBoardWidget(), &Widgets::Board::hideColumnHints);
+
 	this->connect(this->gameController, &::Game::GameController::setCellHighlighted,
 	              this->widget->getBoardWidget(), &Widgets::Board::setCellHighlighted);
 
@@ -150,6 +154,16 @@ bool GameView::isShowHintPossible() const
 	return this->hasGame() && this->game->isShowHintPossible();
 }
 
+/**
+ * Returns whether the analysis mode is enabled.
+ *
+ * @return When the scores of the columns are shown continuously true, otherwise false.
+ */
+bool GameView::isAnalysisEnabled() const
+{
+	return this->gameController->isAnalysisEnabled();
+}
+
 /**
  * Asks the user whether he wants to abort the current game and returns whether the view can
  * be deactivated or not.
@@ -210,6 +224,7 @@ void GameView::playAgain()
 	if (this->confirmEndGame())
 	{
 		::Game::Players::Factory playerFactory(this->widget->getBoardWidget());
+		this->configurePlayerFactory(playerFactory);
 		auto firstPlayer = playerFactory.createCopy(this->game->getFirstPlayer());
 		auto secondPlayer = playerFactory.createCopy(this->game->getSecondPlayer());
 
@@ -334,6 +349,22 @@ void GameView::showHint()
 	}
 }
 
+/**
+ * Enables or disables the analysis mode.
+ *
+ * In the analysis mode the current position is analysed in the background and the scores of all
+ * columns are updated on the board whenever the analysis has searched one move deeper. The
+ * analysis only runs while hints are allowed.
+ *
+ * @param analysisEnabled Whether the analysis mode should be enabled.
+ */
+void GameView::setAnalysisEnabled(bool analysisEnabled)
+{
+	this->gameController->setAnalysisEnabled(analysisEnabled);
+
+	emit this->stateChanged();
+}
+
 /**
  * Invoked by the view manager when the view is activated.
  *
@@ -442,6 +473,7 @@ bool GameView::showNewGameDialog()
 	if (dialog.result() == QDialog::Accepted && this->requestActivation())
 	{
 		::Game::Players::Factory playerFactory(this->widget->getBoardWidget());
+		this->configurePlayerFactory(playerFactory);
 		auto game = dialog.createGame(playerFactory);
 
 		this->startGame(game);
@@ -552,6 +584,7 @@ bool GameView::loadGameFromFile(QString path)
 			if (dialog.result() == QDialog::Accepted)
 			{
 				::Game::Players::Factory playerFactory(this->widget->getBoardWidget());
+				this->configurePlayerFactory(playerFactory);
 				dialog.replacePlayers(playerFactory);
 
 				this->startGame(game);
@@ -570,6 +603,30 @@ bool GameView::loadGameFromFile(QString path)
 	return false;
 }
 
+/**
+ * Passes the application settings, opening books and tablebases to the given player factory.
+ *
+ * @param playerFactory The player factory which creates the players of the next game.
+ */
+void GameView::configurePlayerFactory(::Game::Players::Factory& playerFactory) const
+{
+	auto application = ::FourInALine::getInstance();
+	auto applicationSettings = application->getSettings()->getApplicationSettings();
+
+	playerFactory.setNodeBudgetEnabled(applicationSettings->isNodeBudgetEnabled());
+	playerFactory.setStatisticsLogged(applicationSettings->isStatisticsLogged());
+
+	playerFactory.setOpeningBookProvider([application](unsigned int nColumns, unsigned int nRows)
+	{
+		return application->getOpeningBook(nColumns, nRows);
+	});
+
+	playerFactory.setTablebaseProvider([application](unsigned int nColumns, unsigned int nRows)
+	{
+		return application->getTablebase(nColumns, nRows);
+	});
+}
+
 /**
  * Reads sound settings from sound settings and updates game board.
  */
@@ -22,6 +22,7 @@ class GameController;
 namespace Players
 {
 class AbstractPlayer;
+class Factory;
 }
 }
 
@@ -43,7 +44,8 @@ namespace GUI
  * a dialog to specify a filename.
  *
  * The last move can be undone with undoLastMove() and showHint() can be used to display a hint
- * for the current player indicating which move would be best.
+ * for the current player indicating which move would be best. With setAnalysisEnabled() the scores
+ * of all columns are shown continuously while hints are allowed, they are refined in the background.
  *
  * When a game is started/ended/loaded/saved or anything else happens that changes the game state,
  * stateChanged() is emitted. The signal can be used to update actions, i.e. check whether they
@@ -64,6 +66,7 @@ class GameView : public AbstractView
 
 		bool isUndoPossible() const;
 		bool isShowHintPossible() const;
+		bool isAnalysisEnabled() const;
 
 	signals:
 		/**
@@ -87,6 +90,7 @@ class GameView : public AbstractView
 		void undoLastMove();
 
 		void showHint();
+		void setAnalysisEnabled(bool analysisEnabled);
 
 	protected:
 		virtual void activate();
@@ -108,6 +112,8 @@ class GameView : public AbstractView
 		void destroyGame();
 		bool confirmEndGame() const;
 
+		void configurePlayerFactory(::Game::Players::Factory& playerFactory) const;
+
 		/**
 		 * The game widget.
 		 */
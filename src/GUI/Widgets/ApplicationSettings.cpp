@@ -4,6 +4,7 @@
 #include <QEvent>
 #include <QLabel>
 #include <QComboBox>
+#include <QCheckBox>
 #include <QFormLayout>
 #include <QMap>
 #include <QString>
@@ -29,6 +30,12 @@ ApplicationSettings::ApplicationSettings(Settings::Application* applicationSetti
 	this->languageComboBox = new QComboBox(this);
 	this->layout->addRow(this->languageLabel, this->languageComboBox);
 
+	this->nodeBudgetCheckBox = new QCheckBox(this);
+	this->layout->addRow(this->nodeBudgetCheckBox);
+
+	this->statisticsCheckBox = new QCheckBox(this);
+	this->layout->addRow(this->statisticsCheckBox);
+
 	this->reset();
 	this->retranslateUI();
 }
@@ -47,6 +54,8 @@ ApplicationSettings::~ApplicationSettings()
 void ApplicationSettings::reset()
 {
 	this->updateLanguages();
+	this->nodeBudgetCheckBox->setChecked(this->applicationSettings->isNodeBudgetEnabled());
+	this->statisticsCheckBox->setChecked(this->applicationSettings->isStatisticsLogged());
 }
 
 /**
@@ -56,6 +65,8 @@ void ApplicationSettings::read()
 {
 	this->applicationSettings->read();
 	this->updateLanguages();
+	this->nodeBudgetCheckBox->setChecked(this->applicationSettings->isNodeBudgetEnabled());
+	this->statisticsCheckBox->setChecked(this->applicationSettings->isStatisticsLogged());
 }
 
 /**
@@ -66,6 +77,8 @@ void ApplicationSettings::apply()
 	QString locale = this->languageComboBox->currentData().toString();
 
 	this->applicationSettings->setLanguage(locale);
+	this->applicationSettings->setNodeBudgetEnabled(this->nodeBudgetCheckBox->isChecked());
+	this->applicationSettings->setStatisticsLogged(this->statisticsCheckBox->isChecked());
 	this->applicationSettings->apply();
 }
 
@@ -103,6 +116,8 @@ void ApplicationSettings::retranslateUI()
 {
 	this->setTitle(tr("Application settings"));
 	this->languageLabel->setText(tr("Language"));
+	this->nodeBudgetCheckBox->setText(tr("Limit computer players by a node budget instead of a search depth"));
+	this->statisticsCheckBox->setText(tr("Log the search statistics of computer players"));
 }
 
 /**
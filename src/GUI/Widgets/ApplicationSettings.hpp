@@ -8,6 +8,7 @@
 class QFormLayout;
 class QLabel;
 class QComboBox;
+class QCheckBox;
 
 namespace GUI
 {
@@ -63,6 +64,16 @@ class ApplicationSettings : public QGroupBox
 		 */
 		QComboBox* languageComboBox;
 
+		/**
+		 * Check box for limiting computer players by a node budget.
+		 */
+		QCheckBox* nodeBudgetCheckBox;
+
+		/**
+		 * Check box for logging the search statistics of computer players.
+		 */
+		QCheckBox* statisticsCheckBox;
+
 };
 
 }
@@ -264,8 +264,9 @@ void Board::abortRequestMove()
  * Informs QML that column hints should be shown.
  *
  * @param columnScores Vector containing column scores.
+ * @param principalVariation Vector containing the best move followed by the expected moves.
  */
-void Board::showColumnHints(std::vector<int> columnScores)
+void Board::showColumnHints(std::vector<int> columnScores, std::vector<unsigned int> principalVariation)
 {
 	QVariantList columnScoreList;
 	for (auto i = columnScores.cbegin(); i < columnScores.cend(); ++i)
@@ -273,11 +274,27 @@ void Board::showColumnHints(std::vector<int> columnScores)
 		columnScoreList.append(*i);
 	}
 
-	emit this->columnHintsShown(columnScoreList);
+	QVariantList principalVariationList;
+	for (auto i = principalVariation.cbegin(); i < principalVariation.cend(); ++i)
+	{
+		principalVariationList.append(*i);
+	}
+
+	emit this->columnHintsShown(columnScoreList, principalVariationList);
 
 	qDebug() << "[" << this << "::showColumnHints ] Showing column hints.";
 }
 
+/**
+ * Informs QML that column hints should be hidden.
+ */
+void Board::hideColumnHints()
+{
+	emit this->columnHintsHidden();
+
+	qDebug() << "[" << this << "::hideColumnHints ] Hiding column hints.";
+}
+
 /**
  * Informs QML that the given cell should be highlighted/not highlighted.
  *
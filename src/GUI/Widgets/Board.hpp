@@ -162,8 +162,15 @@ class Board : public QWidget
 		 * Emitted when column scores should be shown as hint for the user.
 		 *
 		 * @param columnScores List of scores, a score from -100 to +100 for every column.
+		 * @param principalVariation List of columns, the best move followed by the expected moves of
+		 *        both players.
 		 */
-		void columnHintsShown(QVariantList columnScores);
+		void columnHintsShown(QVariantList columnScores, QVariantList principalVariation);
+
+		/**
+		 * Emitted when the column hints should be hidden.
+		 */
+		void columnHintsHidden();
 
 	public slots:
 		void startNewGame(unsigned int nColumns, unsigned int nRows,
@@ -184,7 +191,8 @@ class Board : public QWidget
 		void requestMove(std::vector<unsigned int> availableColumns, ::Game::Players::Human* player);
 		void abortRequestMove();
 
-		void showColumnHints(std::vector<int> columnScores);
+		void showColumnHints(std::vector<int> columnScores, std::vector<unsigned int> principalVariation);
+		void hideColumnHints();
 		void setCellHighlighted(unsigned int x, unsigned int y, bool highlight);
 
 	private slots:
@@ -417,6 +417,9 @@ void PlayerConfiguration::setupLevelOfDifficultyComboBox()
 	value = QVariant::fromValue(::Game::Players::ArtificialIntelligence::LevelOfDifficulty::CHALLENGE);
 	this->levelOfDifficultyComboBox->addItem(tr("Challenge"), value);
 
+	value = QVariant::fromValue(::Game::Players::ArtificialIntelligence::LevelOfDifficulty::PERFECT);
+	this->levelOfDifficultyComboBox->addItem(tr("Perfect"), value);
+
 	// Restore index.
 
 	this->levelOfDifficultyComboBox->setCurrentIndex(index);
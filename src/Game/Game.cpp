@@ -60,6 +60,21 @@ Game::ConstPlayerPointerType Game::getCurrentPlayer() const
 	return this->playerIdToPlayer(this->game->getCurrentPlayer());
 }
 
+/**
+ * Returns the player who waits while the current player makes a move.
+ *
+ * @return The opponent of the current player.
+ */
+Game::PlayerPointerType Game::getWaitingPlayer()
+{
+	if (this->game->getCurrentPlayer() == ::GameLogic::FourInALine::Game::PLAYER_ONE)
+	{
+		return this->secondPlayer;
+	}
+
+	return this->firstPlayer;
+}
+
 /**
  * Returns the player who won the game.
  *
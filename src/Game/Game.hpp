@@ -71,6 +71,8 @@ class Game
 		PlayerPointerType getCurrentPlayer();
 		ConstPlayerPointerType getCurrentPlayer() const;
 
+		PlayerPointerType getWaitingPlayer();
+
 		ConstPlayerPointerType getWinningPlayer() const;
 
 		ConstPlayerPointerType getTimedOutPlayer() const;
@@ -2,11 +2,17 @@
 #include "Game.hpp"
 #include "../GameLogic/FourInALine/Game.hpp"
 #include "../GameLogic/FourInALine/AAI.hpp"
+#include "../GameLogic/FourInALine/SearchWorker.hpp"
 #include "../Highscore/database.h"
 #include "../../app/FourInALine.hpp"
 
 #include <QDebug>
 #include <QTimer>
+#include <QMetaObject>
+
+#include <cstdlib>
+#include <limits>
+#include <memory>
 
 namespace Game
 {
@@ -17,16 +23,26 @@ namespace Game
  * @param parent Parent object.
  */
 GameController::GameController(QObject *parent) :
-    QObject(parent), moveRequested(false), artificialIntelligence(4)
+    QObject(parent), moveRequested(false), hintRequested(false), artificialIntelligence(4),
+    analysisEnabled(false), hasAnalysisResult(false)
 {
+	// The hints are computed by the worker shared with the computer players, the searched positions
+	// stay useful for the next hints. The column hints can only show exact scores, so all moves are
+	// searched with a full window.
+
+	this->artificialIntelligence.setKeepTranspositionTable(true);
+	this->artificialIntelligence.setScoreAllMoves(true);
+	this->artificialIntelligence.setMoveScoreWindow(
+	        std::numeric_limits<GameLogic::FourInALine::ArtificialIntelligence::ScoreType>::max());
+	this->artificialIntelligence.setFinishedCallback([this]()
+	{
+		QMetaObject::invokeMethod(this, "checkHintReady", Qt::QueuedConnection);
+	});
+
 	this->timeLimitTimer = new QTimer(this);
 	this->timeLimitTimer->setInterval(1000);
 
-	this->artificialIntelligenceTimer = new QTimer(this);
-	this->artificialIntelligenceTimer->setInterval(100);
-
 	this->connect(this->timeLimitTimer, &QTimer::timeout, this, &GameController::updateRemainingTime);
-	this->connect(this->artificialIntelligenceTimer, &QTimer::timeout, this, &GameController::checkHintReady);
 }
 
 /**
@@ -86,11 +102,45 @@ void GameController::endGame()
 	qDebug() << "[" << this << "::endGame ] " << "Ended game.";
 
 	this->abortRequest();
+	this->stopPondering();
+	this->stopAnalysis();
+	this->hintRequested = false;
 	this->game.reset();
 
 	emit this->gameEnded();
 }
 
+/**
+ * Sets whether the current position is analysed in the background.
+ *
+ * The position is only analysed when hints are allowed in the game and the game is not over.
+ *
+ * @param analysisEnabled When the position should be analysed true, otherwise false.
+ */
+void GameController::setAnalysisEnabled(bool analysisEnabled)
+{
+	this->analysisEnabled = analysisEnabled;
+
+	if (analysisEnabled)
+	{
+		this->restartAnalysis();
+	}
+	else
+	{
+		this->stopAnalysis();
+	}
+}
+
+/**
+ * Returns whether the current position is analysed in the background.
+ *
+ * @return When the analysis is enabled true, otherwise false.
+ */
+bool GameController::isAnalysisEnabled() const
+{
+	return this->analysisEnabled;
+}
+
 /**
  * Shows a hint for the next move a player could make.
  */
@@ -100,8 +150,12 @@ void GameController::showHint()
 
 	if (!this->artificialIntelligence.isComputing())
 	{
+		// The hint is computed by the worker shared with the players, it does not wait until their
+		// pondered replies were searched.
+
+		this->stopPondering();
 		this->artificialIntelligence.computeNextMoveAsynchronously(*this->game->getGameLogic());
-		this->artificialIntelligenceTimer->start();
+		this->hintRequested = true;
 	}
 }
 
@@ -115,6 +169,7 @@ void GameController::undoLastMove()
 	bool gameWasOverBefore = this->game->getGameLogic()->isOver();
 
 	this->abortRequest();
+	this->stopPondering();
 
 	if (gameWasOverBefore)
 	{
@@ -234,6 +289,8 @@ bool GameController::checkGameOver()
 		qDebug() << "[" << this << "::checkGameOver ] " << "Game is over.";
 
 		this->abortRequest();
+		this->stopPondering();
+		this->stopAnalysis();
 
 		if (this->game->getGameLogic()->hasTimeLimit())
 		{
@@ -294,7 +351,22 @@ void GameController::abortRequest()
 }
 
 /**
- * Requests next move from the current player and starts timer if there is a time limit.
+ * Stops the pondering of both players.
+ */
+void GameController::stopPondering()
+{
+	if (this->game.isNull())
+	{
+		return;
+	}
+
+	this->game->getCurrentPlayer()->stopPondering();
+	this->game->getWaitingPlayer()->stopPondering();
+}
+
+/**
+ * Requests next move from the current player, starts timer if there is a time limit and lets the
+ * waiting player ponder.
  */
 void GameController::requestNextMove()
 {
@@ -313,6 +385,9 @@ void GameController::requestNextMove()
 	this->game->getCurrentPlayer()->requestMove(this->game);
 	this->moveRequested = true;
 
+	this->game->getWaitingPlayer()->startPondering(this->game);
+	this->restartAnalysis();
+
 	if (this->game->getGameLogic()->hasTimeLimit())
 	{
 		this->remainingSeconds = this->game->getGameLogic()->getTimeLimit();
@@ -322,26 +397,186 @@ void GameController::requestNextMove()
 
 /**
  * Checks whether the AI has finished computing the hint and emits the according signal if so.
+ *
+ * Called whenever the AI has finished a computation. Hints requested for a game that has ended
+ * are ignored.
+ *
+ * The AI scores all columns in one search, the scores are mapped to -100 (loses) to +100 (wins).
+ * Full columns get -100.
  */
 void GameController::checkHintReady()
 {
-	if (this->artificialIntelligence.isNextMoveReady())
+	if (this->hintRequested && !this->game.isNull() && this->artificialIntelligence.isNextMoveReady())
 	{
 		unsigned int nColumns = this->game->getGameLogic()->getBoard()->getNumberOfColumns();
 
-		std::vector<int> columnScores(nColumns);
-		for (unsigned int i = 0; i < nColumns; ++i)
+		std::vector<int> columnScores(nColumns, -100);
+		std::vector<unsigned int> principalVariation;
+
+		for (const auto& moveScore : this->artificialIntelligence.getMoveScores())
+		{
+			columnScores[moveScore.column] = GameController::computeHintScore(moveScore.score);
+		}
+
+		// The move scores are sorted, the best move comes first.
+
+		if (!this->artificialIntelligence.getMoveScores().empty())
+		{
+			principalVariation.push_back(this->artificialIntelligence.getMoveScores().front().column);
+		}
+
+		this->hintRequested = false;
+
+		emit this->showColumnHints(columnScores, principalVariation);
+	}
+}
+
+/**
+ * Shows the result of the last completed search depth of the analysis.
+ *
+ * Called whenever the analysis has completed a search depth. Results of analyses which were
+ * stopped or restarted in the meantime are ignored, as well as results containing scores which are
+ * only bounds, because the column hints can only show exact scores.
+ */
+void GameController::showAnalysisResult()
+{
+	GameLogic::FourInALine::ArtificialIntelligence::IterationResult result;
+
+	{
+		std::lock_guard<std::mutex> lock(this->analysisMutex);
+
+		if (!this->hasAnalysisResult || this->game.isNull())
+		{
+			return;
+		}
+
+		result = this->analysisResult;
+		this->hasAnalysisResult = false;
+	}
+
+	unsigned int nColumns = this->game->getGameLogic()->getBoard()->getNumberOfColumns();
+	std::vector<int> columnScores(nColumns, -100);
+
+	for (const auto& moveScore : result.moveScores)
+	{
+		if (moveScore.bound != GameLogic::FourInALine::TranspositionTable::Bound::EXACT)
+		{
+			return;
+		}
+
+		columnScores[moveScore.column] = GameController::computeHintScore(moveScore.score);
+	}
+
+	emit this->showColumnHints(columnScores, result.principalVariation);
+}
+
+/**
+ * Creates the artificial intelligence of the analysis and its worker.
+ *
+ * The analysis is deepened until the board is full or the position changes. Every completed search
+ * depth replaces the result which was not yet shown.
+ */
+void GameController::createAnalysisArtificialIntelligence()
+{
+	auto worker = std::make_shared<GameLogic::FourInALine::SearchWorker>();
+
+	this->analysisArtificialIntelligence.reset(new GameLogic::FourInALine::AsynchronousArtificialIntelligence(
+	                                               std::numeric_limits<unsigned int>::max(), worker));
+
+	this->analysisArtificialIntelligence->setKeepTranspositionTable(true);
+	this->analysisArtificialIntelligence->setScoreAllMoves(true);
+
+	// Scores below the move score window are only upper bounds, with the full window every score is
+	// exact.
+
+	this->analysisArtificialIntelligence->setMoveScoreWindow(
+	    std::numeric_limits<GameLogic::FourInALine::ArtificialIntelligence::ScoreType>::max());
+
+	this->analysisArtificialIntelligence->setIterationCallback(
+	    [this](const GameLogic::FourInALine::ArtificialIntelligence::IterationResult& result)
+	{
 		{
-			columnScores[i] = -1;
+			std::lock_guard<std::mutex> lock(this->analysisMutex);
+
+			this->analysisResult = result;
+			this->hasAnalysisResult = true;
 		}
 
-		unsigned int nextMove = this->artificialIntelligence.getNextMove();
-		columnScores[nextMove] = 100;
+		QMetaObject::invokeMethod(this, "showAnalysisResult", Qt::QueuedConnection);
+	});
+}
 
-		emit this->showColumnHints(columnScores);
+/**
+ * Starts analysing the current position, an analysis of the previous position is cancelled.
+ *
+ * Cancelling only marks the running search, which stops at its next node, so restarting does not
+ * wait for the previous analysis.
+ */
+void GameController::restartAnalysis()
+{
+	if (this->analysisArtificialIntelligence)
+	{
+		this->analysisArtificialIntelligence->cancelComputation();
+	}
 
-		this->artificialIntelligenceTimer->stop();
+	{
+		// No result of the cancelled analysis is stored after it was cancelled.
+
+		std::lock_guard<std::mutex> lock(this->analysisMutex);
+		this->hasAnalysisResult = false;
 	}
+
+	if (this->analysisEnabled && !this->game.isNull() && this->game->isShowHintPossible())
+	{
+		if (!this->analysisArtificialIntelligence)
+		{
+			this->createAnalysisArtificialIntelligence();
+		}
+
+		this->analysisArtificialIntelligence->computeNextMoveAsynchronously(*this->game->getGameLogic());
+	}
+}
+
+/**
+ * Stops analysing the current position and hides the column hints.
+ */
+void GameController::stopAnalysis()
+{
+	if (this->analysisArtificialIntelligence)
+	{
+		this->analysisArtificialIntelligence->cancelComputation();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->analysisMutex);
+		this->hasAnalysisResult = false;
+	}
+
+	emit this->hideColumnHints();
+}
+
+/**
+ * Maps a score of the AI to a hint score from -100 to +100.
+ *
+ * Wins and losses get +100 and -100, the other scores are mapped to -99 to +99, a score of 100 (the
+ * value of three tokens in a line) to +49.
+ *
+ * @param score The score of a move for the current player.
+ * @return The hint score.
+ */
+int GameController::computeHintScore(int score)
+{
+	if (score == std::numeric_limits<int>::max())
+	{
+		return 100;
+	}
+
+	if (score == std::numeric_limits<int>::min())
+	{
+		return -100;
+	}
+
+	return static_cast<int>(99LL * score / (std::abs(static_cast<long long>(score)) + 100));
 }
 
 }
@@ -8,6 +8,8 @@
 #include <QObject>
 #include <QSharedPointer>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 class QTimer;
@@ -25,6 +27,14 @@ class Game;
  * When the game state changes, it emits signals to inform listeners about the changes.
  *
  * Use startGame() to start a new game and endGame() to end it.
+ *
+ * With setAnalysisEnabled() the current position is analysed in the background whenever hints are
+ * allowed: an artificial intelligence with its own worker deepens the search without limit and the
+ * scores of the columns and the principal variation are shown after every completed search depth.
+ * All moves are searched with a full window, so the shown scores are exact and not bounds. The
+ * analysis is restarted after every move and undo. The artificial intelligence and its worker
+ * thread are only created when the first analysis starts. The hints requested with showHint() are
+ * searched with a full window, too.
  */
 class GameController : public QObject
 {
@@ -36,6 +46,11 @@ class GameController : public QObject
 		void startGame(QSharedPointer< ::Game::Game> game);
 		void endGame();
 
+		void setAnalysisEnabled(bool analysisEnabled);
+		bool isAnalysisEnabled() const;
+
+		static int computeHintScore(int score);
+
 	signals:
 		/**
 		 * Emitted when a new game is started.
@@ -119,12 +134,18 @@ class GameController : public QObject
 		/**
 		 * Emitted when hints should be shown for the columns of the board.
 		 *
-		 * Higher scores are better than lower scores for the current player. Negative scores are
-		 * possible.
+		 * Higher scores are better than lower scores for the current player. The scores range from
+		 * -100 (the move loses) to +100 (the move wins).
 		 *
 		 * @param columnScores Vector containing scores for each column.
+		 * @param principalVariation The best move followed by the expected moves of both players.
+		 */
+		void showColumnHints(std::vector<int> columnScores, std::vector<unsigned int> principalVariation);
+
+		/**
+		 * Emitted when the column hints should not be shown anymore.
 		 */
-		void showColumnHints(std::vector<int> columnScores);
+		void hideColumnHints();
 
 	public slots:
 		void undoLastMove();
@@ -133,12 +154,17 @@ class GameController : public QObject
 	private slots:
 		void makeMove(unsigned int x);
 		void updateRemainingTime();
+		void checkHintReady();
+		void showAnalysisResult();
 
 	private:
 		bool checkGameOver();
 		void abortRequest();
+		void stopPondering();
+		void createAnalysisArtificialIntelligence();
+		void restartAnalysis();
+		void stopAnalysis();
 		void requestNextMove();
-		void checkHintReady();
 
 		/**
 		 * The game.
@@ -160,15 +186,41 @@ class GameController : public QObject
 		 */
 		bool moveRequested;
 
+		/**
+		 * Whether a hint was requested and not yet shown.
+		 */
+		bool hintRequested;
+
 		/**
 		 * Artificial intelligence for computing column hints.
 		 */
 		GameLogic::FourInALine::AsynchronousArtificialIntelligence artificialIntelligence;
 
 		/**
-		 * Timer for checking the AI result.
+		 * Whether the current position is analysed.
+		 */
+		bool analysisEnabled;
+
+		/**
+		 * Protects the analysis result, which is stored by the thread of the analysis.
+		 */
+		std::mutex analysisMutex;
+
+		/**
+		 * Result of the last completed search depth of the analysis.
+		 */
+		GameLogic::FourInALine::ArtificialIntelligence::IterationResult analysisResult;
+
+		/**
+		 * Whether the analysis result was stored and not yet shown.
+		 */
+		bool hasAnalysisResult;
+
+		/**
+		 * Artificial intelligence analysing the current position, it uses its own worker so that
+		 * the computer players are not blocked. nullptr until the first analysis starts.
 		 */
-		QTimer* artificialIntelligenceTimer;
+		std::unique_ptr<GameLogic::FourInALine::AsynchronousArtificialIntelligence> analysisArtificialIntelligence;
 };
 
 }
@@ -27,6 +27,28 @@ AbstractPlayer::~AbstractPlayer()
 
 }
 
+/**
+ * Invoked by the game logic when the opponent has to make a move.
+ *
+ * The default implementation does nothing.
+ *
+ * @param game The current game, the opponent makes the next move.
+ */
+void AbstractPlayer::startPondering(const QSharedPointer<const ::Game::Game>& game)
+{
+	Q_UNUSED(game);
+}
+
+/**
+ * Invoked by the game logic when the player should stop preparing its next move.
+ *
+ * The default implementation does nothing.
+ */
+void AbstractPlayer::stopPondering()
+{
+
+}
+
 /**
  * Returns the name of the player.
  *
@@ -26,6 +26,10 @@ namespace Players
  * player times out or the requested move isn't needed anymore abortMove() is called. Emit
  * moveReady() as soon as the requested move is ready/computed to inform the game logic about
  * the move.
+ *
+ * While the opponent has to make a move, the game logic calls startPondering(), players can
+ * reimplement it to prepare their next move in the meantime. stopPondering() is called when the
+ * game is over or the moves are undone. By default both methods do nothing.
  */
 class AbstractPlayer : public QObject
 {
@@ -45,6 +49,9 @@ class AbstractPlayer : public QObject
 		 */
 		virtual void abortMove() = 0;
 
+		virtual void startPondering(const QSharedPointer<const ::Game::Game>& game);
+		virtual void stopPondering();
+
 		QString getName() const;
 		void setName(QString name);
 
@@ -1,36 +1,74 @@
 #include "ArtificialIntelligence.hpp"
 #include "../Game.hpp"
 
-#include <QTimer>
+#include <QMetaObject>
 #include <QDebug>
 
+#include <chrono>
+#include <limits>
+
 namespace Game
 {
 
 namespace Players
 {
 
+const unsigned int ArtificialIntelligence::MAXIMUM_NARROW_BOARD_COLUMNS = 7;
+const unsigned int ArtificialIntelligence::N_LIKELY_REPLIES = 3;
+const std::chrono::milliseconds ArtificialIntelligence::PERFECT_PLAY_TIME_BUDGET(10000);
+const std::chrono::milliseconds ArtificialIntelligence::PONDERING_TIME_BUDGET(500);
+
 /**
  * Creates a new artificial intelligence player.
  *
- * The difficulty is used to set the search depth of the artificial intelligence.
+ * The difficulty is used to set the search depth or, when the node budget is enabled, the node
+ * budget of the artificial intelligence.
  *
  * @param player Player id used by the game engine.
  * @param difficulty How difficult should it be to beat the artificial intelligence?
  * @param name Name of the player.
  * @param parent Parent object.
+ * @param nodeBudgetEnabled Whether the moves are limited by a node budget instead of the search depth.
+ * @param openingBookProvider Returns the opening book of a board size, empty for no opening books.
+ * @param tablebaseProvider Returns the tablebase of a board size, empty for no tablebases.
+ * @param statisticsLogged Whether the statistics of every search are logged.
  */
 ArtificialIntelligence::ArtificialIntelligence(::GameLogic::FourInALine::Game::PlayerType player,
                                                            LevelOfDifficulty difficulty,
-                                                           QString name, QObject *parent) :
-    AbstractPlayer(player, name, parent), difficulty(difficulty),
+                                                           QString name, QObject *parent,
+                                                           bool nodeBudgetEnabled,
+                                                           OpeningBookProvider openingBookProvider,
+                                                           TablebaseProvider tablebaseProvider,
+                                                           bool statisticsLogged) :
+    AbstractPlayer(player, name, parent), difficulty(difficulty), nodeBudgetEnabled(nodeBudgetEnabled),
+    openingBookProvider(openingBookProvider), tablebaseProvider(tablebaseProvider), moveRequested(false), pondering(false), repliesPredicted(false),
     artificialIntelligence(static_cast<unsigned int>(difficulty))
 {
-	this->timer = new QTimer(this);
-	this->timer->setInterval(100);
+	// The player only plays one game, so the searched positions stay useful for the next moves.
+
+	this->artificialIntelligence.setKeepTranspositionTable(true);
+	this->artificialIntelligence.setNumberOfThreads(0);
+	this->artificialIntelligence.setPerfectPlay(difficulty == LevelOfDifficulty::PERFECT);
+
+	// Logging the statistics of every search allows e.g. to compare the latency of the difficulties.
 
-	this->connect(this->timer, &QTimer::timeout,
-	              this, &ArtificialIntelligence::checkIfNextMoveIsReady);
+	this->artificialIntelligence.setStatisticsLogged(statisticsLogged);
+
+	if (this->nodeBudgetEnabled)
+	{
+		// The search depth is limited by the number of empty cells.
+
+		this->artificialIntelligence.setSearchDepth(std::numeric_limits<unsigned int>::max());
+		this->artificialIntelligence.setNodeBudget(ArtificialIntelligence::getNodeBudget(difficulty));
+	}
+
+	// The artificial intelligence informs the player from the thread of the worker, the result is
+	// retrieved in the thread of the player.
+
+	this->artificialIntelligence.setFinishedCallback([this]()
+	{
+		QMetaObject::invokeMethod(this, "checkIfNextMoveIsReady", Qt::QueuedConnection);
+	});
 }
 
 /**
@@ -38,6 +76,7 @@ ArtificialIntelligence::ArtificialIntelligence(::GameLogic::FourInALine::Game::P
  */
 ArtificialIntelligence::~ArtificialIntelligence()
 {
+	this->stopPondering();
 	this->abortMove();
 }
 
@@ -50,10 +89,16 @@ void ArtificialIntelligence::requestMove(const QSharedPointer<const ::Game::Game
 {
 	qDebug() << "[" << this << "::requestMove ] Move requested.";
 
-	::GameLogic::FourInALine::Game gameEngine(*(game->getGameLogic().data()));
+	// The pondered positions are in the transposition table, the computation of the move replaces
+	// the pondering. A cancelled pondered reply may still be computed, so the move is only started
+	// when it has finished.
+
+	this->stopPondering();
 
-	this->artificialIntelligence.computeNextMoveAsynchronously(gameEngine);
-	this->timer->start();
+	this->requestedGame.reset(new ::GameLogic::FourInALine::Game(*(game->getGameLogic().data())));
+	this->moveRequested = true;
+
+	this->startRequestedMove();
 }
 
 /**
@@ -61,10 +106,58 @@ void ArtificialIntelligence::requestMove(const QSharedPointer<const ::Game::Game
  */
 void ArtificialIntelligence::abortMove()
 {
-	this->timer->stop();
+	this->moveRequested = false;
+	this->requestedGame.reset();
 	this->artificialIntelligence.cancelComputation();
 }
 
+/**
+ * Starts pondering while the opponent makes its move.
+ *
+ * The replies of the opponent are pondered one after another, each one in its own computation, so
+ * that other computations of the shared worker (e.g. hints) do not have to wait until all replies
+ * were pondered.
+ *
+ * @param game The current game, the opponent makes the next move.
+ */
+void ArtificialIntelligence::startPondering(const QSharedPointer<const ::Game::Game>& game)
+{
+	this->stopPondering();
+
+	if (game->getGameLogic()->isOver())
+	{
+		return;
+	}
+
+	qDebug() << "[" << this << "::startPondering ] Pondering.";
+
+	this->ponderedGame.reset(new ::GameLogic::FourInALine::Game(*(game->getGameLogic().data())));
+	this->pondering = true;
+	this->repliesPredicted = false;
+
+	this->ponderNextReply();
+}
+
+/**
+ * Stops pondering, a running computation of a pondered reply is cancelled.
+ */
+void ArtificialIntelligence::stopPondering()
+{
+	if (!this->pondering)
+	{
+		return;
+	}
+
+	this->pondering = false;
+	this->ponderedGame.reset();
+	this->remainingReplies.clear();
+
+	if (!this->moveRequested)
+	{
+		this->artificialIntelligence.cancelComputation();
+	}
+}
+
 /**
  * Returns the level of difficulty of the artificial intelligence.
  *
@@ -76,19 +169,201 @@ ArtificialIntelligence::LevelOfDifficulty ArtificialIntelligence::getLevelOfDiff
 }
 
 /**
- * Checks whether the next move is ready and if yes, stops the timer and emits the result.
+ * Returns the node budget per move of the given level of difficulty.
+ *
+ * The budgets are a little higher than the number of nodes which iterative deepening up to the
+ * search depth of the difficulty visits on a 7x6 board, so the difficulties play about as strong as
+ * with their search depth on that board. They were only measured on that board: on bigger boards
+ * the same budget reaches a smaller depth, so the difficulties play weaker there than with their
+ * search depth. A node takes about a microsecond, PERFECT takes a few seconds per move.
+ *
+ * @param difficulty The level of difficulty.
+ * @return Maximum number of nodes per move.
+ */
+unsigned long long ArtificialIntelligence::getNodeBudget(LevelOfDifficulty difficulty)
+{
+	switch (difficulty)
+	{
+		case LevelOfDifficulty::VERY_EASY:
+			return 10;
+		case LevelOfDifficulty::EASY:
+			return 200;
+		case LevelOfDifficulty::NORMAL:
+			return 600;
+		case LevelOfDifficulty::DIFFICULT:
+			return 1500;
+		case LevelOfDifficulty::CHALLENGE:
+			return 4000;
+		case LevelOfDifficulty::PERFECT:
+			return 4000000;
+	}
+
+	return 0;
+}
+
+/**
+ * Checks whether the next move is ready and if yes, emits the result.
+ *
+ * Called whenever the artificial intelligence has finished a computation. Results of aborted
+ * requests are ignored. When the requested move waits for a cancelled pondered reply, the move is
+ * started. When the player ponders, the next reply is pondered.
  */
 void ArtificialIntelligence::checkIfNextMoveIsReady()
 {
-	if (this->artificialIntelligence.isNextMoveReady())
+	if (this->requestedGame)
+	{
+		this->startRequestedMove();
+	}
+	else if (this->moveRequested && this->artificialIntelligence.isNextMoveReady())
 	{
 		qDebug() << "[" << this << "::checkIfNextMoveIsReady ] Move ready!";
 
 		unsigned int move = this->artificialIntelligence.getNextMove();
-		this->timer->stop();
+		this->moveRequested = false;
 
 		emit this->moveReady(move);
 	}
+	else if (this->pondering)
+	{
+		this->ponderNextReply();
+	}
+}
+
+/**
+ * Sets the time budget, the opening book and the tablebase of the artificial intelligence for the
+ * given game.
+ *
+ * With a time limit, search only as deep as possible within 3/4 of the time limit, the rest is left
+ * for checking whether the result is ready. Without a time limit, the difficulty PERFECT uses
+ * PERFECT_PLAY_TIME_BUDGET unless it has a node budget. A pondered reply gets at most
+ * PONDERING_TIME_BUDGET.
+ *
+ * The search worker reads the settings while it computes, so they must only be changed when the
+ * artificial intelligence does not compute, not even a cancelled computation.
+ *
+ * @param gameEngine The game.
+ * @param forPondering Whether the replies of the opponent are pondered.
+ */
+void ArtificialIntelligence::configureFor(const ::GameLogic::FourInALine::Game& gameEngine,
+                                          bool forPondering)
+{
+	std::chrono::milliseconds timeBudget(0);
+
+	if (gameEngine.hasTimeLimit())
+	{
+		std::chrono::milliseconds timeLimit(gameEngine.getTimeLimit() * 1000);
+		timeBudget = timeLimit * 3 / 4;
+	}
+	else if (this->difficulty == LevelOfDifficulty::PERFECT && !this->nodeBudgetEnabled)
+	{
+		timeBudget = ArtificialIntelligence::PERFECT_PLAY_TIME_BUDGET;
+	}
+
+	if (forPondering &&
+	    (timeBudget.count() == 0 || timeBudget > ArtificialIntelligence::PONDERING_TIME_BUDGET))
+	{
+		timeBudget = ArtificialIntelligence::PONDERING_TIME_BUDGET;
+	}
+
+	if (timeBudget != this->artificialIntelligence.getTimeBudget())
+	{
+		this->artificialIntelligence.setTimeBudget(timeBudget);
+	}
+
+	std::shared_ptr<const ::GameLogic::FourInALine::OpeningBook> openingBook;
+
+	if (this->difficulty >= LevelOfDifficulty::NORMAL && !this->nodeBudgetEnabled &&
+	    this->openingBookProvider)
+	{
+		auto board = gameEngine.getBoard();
+		openingBook = this->openingBookProvider(board->getNumberOfColumns(), board->getNumberOfRows());
+	}
+
+	if (openingBook != this->artificialIntelligence.getOpeningBook())
+	{
+		this->artificialIntelligence.setOpeningBook(openingBook);
+	}
+
+	std::shared_ptr<const ::GameLogic::FourInALine::Tablebase> tablebase;
+
+	if (this->difficulty >= LevelOfDifficulty::CHALLENGE && this->tablebaseProvider)
+	{
+		auto board = gameEngine.getBoard();
+		tablebase = this->tablebaseProvider(board->getNumberOfColumns(), board->getNumberOfRows());
+	}
+
+	if (tablebase != this->artificialIntelligence.getTablebase())
+	{
+		this->artificialIntelligence.setTablebase(tablebase);
+	}
+}
+
+/**
+ * Starts the computation of the requested move.
+ *
+ * Waits for the next call when the artificial intelligence is still computing, i.e. when a
+ * cancelled pondered reply has not finished yet.
+ */
+void ArtificialIntelligence::startRequestedMove()
+{
+	if (this->artificialIntelligence.isComputing())
+	{
+		return;
+	}
+
+	this->configureFor(*this->requestedGame, false);
+	this->artificialIntelligence.computeNextMoveAsynchronously(*this->requestedGame);
+
+	this->requestedGame.reset();
+}
+
+/**
+ * Starts the computation of the next pondered reply, stops pondering when all replies were
+ * pondered.
+ *
+ * Waits for the next call when the artificial intelligence is still computing, e.g. when the last
+ * pondering was cancelled but has not finished yet.
+ */
+void ArtificialIntelligence::ponderNextReply()
+{
+	if (this->artificialIntelligence.isComputing())
+	{
+		return;
+	}
+
+	if (!this->repliesPredicted)
+	{
+		// The transposition table must not be used while computing, so the replies are predicted
+		// when the first reply is pondered.
+
+		this->remainingReplies = this->artificialIntelligence.predictMoves(*this->ponderedGame);
+		this->repliesPredicted = true;
+
+		unsigned int nColumns = this->ponderedGame->getBoard()->getNumberOfColumns();
+
+		if (nColumns > ArtificialIntelligence::MAXIMUM_NARROW_BOARD_COLUMNS &&
+		    this->remainingReplies.size() > ArtificialIntelligence::N_LIKELY_REPLIES)
+		{
+			this->remainingReplies.resize(ArtificialIntelligence::N_LIKELY_REPLIES);
+		}
+
+		this->configureFor(*this->ponderedGame, true);
+	}
+
+	if (this->remainingReplies.empty())
+	{
+		qDebug() << "[" << this << "::ponderNextReply ] All replies pondered.";
+
+		this->stopPondering();
+		return;
+	}
+
+	::GameLogic::FourInALine::Game replyGame(*this->ponderedGame);
+
+	replyGame.makeMove(this->remainingReplies.front());
+	this->remainingReplies.erase(this->remainingReplies.begin());
+
+	this->artificialIntelligence.computeNextMoveAsynchronously(replyGame);
 }
 
 }
@@ -5,7 +5,10 @@
 #include "../../GameLogic/FourInALine/Game.hpp"
 #include "../../GameLogic/FourInALine/AAI.hpp"
 
-class QTimer;
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
 
 namespace Game
 {
@@ -16,7 +19,39 @@ namespace Players
 /**
  * A player controlled by the computer/an artificial intelligence.
  *
- * This player uses an artificial intelligence to compute it's next moves.
+ * This player uses an artificial intelligence to compute it's next moves. When the game has a time
+ * limit, the search is stopped in time and the player makes the best move found until then. The
+ * search uses one thread per processor core. The computations are executed by the search worker
+ * which is shared with the other computer players and the hints of the game controller.
+ *
+ * While the opponent thinks about its move, the player ponders: it searches the positions after the
+ * likely replies of the opponent (all replies on narrow boards) one after another, each one with at
+ * most PONDERING_TIME_BUDGET, so pondering never occupies the shared worker for long. Pondering is
+ * cancelled when the player has to move, the game controller also cancels it when a hint is
+ * requested. The searched positions are kept in the transposition table, so when the opponent made
+ * one of the pondered replies, the search of the next move finds them in the table. Only the table
+ * of the first search thread is reused reliably: the other threads keep their own transposition
+ * tables, and which root moves a thread searches depends on the scheduling.
+ *
+ * From the difficulty NORMAL on, the player uses the opening book of the board size, if the
+ * application has one. From the difficulty CHALLENGE on, it also uses the tablebase of the board
+ * size and plays perfectly on small boards.
+ *
+ * With the difficulty PERFECT, the player plays perfectly on boards supported by the solver (see
+ * ::GameLogic::FourInALine::Solver), otherwise it searches with a search depth of 8. Without a time
+ * limit, the player uses PERFECT_PLAY_TIME_BUDGET per move, because solving the first moves of
+ * bigger boards takes too long.
+ *
+ * When the node budget is enabled, the level of difficulty defines a node budget per move (see
+ * getNodeBudget()) instead of a search depth. The search then goes as deep as the budget allows, so
+ * a move takes about the same time on every board size and in every position. The search then uses
+ * one thread, so the player makes the same moves on every machine. The opening book is not used
+ * then, because it was computed for a search depth.
+ *
+ * The player does not know the application: whether the node budget is enabled, whether the
+ * statistics of the searches are logged and where the opening books and tablebases come from is
+ * passed to the constructor, usually by the player factory. Without providers the player plays
+ * without opening book and tablebase.
  */
 class ArtificialIntelligence : public AbstractPlayer
 {
@@ -30,38 +65,126 @@ class ArtificialIntelligence : public AbstractPlayer
 			EASY = 3,
 			NORMAL = 4,
 			DIFFICULT = 5,
-			CHALLENGE = 6
+			CHALLENGE = 6,
+			PERFECT = 8
 		};
 
+		/**
+		 * Returns the opening book for the given number of columns and rows or nullptr.
+		 */
+		using OpeningBookProvider =
+		        std::function<std::shared_ptr<const ::GameLogic::FourInALine::OpeningBook>(unsigned int,
+		                                                                                   unsigned int)>;
+
+		/**
+		 * Returns the tablebase for the given number of columns and rows or nullptr.
+		 */
+		using TablebaseProvider =
+		        std::function<std::shared_ptr<const ::GameLogic::FourInALine::Tablebase>(unsigned int,
+		                                                                                 unsigned int)>;
+
 		explicit ArtificialIntelligence(::GameLogic::FourInALine::Game::PlayerType player,
 		                                      LevelOfDifficulty difficulty,
-		                                      QString name = QString(""), QObject *parent = 0);
+		                                      QString name = QString(""), QObject *parent = 0,
+		                                      bool nodeBudgetEnabled = false,
+		                                      OpeningBookProvider openingBookProvider = OpeningBookProvider(),
+		                                      TablebaseProvider tablebaseProvider = TablebaseProvider(),
+		                                      bool statisticsLogged = false);
 		virtual ~ArtificialIntelligence();
 
 		virtual void requestMove(const QSharedPointer<const ::Game::Game>& game) override;
 
 		virtual void abortMove() override;
 
+		virtual void startPondering(const QSharedPointer<const ::Game::Game>& game) override;
+		virtual void stopPondering() override;
+
 		LevelOfDifficulty getLevelOfDifficulty() const;
 
+		static unsigned long long getNodeBudget(LevelOfDifficulty difficulty);
+
+		/**
+		 * Boards with at most this number of columns are narrow, all replies are pondered.
+		 */
+		static const unsigned int MAXIMUM_NARROW_BOARD_COLUMNS;
+
+		/**
+		 * Number of replies pondered on boards which are not narrow.
+		 */
+		static const unsigned int N_LIKELY_REPLIES;
+
+		/**
+		 * Time budget per move of the difficulty PERFECT when the game has no time limit.
+		 */
+		static const std::chrono::milliseconds PERFECT_PLAY_TIME_BUDGET;
+
+		/**
+		 * Maximum time budget for pondering a reply of the opponent.
+		 */
+		static const std::chrono::milliseconds PONDERING_TIME_BUDGET;
+
 	private slots:
 		void checkIfNextMoveIsReady();
 
 	private:
+		void configureFor(const ::GameLogic::FourInALine::Game& gameEngine, bool forPondering);
+		void startRequestedMove();
+		void ponderNextReply();
+
 		/**
 		 * How difficult should the AI be?
 		 */
 		LevelOfDifficulty difficulty;
 
 		/**
-		 * The artificial intelligence used to compute the next move.
+		 * Whether the moves are limited by a node budget instead of the search depth.
 		 */
-		::GameLogic::FourInALine::AsynchronousArtificialIntelligence artificialIntelligence;
+		bool nodeBudgetEnabled;
+
+		/**
+		 * Returns the opening book of a board size, may be empty.
+		 */
+		OpeningBookProvider openingBookProvider;
+
+		/**
+		 * Returns the tablebase of a board size, may be empty.
+		 */
+		TablebaseProvider tablebaseProvider;
 
 		/**
-		 * Timer used to query the artificial intelligence.
+		 * Whether a move was requested and not yet made or aborted.
 		 */
-		QTimer* timer;
+		bool moveRequested;
+
+		/**
+		 * The game of the requested move while a cancelled pondered reply is still computed.
+		 */
+		QSharedPointer< ::GameLogic::FourInALine::Game> requestedGame;
+
+		/**
+		 * Whether the player ponders at the moment.
+		 */
+		bool pondering;
+
+		/**
+		 * Whether the replies to ponder were already predicted.
+		 */
+		bool repliesPredicted;
+
+		/**
+		 * The game in which the opponent makes the next move while pondering.
+		 */
+		QSharedPointer< ::GameLogic::FourInALine::Game> ponderedGame;
+
+		/**
+		 * Replies of the opponent that were not pondered yet, the most likely reply first.
+		 */
+		std::vector<unsigned int> remainingReplies;
+
+		/**
+		 * The artificial intelligence used to compute the next move.
+		 */
+		::GameLogic::FourInALine::AsynchronousArtificialIntelligence artificialIntelligence;
 };
 
 }
@@ -17,7 +17,7 @@ namespace Players
  * @param board Board widget to use for the human player.
  */
 Factory::Factory(::GUI::Widgets::Board* board)
-    : board(board)
+    : board(board), nodeBudgetEnabled(false), statisticsLogged(false)
 {
 
 }
@@ -62,7 +62,10 @@ Factory::createArtificialIntelligencePlayer(PlayerType playerId, QString name,
 {
 	QSharedPointer<ArtificialIntelligence> player;
 
-	player.reset(new ArtificialIntelligence(playerId, levelOfDifficulty, name), &QObject::deleteLater);
+	player.reset(new ArtificialIntelligence(playerId, levelOfDifficulty, name, 0, this->nodeBudgetEnabled,
+	                                        this->openingBookProvider, this->tablebaseProvider,
+	                                        this->statisticsLogged),
+	             &QObject::deleteLater);
 
 	return player;
 }
@@ -150,5 +153,47 @@ QSharedPointer<Placeholder> Factory::createPlaceholder(const QSharedPointer<cons
 	return placeholderPlayer;
 }
 
+/**
+ * Sets whether the artificial intelligence players created afterwards use a node budget instead of
+ * the search depth.
+ *
+ * @param nodeBudgetEnabled Whether the node budget is enabled.
+ */
+void Factory::setNodeBudgetEnabled(bool nodeBudgetEnabled)
+{
+	this->nodeBudgetEnabled = nodeBudgetEnabled;
+}
+
+/**
+ * Sets whether the artificial intelligence players created afterwards log the statistics of every
+ * search.
+ *
+ * @param statisticsLogged Whether the statistics are logged.
+ */
+void Factory::setStatisticsLogged(bool statisticsLogged)
+{
+	this->statisticsLogged = statisticsLogged;
+}
+
+/**
+ * Sets the provider of the opening books for the artificial intelligence players created afterwards.
+ *
+ * @param openingBookProvider Returns the opening book of a board size, empty for no opening books.
+ */
+void Factory::setOpeningBookProvider(AIPlayer::OpeningBookProvider openingBookProvider)
+{
+	this->openingBookProvider = openingBookProvider;
+}
+
+/**
+ * Sets the provider of the tablebases for the artificial intelligence players created afterwards.
+ *
+ * @param tablebaseProvider Returns the tablebase of a board size, empty for no tablebases.
+ */
+void Factory::setTablebaseProvider(AIPlayer::TablebaseProvider tablebaseProvider)
+{
+	this->tablebaseProvider = tablebaseProvider;
+}
+
 }
 }
@@ -19,7 +19,11 @@ namespace Players
  * Creates players.
  *
  * The player factory is used to create players. It contains a pointer to the current board widget,
- * which is needed for the human player to request a move from the user/player.
+ * which is needed for the human player to request a move from the user/player, and the settings and
+ * resources of the artificial intelligence players: whether the node budget is enabled, whether the
+ * statistics of their searches are logged and the providers of the opening books and tablebases. By
+ * default, the node budget is disabled, nothing is logged and there are no opening books and
+ * tablebases.
  */
 class Factory
 {
@@ -55,11 +59,36 @@ class Factory
 		QSharedPointer<Placeholder> createPlaceholder(PlayerType playerId, QString name) const;
 		QSharedPointer<Placeholder> createPlaceholder(const QSharedPointer<const AbstractPlayer>& player) const;
 
+		void setNodeBudgetEnabled(bool nodeBudgetEnabled);
+		void setStatisticsLogged(bool statisticsLogged);
+		void setOpeningBookProvider(AIPlayer::OpeningBookProvider openingBookProvider);
+		void setTablebaseProvider(AIPlayer::TablebaseProvider tablebaseProvider);
+
 	private:
 		/**
 		 * Game board widget, used by the human player.
 		 */
 		::GUI::Widgets::Board* board;
+
+		/**
+		 * Whether the artificial intelligence players use a node budget instead of the search depth.
+		 */
+		bool nodeBudgetEnabled;
+
+		/**
+		 * Whether the artificial intelligence players log the statistics of every search.
+		 */
+		bool statisticsLogged;
+
+		/**
+		 * Opening books of the artificial intelligence players, may be empty.
+		 */
+		AIPlayer::OpeningBookProvider openingBookProvider;
+
+		/**
+		 * Tablebases of the artificial intelligence players, may be empty.
+		 */
+		AIPlayer::TablebaseProvider tablebaseProvider;
 };
 
 }
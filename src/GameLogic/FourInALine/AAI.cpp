@@ -30,31 +30,58 @@ class InterruptedException : public std::runtime_error
 };
 
 /**
- * Creates a new asynchronous artificial intelligence with the given search depth.
+ * Creates a new asynchronous artificial intelligence with the given search depth, which uses the
+ * shared worker.
  *
  * @param searchDepth Search depth.
  */
 AsynchronousArtificialIntelligence::AsynchronousArtificialIntelligence(unsigned int searchDepth)
-    : ArtificialIntelligence(searchDepth), cancel(false), running(false),
-      lastResult(AsynchronousArtificialIntelligence::INVALID_RESULT)
+    : AsynchronousArtificialIntelligence(searchDepth, SearchWorker::getSharedInstance())
 {
 
 }
 
+/**
+ * Creates a new asynchronous artificial intelligence with the given search depth, which uses the
+ * given worker.
+ *
+ * @param searchDepth Search depth.
+ * @param worker Worker executing the computations.
+ */
+AsynchronousArtificialIntelligence::AsynchronousArtificialIntelligence(unsigned int searchDepth,
+                                                                       std::shared_ptr<SearchWorker> worker)
+    : ArtificialIntelligence(searchDepth), worker(worker), lastJob(0), lastCancelledJob(0),
+      lastStoppedJob(0), lastFinishedJob(0), currentJob(0),
+      lastResult(AsynchronousArtificialIntelligence::INVALID_RESULT)
+{
+	if (!this->worker)
+	{
+		throw std::invalid_argument("The worker must not be null.");
+	}
+}
+
 /**
  * Frees all used resources.
+ *
+ * Cancels the computation, removes the pending jobs of this object from the queue of the worker and
+ * waits until its running job has stopped, because the jobs use this object. The jobs of other
+ * artificial intelligences sharing the worker are not waited for.
  */
 AsynchronousArtificialIntelligence::~AsynchronousArtificialIntelligence()
 {
-	if (this->isComputing())
+	this->cancelComputation();
+
+	if (!this->worker->isWorkerThread())
 	{
-		this->cancelComputation();
+		this->worker->removeJobs(this);
 	}
 }
 
 /**
  * Starts computation of the next move in a separate thread.
  *
+ * Adds a job to the queue of the worker, a computation which is still running is cancelled.
+ *
  * @param game The current game state.
  */
 void AsynchronousArtificialIntelligence::computeNextMoveAsynchronously(const Game& game)
@@ -65,11 +92,21 @@ void AsynchronousArtificialIntelligence::computeNextMoveAsynchronously(const Gam
 	}
 
 	this->lastResult = AsynchronousArtificialIntelligence::INVALID_RESULT;
-	this->running = true;
-	this->cancel = false;
-	this->nextMoveTask = std::async(std::launch::async,
-	                                &AsynchronousArtificialIntelligence::computeNextMove,
-	                                this, game);
+
+	unsigned int job = ++this->lastJob;
+	Board board(*game.getBoard());
+	PlayerType player = game.getCurrentPlayer();
+
+	auto task = std::make_shared<std::packaged_task<unsigned int()> >([this, board, player, job]() mutable
+	{
+		return this->computeJob(board, player, job);
+	});
+
+	this->nextMoveTask = task->get_future();
+	this->worker->addJob([task]()
+	{
+		(*task)();
+	}, this);
 }
 
 /**
@@ -100,11 +137,13 @@ bool AsynchronousArtificialIntelligence::isNextMoveValid()
 /**
  * Returns whether the artificial intelligence is computing a move at the moment.
  *
+ * A computation whose job is still waiting in the queue of the worker counts as computing.
+ *
  * @return When it is computing true, otherwise false.
  */
 bool AsynchronousArtificialIntelligence::isComputing() const
 {
-	return this->running;
+	return this->lastFinishedJob != this->lastJob;
 }
 
 /**
@@ -117,18 +156,17 @@ bool AsynchronousArtificialIntelligence::isComputing() const
  */
 unsigned int AsynchronousArtificialIntelligence::getNextMove(std::chrono::milliseconds timeout)
 {
-	if (this->running)
+	if (this->isComputing())
 	{
 		this->nextMoveTask.wait_for(timeout);
 	}
 
-	bool taskValidAndReady = this->nextMoveTask.valid() &&
-	                         this->nextMoveTask.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
-	if (!this->running && taskValidAndReady)
+	if (!this->isComputing() && this->nextMoveTask.valid())
 	{
 		try
 		{
-			// Computation finished, get the result.
+			// Computation finished, get the result. The job has already finished, so this only
+			// waits until the result is stored.
 
 			this->lastResult = this->nextMoveTask.get();
 		}
@@ -151,60 +189,169 @@ unsigned int AsynchronousArtificialIntelligence::getNextMove(std::chrono::millis
 
 /**
  * Cancels the computation, the result will be invalid.
+ *
+ * Waits until a running iteration callback has returned, afterwards the callback is not called
+ * for the cancelled computations anymore.
  */
 void AsynchronousArtificialIntelligence::cancelComputation()
 {
-	this->cancel = true;
+	std::lock_guard<std::mutex> lock(this->iterationCallbackMutex);
+
+	this->lastCancelledJob = this->lastJob.load();
+}
+
+/**
+ * Stops the computation as soon as possible, the result stays valid.
+ *
+ * When the search uses iterative deepening (with a time budget, a node budget or an iteration
+ * callback), the result is the best move of the deepest search that was completed until now.
+ * Otherwise there is no completed search to fall back to, so the search is finished normally.
+ */
+void AsynchronousArtificialIntelligence::stopComputation()
+{
+	this->lastStoppedJob = this->lastJob.load();
+}
+
+/**
+ * Returns the worker executing the computations, it can be passed to other asynchronous
+ * artificial intelligences to share it.
+ *
+ * @return The worker.
+ */
+std::shared_ptr<SearchWorker> AsynchronousArtificialIntelligence::getWorker() const
+{
+	return this->worker;
+}
+
+/**
+ * Sets the function which is called when a computation has finished.
+ *
+ * The function is called by the thread of the worker, after the computation has finished but before
+ * the result is stored. Therefore it must not retrieve the result itself, it should inform another
+ * thread which then calls getNextMove(). It is also called when the computation was cancelled, in
+ * which case the result is invalid. The destructor waits until the function has returned.
+ *
+ * Set the function before starting a computation, it must not be changed while computing.
+ *
+ * @param finishedCallback Function called when a computation has finished, or an empty function.
+ */
+void AsynchronousArtificialIntelligence::setFinishedCallback(std::function<void()> finishedCallback)
+{
+	this->finishedCallback = finishedCallback;
 }
 
 /**
- * Computes the next move and sets the running attribute to false.
+ * Computes the next move in a job of the worker, marks the job as finished and calls the finished
+ * callback.
  *
- * This method just calls ArtificialIntelligence::computeNextMove() and returns it's result. But
- * before returning the result it sets the running attribute to false so that it is possible to know
- * that the result is ready.
+ * Throws InterruptedException when the job was cancelled, also when it was cancelled before it
+ * started or the move was found without searching.
  *
- * @param game The game for which the next move should be computed.
+ * @param board Copy of the board of the game.
+ * @param player The player who makes the next move.
+ * @param job Number of the job.
  * @return The next move.
  * @see ArtificialIntelligence::computeNextMove() Called by this method.
  */
-unsigned int AsynchronousArtificialIntelligence::computeNextMove(const Game& game) const
+unsigned int AsynchronousArtificialIntelligence::computeJob(Board& board,
+                                                            ArtificialIntelligence::PlayerType player,
+                                                            unsigned int job) const
 {
-	unsigned int result = ArtificialIntelligence::computeNextMove(game);
+	unsigned int result;
+
+	this->currentJob = job;
+
+	try
+	{
+		// A job cancelled while it was queued is not computed at all, a move found without
+		// searching (e.g. in the tablebase or the opening book) is discarded when the job was
+		// cancelled meanwhile.
+
+		if (job <= this->lastCancelledJob)
+		{
+			throw InterruptedException("Computation cancelled.");
+		}
+
+		result = this->computeNextMove(board, player, this->scoreAllMoves);
+
+		if (job <= this->lastCancelledJob)
+		{
+			throw InterruptedException("Computation cancelled.");
+		}
+	}
+	catch (...)
+	{
+		// The search of every thread has finished here.
+
+		this->lastFinishedJob = job;
+
+		if (this->finishedCallback)
+		{
+			this->finishedCallback();
+		}
+
+		throw;
+	}
+
+	this->lastFinishedJob = job;
+
+	if (this->finishedCallback)
+	{
+		this->finishedCallback();
+	}
 
-	this->running = false;
 	return result;
 }
 
 /**
  * Checks whether the computation should be cancelled and if not calls
- * ArtificialIntelligence::minimax.
- *
- * @param node Whether this node is minimizing or maximizing.
- * @param board The board to evaluate.
- * @param player The current player (who made the last move on the board).
- * @param depth Remaining search depth.
- * @param alpha Maximum score the maximizing player is assured of.
- * @param beta Minimum score the minimizing player is assured of.
- * @return List of scored moves.
- * @see ArtificialIntelligence::minimax() Called by this method.
- */
-ArtificialIntelligence::ScoredMovesType
-AsynchronousArtificialIntelligence::minimax(ArtificialIntelligence::Node node, const Board& board,
-                                            ArtificialIntelligence::PlayerType player,
-                                            unsigned int depth,
-                                            ArtificialIntelligence::ScoreType alpha,
-                                            ArtificialIntelligence::ScoreType beta) const
-{
-	if (this->cancel)
+ * ArtificialIntelligence::checkSearchStop().
+ *
+ * This method is called by every node of the search, also by the nodes searched in other threads
+ * when the search uses several threads.
+ *
+ * @see ArtificialIntelligence::checkSearchStop() Called by this method.
+ */
+void AsynchronousArtificialIntelligence::checkSearchStop() const
+{
+	unsigned int job = this->currentJob;
+
+	if (job <= this->lastCancelledJob)
 	{
 		// This ends the computation. ;-)
 
-		this->running = false;
 		throw InterruptedException("Computation cancelled.");
 	}
 
-	return ArtificialIntelligence::minimax(node, board, player, depth, alpha, beta);
+	ArtificialIntelligence::checkSearchStop();
+}
+
+/**
+ * Calls the iteration callback, unless the computation was cancelled.
+ *
+ * @param result The result of the completed search depth.
+ */
+void AsynchronousArtificialIntelligence::callIterationCallback(const ArtificialIntelligence::IterationResult& result) const
+{
+	std::lock_guard<std::mutex> lock(this->iterationCallbackMutex);
+
+	if (this->currentJob > this->lastCancelledJob)
+	{
+		ArtificialIntelligence::callIterationCallback(result);
+	}
+}
+
+/**
+ * Returns whether the time budget is used up or the computation should be stopped.
+ *
+ * Stopping ends the search like running out of time, so the result of the deepest completed search
+ * is kept.
+ *
+ * @return When the search should be stopped true, otherwise false.
+ */
+bool AsynchronousArtificialIntelligence::isTimeBudgetUsedUp() const
+{
+	return this->currentJob <= this->lastStoppedJob || ArtificialIntelligence::isTimeBudgetUsedUp();
 }
 
 }
@@ -2,10 +2,14 @@
 #define GAMELOGIC_FOUR_IN_A_LINE_ASYNCHRONOUSARTIFICIALINTELLIGENCE_HPP
 
 #include "ArtificialIntelligence.hpp"
+#include "SearchWorker.hpp"
 
 #include <atomic>
 #include <future>
+#include <mutex>
 #include <chrono>
+#include <memory>
+#include <functional>
 
 namespace GameLogic
 {
@@ -30,12 +34,40 @@ namespace FourInALine
  * result will be INVALID_RESULT. Use isNextMoveValid() to check whether the next move is valid or
  * INVALID_RESULT.
  *
+ * When all moves are scored (see ArtificialIntelligence::setScoreAllMoves()), the scores can be
+ * retrieved with getMoveScores() after the result was retrieved, until the next computation is
+ * started.
+ *
+ * The iteration callback (see ArtificialIntelligence::setIterationCallback()) is not called for
+ * cancelled computations: once cancelComputation() has returned, the callback of an earlier
+ * computation is neither running nor called anymore. Together with a high search depth this can be
+ * used to analyse the current position until it changes, restarting the analysis is cheap because
+ * the running search stops at its next node.
+ *
+ * Instead of polling isNextMoveReady(), a callback can be set with setFinishedCallback(). It is
+ * called by the thread of the worker whenever a computation has finished (also when it was
+ * cancelled), e.g. to post an event to the GUI thread which then retrieves the result.
+ *
+ * When a time budget is set (see ArtificialIntelligence::setTimeBudget()), the search stops at the
+ * deadline and the result is the best move of the deepest completed iteration. Use
+ * stopComputation() to stop a search earlier without losing the result, this also works for
+ * searches limited by a node budget or reporting their iterations to a callback.
+ *
+ * The computations are executed as jobs by a SearchWorker, whose thread is kept running between the
+ * computations. By default all asynchronous artificial intelligences share the same worker (see
+ * SearchWorker::getSharedInstance()), so their computations are executed one after another. Only
+ * the board and the current player are copied into a job, not the whole game. Every computation
+ * is a job with its own number, cancelling or stopping a computation only affects the jobs started
+ * until then, so a new computation can be started right after the last one was cancelled.
+ *
  * This class is reentrant but not thread-safe.
  */
 class AsynchronousArtificialIntelligence : public ArtificialIntelligence
 {
 	public:
 		AsynchronousArtificialIntelligence(unsigned int searchDepth);
+		AsynchronousArtificialIntelligence(unsigned int searchDepth,
+		                                   std::shared_ptr<SearchWorker> worker);
 		virtual ~AsynchronousArtificialIntelligence();
 
 		void computeNextMoveAsynchronously(const Game& game);
@@ -45,6 +77,11 @@ class AsynchronousArtificialIntelligence : public ArtificialIntelligence
 		unsigned int getNextMove(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
 		void cancelComputation();
+		void stopComputation();
+
+		std::shared_ptr<SearchWorker> getWorker() const;
+
+		void setFinishedCallback(std::function<void()> finishedCallback);
 
 		/**
 		 * Invalid result returned when the next move is not yet ready or the computation was
@@ -53,24 +90,60 @@ class AsynchronousArtificialIntelligence : public ArtificialIntelligence
 		static const unsigned int INVALID_RESULT;
 
 	private:
-		virtual unsigned int computeNextMove(const Game& game) const override;
-		virtual ScoredMovesType minimax(Node node, const Board& board, PlayerType player,
-		                                unsigned int depth, ScoreType alpha, ScoreType beta) const override;
+		using ArtificialIntelligence::computeNextMove;
+
+		unsigned int computeJob(Board& board, PlayerType player, unsigned int job) const;
+		virtual bool isTimeBudgetUsedUp() const override;
+		virtual void checkSearchStop() const override;
+		virtual void callIterationCallback(const IterationResult& result) const override;
+
+		/**
+		 * Worker executing the computations.
+		 */
+		std::shared_ptr<SearchWorker> worker;
+
+		/**
+		 * Number of the last started job, the jobs are numbered starting with 1.
+		 */
+		std::atomic<unsigned int> lastJob;
 
 		/**
-		 * Whether the computation should be cancelled or not.
+		 * Number of the last cancelled job, all jobs up to this number are cancelled.
 		 */
-		std::atomic<bool> cancel;
+		std::atomic<unsigned int> lastCancelledJob;
 
 		/**
-		 * Whether a computation is running or not.
+		 * Number of the last stopped job, all jobs up to this number are stopped, keeping the
+		 * result of the deepest completed search.
+		 */
+		std::atomic<unsigned int> lastStoppedJob;
+
+		/**
+		 * Number of the last finished job.
+		 *
+		 * Mutable so that computeJob() can stay const.
+		 */
+		mutable std::atomic<unsigned int> lastFinishedJob;
+
+		/**
+		 * Number of the job which is executed by the worker at the moment.
 		 *
-		 * Mutable so that the minimax() method can stay const.
+		 * Mutable so that computeJob() can stay const.
+		 */
+		mutable std::atomic<unsigned int> currentJob;
+
+		/**
+		 * Held while the iteration callback is called and while a computation is cancelled.
+		 */
+		mutable std::mutex iterationCallbackMutex;
+
+		/**
+		 * Called by the thread of the worker when a computation has finished.
 		 */
-		mutable std::atomic<bool> running;
+		std::function<void()> finishedCallback;
 
 		/**
-		 * Future used to compute the next task.
+		 * Future used to retrieve the result of the last job.
 		 */
 		std::future<unsigned int> nextMoveTask;
 
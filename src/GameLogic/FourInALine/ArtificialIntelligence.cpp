@@ -8,179 +8,1739 @@
 #include <algorithm>
 #include <memory>
 #include <limits>
+#include <thread>
+#include <future>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <cmath>
 
 namespace GameLogic
 {
 namespace FourInALine
 {
 
+const std::size_t ArtificialIntelligence::DEFAULT_TRANSPOSITION_TABLE_SIZE = 1 << 20;
+const ArtificialIntelligence::ScoreType ArtificialIntelligence::DEFAULT_MOVE_SCORE_WINDOW = 100;
+const ArtificialIntelligence::EvaluationWeights ArtificialIntelligence::DEFAULT_EVALUATION_WEIGHTS = { 1, 10, 100 };
+const unsigned long long ArtificialIntelligence::DEFAULT_NUMBER_OF_PLAYOUTS = 10000;
+
+/**
+ * Score of a move of the Monte Carlo tree search which always wins, a move which always loses gets
+ * the negative score.
+ */
+static const ArtificialIntelligence::ScoreType MONTE_CARLO_WIN_SCORE = 1000;
+
+/**
+ * Thrown when the time budget or the node budget is used up during a search.
+ */
+class SearchTimeoutException : public std::runtime_error
+{
+	public:
+		/**
+		 * Creates a new search timeout exception with the given message.
+		 *
+		 * @param message Message.
+		 */
+		SearchTimeoutException(const std::string& message)
+		    : std::runtime_error(message)
+		{
+		}
+};
+
+/**
+ * Create a new artificial intelligence using the given search depth.
+ *
+ * @param searchDepth The search depth to use.
+ */
+ArtificialIntelligence::ArtificialIntelligence(unsigned int searchDepth)
+    : searchDepth(searchDepth),
+      transpositionTable(ArtificialIntelligence::DEFAULT_TRANSPOSITION_TABLE_SIZE),
+      keepTranspositionTable(false), timeBudget(0), isStoppable(false), nodeBudget(0),
+      nodeLimit(std::numeric_limits<unsigned long long>::max()), completedSearchDepth(0),
+      moveOrdering(std::make_shared<MoveOrdering>()), currentSearchDepth(0), statistics(),
+      statisticsLogged(false), nThreads(1), master(nullptr), perfectPlay(false), scoreAllMoves(false),
+      moveScoreWindow(ArtificialIntelligence::DEFAULT_MOVE_SCORE_WINDOW),
+      evaluationWeights(ArtificialIntelligence::DEFAULT_EVALUATION_WEIGHTS),
+      searchAlgorithm(SearchAlgorithm::ALPHA_BETA)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+ArtificialIntelligence::~ArtificialIntelligence()
+{
+
+}
+
+/**
+ * Sets the search depth to the given search depth.
+ *
+ * @param searchDepth The new search depth.
+ */
+void ArtificialIntelligence::setSearchDepth(unsigned int searchDepth)
+{
+	this->searchDepth = searchDepth;
+}
+
+/**
+ * Returns the search depth.
+ *
+ * @return Search depth.
+ */
+unsigned int ArtificialIntelligence::getSearchDepth() const
+{
+	return this->searchDepth;
+}
+
+/**
+ * Sets the number of entries of the transposition table and clears it.
+ *
+ * @param nEntries Number of entries, rounded down to a power of 2. 0 disables the table.
+ */
+void ArtificialIntelligence::setTranspositionTableSize(std::size_t nEntries)
+{
+	this->transpositionTable.resize(nEntries);
+
+	for (auto& helper : this->helpers)
+	{
+		helper->setTranspositionTableSize(nEntries);
+	}
+}
+
+/**
+ * Returns the number of entries of the transposition table.
+ *
+ * @return Number of entries.
+ */
+std::size_t ArtificialIntelligence::getTranspositionTableSize() const
+{
+	return this->transpositionTable.getSize();
+}
+
+/**
+ * Sets whether the transposition table is kept between computations.
+ *
+ * Keeping the table speeds up the computation of the following moves of a game, because a part of
+ * the positions was already searched.
+ *
+ * @param keepTranspositionTable When the table should be kept true, when it should be cleared
+ *        before every computation false.
+ */
+void ArtificialIntelligence::setKeepTranspositionTable(bool keepTranspositionTable)
+{
+	this->keepTranspositionTable = keepTranspositionTable;
+}
+
+/**
+ * Returns whether the transposition table is kept between computations.
+ *
+ * @return When the table is kept true, otherwise false.
+ */
+bool ArtificialIntelligence::isTranspositionTableKept() const
+{
+	return this->keepTranspositionTable;
+}
+
+/**
+ * Removes all entries from the transposition table (and the tables of the other threads and of the
+ * solver).
+ */
+void ArtificialIntelligence::clearTranspositionTable()
+{
+	this->transpositionTable.clear();
+	this->solver.clearTranspositionTable();
+
+	for (auto& helper : this->helpers)
+	{
+		helper->clearTranspositionTable();
+	}
+}
+
+/**
+ * Sets the time budget for the computation of a move.
+ *
+ * With a time budget, the search is done with iterative deepening until the budget is used up or
+ * the search depth is reached. A time budget of 0 disables iterative deepening, the search always
+ * uses the full search depth.
+ *
+ * @param timeBudget The time budget.
+ */
+void ArtificialIntelligence::setTimeBudget(std::chrono::milliseconds timeBudget)
+{
+	this->timeBudget = timeBudget;
+}
+
+/**
+ * Returns the time budget for the computation of a move.
+ *
+ * @return Time budget, 0 when there is no time budget.
+ */
+std::chrono::milliseconds ArtificialIntelligence::getTimeBudget() const
+{
+	return this->timeBudget;
+}
+
+/**
+ * Returns whether there is a time budget for the computation of a move.
+ *
+ * @return When there is a time budget true, otherwise false.
+ */
+bool ArtificialIntelligence::hasTimeBudget() const
+{
+	return this->timeBudget.count() > 0;
+}
+
+/**
+ * Sets the node budget for the computation of a move.
+ *
+ * With a node budget, the search is done with iterative deepening until the budget is used up or
+ * the search depth is reached, like with a time budget. The search with a depth of 1 is always
+ * completed, so a computation can visit more nodes than a very small budget. A node budget of 0
+ * disables the limit.
+ *
+ * @param nodeBudget Maximum number of nodes visited by a computation.
+ */
+void ArtificialIntelligence::setNodeBudget(unsigned long long nodeBudget)
+{
+	this->nodeBudget = nodeBudget;
+}
+
+/**
+ * Returns the node budget for the computation of a move.
+ *
+ * @return Node budget, 0 when there is no node budget.
+ */
+unsigned long long ArtificialIntelligence::getNodeBudget() const
+{
+	return this->nodeBudget;
+}
+
+/**
+ * Returns whether there is a node budget for the computation of a move.
+ *
+ * @return When there is a node budget true, otherwise false.
+ */
+bool ArtificialIntelligence::hasNodeBudget() const
+{
+	return this->nodeBudget > 0;
+}
+
+/**
+ * Returns the search depth of the last completed search.
+ *
+ * Without a time budget this is the search depth, otherwise it is the depth of the deepest
+ * iteration that was completed within the time budget.
+ *
+ * @return Search depth of the last completed search.
+ */
+unsigned int ArtificialIntelligence::getCompletedSearchDepth() const
+{
+	return this->completedSearchDepth;
+}
+
+/**
+ * Sets the move ordering used to decide in which order moves are searched.
+ *
+ * @param moveOrdering The move ordering.
+ */
+void ArtificialIntelligence::setMoveOrdering(std::shared_ptr<MoveOrdering> moveOrdering)
+{
+	if (!moveOrdering)
+	{
+		throw std::invalid_argument("The move ordering must not be null.");
+	}
+
+	this->moveOrdering = moveOrdering;
+}
+
+/**
+ * Returns the move ordering used to decide in which order moves are searched.
+ *
+ * The returned move ordering can be used to enable or disable heuristics.
+ *
+ * @return The move ordering.
+ */
+std::shared_ptr<MoveOrdering> ArtificialIntelligence::getMoveOrdering() const
+{
+	return this->moveOrdering;
+}
+
+/**
+ * Returns the number of nodes visited by the last computation.
+ *
+ * Nodes whose score was found in the transposition table are not counted.
+ *
+ * @return Number of visited nodes.
+ */
+unsigned long long ArtificialIntelligence::getNumberOfNodes() const
+{
+	return this->statistics.nNodes;
+}
+
+/**
+ * Returns the statistics of the last computation.
+ *
+ * @return Statistics of the last computation.
+ */
+const ArtificialIntelligence::SearchStatistics& ArtificialIntelligence::getSearchStatistics() const
+{
+	return this->statistics;
+}
+
+/**
+ * Sets whether the statistics are written to the debug output after every computation.
+ *
+ * @param statisticsLogged When the statistics should be logged true, otherwise false.
+ */
+void ArtificialIntelligence::setStatisticsLogged(bool statisticsLogged)
+{
+	this->statisticsLogged = statisticsLogged;
+}
+
+/**
+ * Returns whether the statistics are written to the debug output after every computation.
+ *
+ * @return When the statistics are logged true, otherwise false.
+ */
+bool ArtificialIntelligence::isStatisticsLogged() const
+{
+	return this->statisticsLogged;
+}
+
+/**
+ * Returns the number of visited nodes per second.
+ *
+ * @return Nodes per second, 0 when no time was measured.
+ */
+double ArtificialIntelligence::SearchStatistics::getNodesPerSecond() const
+{
+	if (this->elapsedTime.count() <= 0)
+	{
+		return 0.0;
+	}
+
+	return this->nNodes * 1000000.0 / this->elapsedTime.count();
+}
+
+/**
+ * Returns the statistics as one line of key=value pairs, e.g. for logs.
+ *
+ * @return The statistics, e.g. "depth=6 nodes=2213 cutoffs=512 evaluations=1490 ttProbes=2100
+ *         ttHits=310 scratchBytes=296 timeUs=1200 nps=1844166".
+ */
+std::string ArtificialIntelligence::SearchStatistics::toString() const
+{
+	std::ostringstream stream;
+
+	stream << "depth=" << this->depth << " nodes=" << this->nNodes << " cutoffs=" << this->nBetaCutoffs
+	       << " evaluations=" << this->nEvaluations << " ttProbes=" << this->nTranspositionTableProbes
+	       << " ttHits=" << this->nTranspositionTableHits << " scratchBytes=" << this->scratchSize
+	       << " timeUs=" << this->elapsedTime.count()
+	       << " nps=" << static_cast<unsigned long long>(this->getNodesPerSecond());
+
+	return stream.str();
+}
+
+/**
+ * Sets the number of threads used by the search.
+ *
+ * The moves of the root node are split among the threads, so more threads than columns are not
+ * used. Every thread has its own transposition table with the size set by
+ * setTranspositionTableSize(). With a node budget, the search always uses one thread.
+ *
+ * @param nThreads Number of threads, 0 uses one thread per processor core.
+ */
+void ArtificialIntelligence::setNumberOfThreads(unsigned int nThreads)
+{
+	if (nThreads == 0)
+	{
+		nThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	this->nThreads = nThreads;
+}
+
+/**
+ * Returns the number of threads used by the search.
+ *
+ * @return Number of threads.
+ */
+unsigned int ArtificialIntelligence::getNumberOfThreads() const
+{
+	return this->nThreads;
+}
+
+/**
+ * Sets the opening book which is used before searching.
+ *
+ * The book is only used when its moves were computed with at least the search depth of the
+ * artificial intelligence, otherwise the artificial intelligence would play differently in the
+ * opening. The book can be shared by several artificial intelligences.
+ *
+ * @param openingBook The opening book or nullptr to use no opening book.
+ */
+void ArtificialIntelligence::setOpeningBook(std::shared_ptr<const OpeningBook> openingBook)
+{
+	this->openingBook = openingBook;
+}
+
+/**
+ * Returns the opening book which is used before searching.
+ *
+ * @return The opening book or nullptr when there is none.
+ */
+std::shared_ptr<const OpeningBook> ArtificialIntelligence::getOpeningBook() const
+{
+	return this->openingBook;
+}
+
+/**
+ * Sets the tablebase which is used before searching.
+ *
+ * The tablebase is only used for boards of its size. It can be shared by several artificial
+ * intelligences.
+ *
+ * @param tablebase The tablebase or nullptr to use no tablebase.
+ */
+void ArtificialIntelligence::setTablebase(std::shared_ptr<const Tablebase> tablebase)
+{
+	this->tablebase = tablebase;
+}
+
+/**
+ * Returns the tablebase which is used before searching.
+ *
+ * @return The tablebase or nullptr when there is none.
+ */
+std::shared_ptr<const Tablebase> ArtificialIntelligence::getTablebase() const
+{
+	return this->tablebase;
+}
+
+/**
+ * Sets whether the artificial intelligence plays perfectly on boards supported by the solver.
+ *
+ * Solving a board near the beginning of the game can take minutes on bigger boards like 7x6, so a
+ * time budget should be set as well.
+ *
+ * @param perfectPlay When the moves should be computed by the solver true, otherwise false.
+ * @see Solver::isSupported()
+ */
+void ArtificialIntelligence::setPerfectPlay(bool perfectPlay)
+{
+	this->perfectPlay = perfectPlay;
+}
+
+/**
+ * Returns whether the artificial intelligence plays perfectly on boards supported by the solver.
+ *
+ * @return When the moves are computed by the solver true, otherwise false.
+ */
+bool ArtificialIntelligence::isPerfectPlay() const
+{
+	return this->perfectPlay;
+}
+
+/**
+ * Sets whether every computation scores all moves of the root node.
+ *
+ * The scores can be retrieved with getMoveScores() after the computation. Moves are then never
+ * taken from the opening book, because it does not contain scores.
+ *
+ * @param scoreAllMoves When all moves should be scored true, when only the best move should be
+ *        found false.
+ */
+void ArtificialIntelligence::setScoreAllMoves(bool scoreAllMoves)
+{
+	this->scoreAllMoves = scoreAllMoves;
+}
+
+/**
+ * Returns whether every computation scores all moves of the root node.
+ *
+ * @return When all moves are scored true, otherwise false.
+ */
+bool ArtificialIntelligence::isScoringAllMoves() const
+{
+	return this->scoreAllMoves;
+}
+
+/**
+ * Sets the distance to the best score below which the scores of the moves are only upper bounds.
+ *
+ * A root move is searched with a window whose lower bound is the best score found so far minus the
+ * move score window. The bigger the window, the more moves get exact scores and the longer the
+ * search takes. With std::numeric_limits<ScoreType>::max() all scores are exact.
+ *
+ * @param moveScoreWindow The move score window, at least 0.
+ */
+void ArtificialIntelligence::setMoveScoreWindow(ArtificialIntelligence::ScoreType moveScoreWindow)
+{
+	if (moveScoreWindow < 0)
+	{
+		throw std::invalid_argument("The move score window must not be negative.");
+	}
+
+	this->moveScoreWindow = moveScoreWindow;
+}
+
+/**
+ * Sets the weights of the evaluation, e.g. to compare different weights in a Tournament.
+ *
+ * The scores stored in the transposition table were computed with the old weights, so the table is
+ * cleared.
+ *
+ * @param evaluationWeights The weights, from 0 to 1000000 each.
+ */
+void ArtificialIntelligence::setEvaluationWeights(const ArtificialIntelligence::EvaluationWeights& evaluationWeights)
+{
+	for (ScoreType weight : { evaluationWeights.oneToken, evaluationWeights.twoTokens,
+	                          evaluationWeights.threeTokens })
+	{
+		if (weight < 0 || weight > 1000000)
+		{
+			throw std::invalid_argument("The evaluation weights must be from 0 to 1000000.");
+		}
+	}
+
+	this->evaluationWeights = evaluationWeights;
+	this->clearTranspositionTable();
+}
+
+/**
+ * Returns the weights of the evaluation.
+ *
+ * @return The weights of the evaluation.
+ */
+const ArtificialIntelligence::EvaluationWeights& ArtificialIntelligence::getEvaluationWeights() const
+{
+	return this->evaluationWeights;
+}
+
+/**
+ * Returns the distance to the best score below which the scores of the moves are only upper
+ * bounds.
+ *
+ * @return The move score window.
+ */
+ArtificialIntelligence::ScoreType ArtificialIntelligence::getMoveScoreWindow() const
+{
+	return this->moveScoreWindow;
+}
+
+/**
+ * Returns the scores of the moves of the root node computed by the last computation.
+ *
+ * Empty when the last computation did not score all moves (see setScoreAllMoves()).
+ *
+ * @return The scores of all possible moves, sorted from the best to the worst move. Of several
+ *         moves with the same score, the first one in the static ordering comes first.
+ */
+const std::vector<ArtificialIntelligence::MoveScore>& ArtificialIntelligence::getMoveScores() const
+{
+	return this->moveScores;
+}
+
+/**
+ * Sets the algorithm used to search the board.
+ *
+ * The tablebase, the solver and the opening book are tried first with every algorithm.
+ *
+ * @param searchAlgorithm The search algorithm.
+ */
+void ArtificialIntelligence::setSearchAlgorithm(ArtificialIntelligence::SearchAlgorithm searchAlgorithm)
+{
+	this->searchAlgorithm = searchAlgorithm;
+}
+
+/**
+ * Returns the algorithm used to search the board.
+ *
+ * @return The search algorithm.
+ */
+ArtificialIntelligence::SearchAlgorithm ArtificialIntelligence::getSearchAlgorithm() const
+{
+	return this->searchAlgorithm;
+}
+
+/**
+ * Sets the function which is called after every completed search depth.
+ *
+ * With a callback, the moves are always searched with iterative deepening, without a time budget
+ * up to the search depth. A high search depth together with a computation which is stopped from
+ * another thread (see AsynchronousArtificialIntelligence) analyses a position until it is stopped.
+ * The callback is also called once when the move is taken from the tablebase, the solver or the
+ * opening book. It is called by the thread computing the move.
+ *
+ * @param iterationCallback Function called with the result of every completed search depth, or
+ *        an empty function.
+ */
+void ArtificialIntelligence::setIterationCallback(ArtificialIntelligence::IterationCallbackType iterationCallback)
+{
+	this->iterationCallback = iterationCallback;
+}
+
+/**
+ * Computes the next best move for the given game.
+ *
+ * When the tablebase contains the position, its move is returned without searching. With perfect
+ * play the board is solved next, if the solver supports it. When the opening book contains the
+ * position, its move is returned without searching.
+ *
+ * When there is a time budget or an iteration callback, the board is searched with increasing
+ * search depths until the time budget is used up or the search depth is reached and the best move
+ * of the deepest completed search is returned.
+ *
+ * When all moves are scored (see setScoreAllMoves()), the scores of the deepest completed search
+ * are stored and can be retrieved with getMoveScores().
+ *
+ * @param game The game to evaluate.
+ * @return Column index.
+ */
+unsigned int ArtificialIntelligence::computeNextMove(const Game& game) const
+{
+	Board board(*game.getBoard());
+
+	return this->computeNextMove(board, game.getCurrentPlayer(), this->scoreAllMoves);
+}
+
+/**
+ * Computes the scores of all moves of the current player of the given game.
+ *
+ * The moves are scored like by computeNextMove() with setScoreAllMoves() enabled, i.e. with the
+ * search depth, time budget, tablebase and perfect play of this artificial intelligence.
+ *
+ * @param game The game, it must not be over.
+ * @return The scores of all possible moves, the best move first (see getMoveScores()).
+ */
+std::vector<ArtificialIntelligence::MoveScore>
+ArtificialIntelligence::computeMoveScores(const Game& game) const
+{
+	Board board(*game.getBoard());
+
+	this->computeNextMove(board, game.getCurrentPlayer(), true);
+
+	return this->moveScores;
+}
+
+/**
+ * Computes the next best move of the given player on the given board and fills in the statistics.
+ *
+ * @param board The board to search, it is used by the search and unchanged when this method
+ *        returns.
+ * @param player The player who makes the next move.
+ * @param scoreAllMoves Whether all moves of the board are scored, see getMoveScores().
+ * @return Column index.
+ * @see ArtificialIntelligence::computeNextMove(const Game&)
+ */
+unsigned int ArtificialIntelligence::computeNextMove(Board& board,
+                                                     ArtificialIntelligence::PlayerType player,
+                                                     bool scoreAllMoves) const
+{
+	auto startTime = std::chrono::steady_clock::now();
+
+	this->statistics = SearchStatistics();
+
+	// The scratch memory of the previous computation is freed in one step.
+
+	this->searchArena.reset();
+
+	for (auto& helper : this->helpers)
+	{
+		helper->searchArena.reset();
+	}
+
+	unsigned int move = this->findNextMove(board, player, scoreAllMoves);
+
+	this->statistics.depth = this->completedSearchDepth;
+	this->statistics.scratchSize += this->computeScratchSize();
+	this->statistics.elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(
+	                                   std::chrono::steady_clock::now() - startTime);
+
+	if (this->statisticsLogged)
+	{
+		qDebug() << "[" << this << "::computeNextMove ]" << this->statistics.toString().c_str();
+	}
+
+	return move;
+}
+
+/**
+ * Finds the next best move of the given player on the given board.
+ *
+ * Tries the tablebase, the solver and the opening book before searching the board.
+ *
+ * @param board The board to search, it is used by the search and unchanged when this method
+ *        returns.
+ * @param player The player who makes the next move.
+ * @param scoreAllMoves Whether all moves of the board are scored, see getMoveScores().
+ * @return Column index.
+ */
+unsigned int ArtificialIntelligence::findNextMove(Board& board, ArtificialIntelligence::PlayerType player,
+                                                  bool scoreAllMoves) const
+{
+	ScoredMoveType bestMove;
+	unsigned int bookMove;
+	unsigned int tablebaseMove;
+	std::vector<Tablebase::ScoreType> tablebaseScores;
+	std::vector<MoveScore> iterationScores;
+	std::vector<MoveScore>* searchScores = scoreAllMoves ? &iterationScores : nullptr;
+	auto startTime = std::chrono::steady_clock::now();
+
+	this->isStoppable = false;
+	this->nodeLimit = std::numeric_limits<unsigned long long>::max();
+	this->moveScores.clear();
+
+	if (this->tablebase && scoreAllMoves && this->tablebase->scoreMoves(board, player, tablebaseScores))
+	{
+		tablebaseMove = this->storeExactMoveScores(board, tablebaseScores);
+		this->completedSearchDepth = this->countEmptyCells(board);
+		this->reportIteration(board, player, this->completedSearchDepth, tablebaseMove);
+
+		return tablebaseMove;
+	}
+
+	if (this->tablebase && !scoreAllMoves && this->tablebase->findBestMove(board, player, tablebaseMove))
+	{
+		this->completedSearchDepth = this->countEmptyCells(board);
+		this->reportIteration(board, player, this->completedSearchDepth, tablebaseMove);
+
+		return tablebaseMove;
+	}
+
+	if (this->perfectPlay)
+	{
+		// The solver gets half of the time budget and of the node budget, the rest is left for the
+		// heuristic search.
+
+		unsigned int solvedMove;
+		this->deadline = startTime + this->timeBudget / 2;
+
+		if (this->solveNextMove(board, player, scoreAllMoves, solvedMove))
+		{
+			this->reportIteration(board, player, this->completedSearchDepth, solvedMove);
+
+			return solvedMove;
+		}
+	}
+
+	if (this->openingBook && !scoreAllMoves && this->openingBook->getSearchDepth() >= this->searchDepth &&
+	    this->openingBook->lookup(board, player, bookMove))
+	{
+		this->completedSearchDepth = this->searchDepth;
+		this->reportIteration(board, player, this->completedSearchDepth, bookMove);
+
+		return bookMove;
+	}
+
+	if (this->searchAlgorithm == SearchAlgorithm::MONTE_CARLO_TREE_SEARCH)
+	{
+		return this->searchWithMonteCarloTreeSearch(board, player, scoreAllMoves, startTime);
+	}
+
+	this->prepareHelpers();
+
+	if (!this->keepTranspositionTable)
+	{
+		this->transpositionTable.clear();
+
+		for (auto& helper : this->helpers)
+		{
+			helper->transpositionTable.clear();
+		}
+	}
+
+	if (!this->hasTimeBudget() && !this->hasNodeBudget() && !this->iterationCallback)
+	{
+		this->prepareSearch(board, this->searchDepth);
+		bestMove = this->searchBestMove(board, player, this->searchDepth, searchScores);
+		this->completedSearchDepth = this->searchDepth;
+		this->moveScores.swap(iterationScores);
+
+		return bestMove.first;
+	}
+
+	// Searching deeper than the number of empty cells does not change the result.
+
+	unsigned int nEmptyCells = this->countEmptyCells(board);
+	unsigned int maximumDepth = std::max(1u, std::min(this->searchDepth, nEmptyCells));
+
+	this->prepareSearch(board, maximumDepth);
+	this->deadline = startTime + this->timeBudget;
+	this->completedSearchDepth = 0;
+
+	for (unsigned int depth = 1; depth <= maximumDepth; ++depth)
+	{
+		// The first iteration is always completed, so that there is a result, the next ones can be
+		// stopped. Without a budget the iterations only end when the search is stopped. The node
+		// budget includes the nodes of the previous iterations.
+
+		this->isStoppable = (depth > 1);
+		this->nodeLimit = (depth > 1 && this->hasNodeBudget()) ? this->nodeBudget :
+		                                                         std::numeric_limits<unsigned long long>::max();
+
+		try
+		{
+			bestMove = this->searchBestMove(board, player, depth, searchScores);
+			this->completedSearchDepth = depth;
+			this->moveScores.swap(iterationScores);
+		}
+		catch (SearchTimeoutException&)
+		{
+			break;
+		}
+
+		this->reportIteration(board, player, depth, bestMove.first);
+	}
+
+	this->isStoppable = false;
+	this->nodeLimit = std::numeric_limits<unsigned long long>::max();
+
+	return bestMove.first;
+}
+
+/**
+ * Computes the next best move of the given player on the given board with the solver.
+ *
+ * The solver is stopped like the search, when there is a time budget at the deadline, and when
+ * there is a node budget after half of the node budget.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @param scoreAllMoves Whether all moves are solved and stored as move scores.
+ * @param move Set to the column index of the best move when the board was solved.
+ * @return Whether the board was solved, false when the solver does not support it or the time
+ *         budget was used up.
+ */
+bool ArtificialIntelligence::solveNextMove(const Board& board, ArtificialIntelligence::PlayerType player,
+                                           bool scoreAllMoves, unsigned int& move) const
+{
+	unsigned int nEmptyCells = this->countEmptyCells(board);
+
+	if (!Solver::isSupported(board.getNumberOfColumns(), board.getNumberOfRows()) ||
+	    nEmptyCells == 0 || !board.findWinningCells().isEmpty())
+	{
+		return false;
+	}
+
+	unsigned long long nSolverNodes = this->solver.getNumberOfNodes();
+	bool isSolved = false;
+
+	unsigned long long nSolverNodeLimit = this->hasNodeBudget() ? nSolverNodes + this->nodeBudget / 2 :
+	                                                              std::numeric_limits<unsigned long long>::max();
+
+	this->solver.setStopFunction([this, nSolverNodeLimit]()
+	{
+		this->checkSearchStop();
+
+		if (this->solver.getNumberOfNodes() >= nSolverNodeLimit)
+		{
+			throw SearchTimeoutException("Node budget used up.");
+		}
+	});
+
+	// When the solver is stopped, the heuristic search is used.
+
+	this->isStoppable = true;
+
+	try
+	{
+		move = scoreAllMoves ? this->storeExactMoveScores(board, this->solver.scoreMoves(board, player)) :
+		                       this->solver.findBestMove(board, player);
+		this->completedSearchDepth = nEmptyCells;
+		isSolved = true;
+	}
+	catch (SearchTimeoutException&)
+	{
+	}
+	catch (...)
+	{
+		this->isStoppable = false;
+		throw;
+	}
+
+	this->isStoppable = false;
+	this->statistics.nNodes = this->solver.getNumberOfNodes() - nSolverNodes;
+
+	return isSolved;
+}
+
+/**
+ * Computes the next best move of the given player on the given board with the Monte Carlo tree
+ * search.
+ *
+ * The search uses the threads of this artificial intelligence. The node budget is the number of
+ * playouts, with only a time budget the playouts go on until the deadline, without budgets
+ * DEFAULT_NUMBER_OF_PLAYOUTS playouts are done. The score of a move is its win rate scaled from
+ * -MONTE_CARLO_WIN_SCORE (always lost) to MONTE_CARLO_WIN_SCORE (always won), the scores are
+ * estimates and sorted by the number of visits like the moves of the tree.
+ *
+ * @param board The board, it is unchanged when this method returns.
+ * @param player The player who makes the next move.
+ * @param scoreAllMoves Whether all moves are scored, see getMoveScores().
+ * @param startTime Start of the computation, the time budget is counted from here.
+ * @return Column index of the most visited move.
+ */
+unsigned int ArtificialIntelligence::searchWithMonteCarloTreeSearch(Board& board,
+                                                                    ArtificialIntelligence::PlayerType player,
+                                                                    bool scoreAllMoves,
+                                                                    std::chrono::steady_clock::time_point startTime) const
+{
+	unsigned long long nPlayouts = ArtificialIntelligence::DEFAULT_NUMBER_OF_PLAYOUTS;
+
+	if (this->hasNodeBudget())
+	{
+		nPlayouts = this->nodeBudget;
+	}
+	else if (this->hasTimeBudget())
+	{
+		nPlayouts = std::numeric_limits<unsigned long long>::max();
+	}
+
+	// The stop function is called by this thread, so the cancellation of subclasses still works.
+	// Running out of time or stopping ends the search, the best move found so far is returned.
+
+	this->monteCarloTreeSearch.setNumberOfThreads(this->hasNodeBudget() ? 1 : this->nThreads);
+	this->monteCarloTreeSearch.setStopFunction([this]()
+	{
+		try
+		{
+			this->checkSearchStop();
+		}
+		catch (SearchTimeoutException&)
+		{
+			return true;
+		}
+
+		return false;
+	});
+
+	this->deadline = startTime + this->timeBudget;
+	this->isStoppable = true;
+
+	unsigned int move;
+
+	try
+	{
+		move = this->monteCarloTreeSearch.findBestMove(board, player, nPlayouts);
+	}
+	catch (...)
+	{
+		this->isStoppable = false;
+		throw;
+	}
+
+	this->isStoppable = false;
+
+	std::vector<unsigned int> principalVariation = this->monteCarloTreeSearch.getPrincipalVariation();
+
+	this->statistics.nNodes = this->monteCarloTreeSearch.getNumberOfPlayouts();
+	this->statistics.scratchSize = this->monteCarloTreeSearch.getMemorySize();
+	this->completedSearchDepth = principalVariation.size();
+
+	if (scoreAllMoves)
+	{
+		for (const auto& moveStatistics : this->monteCarloTreeSearch.getMoveStatistics())
+		{
+			ScoreType score = static_cast<ScoreType>(std::lround(MONTE_CARLO_WIN_SCORE *
+			                                                     (2.0 * moveStatistics.winRate - 1.0)));
+
+			this->moveScores.push_back(MoveScore { moveStatistics.column, score,
+			                                       TranspositionTable::Bound::EXACT });
+		}
+	}
+
+	if (this->iterationCallback)
+	{
+		IterationResult result;
+
+		result.depth = this->completedSearchDepth;
+		result.moveScores = this->moveScores;
+		result.principalVariation = principalVariation;
+
+		this->callIterationCallback(result);
+	}
+
+	return move;
+}
+
+/**
+ * Stores the given exact scores as the move scores of the given board and returns the best move.
+ *
+ * Wins get the maximum score, losses the minimum score and draws 0. The moves are sorted by their
+ * exact scores, so a faster win comes before a slower one.
+ *
+ * @param board The board, it must contain possible moves.
+ * @param exactScores The exact score of every column (see Solver), Solver::INVALID_SCORE for full
+ *        columns.
+ * @return Column index of the move with the best exact score, the first one in the static ordering
+ *         when several moves have the best score.
+ */
+unsigned int ArtificialIntelligence::storeExactMoveScores(const Board& board,
+                                                          const std::vector<Solver::ScoreType>& exactScores) const
+{
+	AvailableColumns possibleMoves = board.getAvailableColumnsRange();
+	std::vector<unsigned int> moves;
+
+	moves.assign(possibleMoves.begin(), possibleMoves.end());
+	this->moveOrdering->orderStatically(board, moves);
+
+	std::stable_sort(moves.begin(), moves.end(), [&exactScores](unsigned int a, unsigned int b)
+	{
+		return exactScores[a] > exactScores[b];
+	});
+
+	this->moveScores.clear();
+
+	for (unsigned int move : moves)
+	{
+		ScoreType score = 0;
+
+		if (exactScores[move] > 0)
+		{
+			score = std::numeric_limits<ScoreType>::max();
+		}
+		else if (exactScores[move] < 0)
+		{
+			score = std::numeric_limits<ScoreType>::min();
+		}
+
+		this->moveScores.push_back(MoveScore { move, score, TranspositionTable::Bound::EXACT });
+	}
+
+	return moves.front();
+}
+
+/**
+ * Calls the iteration callback, if there is one, with the result of a completed search depth.
+ *
+ * @param board The searched board, it is unchanged when this method returns.
+ * @param player The player who makes the next move.
+ * @param depth The completed search depth.
+ * @param bestMove The best move found by the search.
+ */
+void ArtificialIntelligence::reportIteration(Board& board, ArtificialIntelligence::PlayerType player,
+                                             unsigned int depth, unsigned int bestMove) const
+{
+	if (!this->iterationCallback)
+	{
+		return;
+	}
+
+	IterationResult result;
+
+	result.depth = depth;
+	result.moveScores = this->moveScores;
+	result.principalVariation = this->findPrincipalVariation(board, player, bestMove, depth);
+
+	this->callIterationCallback(result);
+}
+
+/**
+ * Returns the principal variation starting with the given best move.
+ *
+ * The moves after the best move are the best moves stored in the transposition tables of this
+ * artificial intelligence and of its helpers. The variation ends when the game is over, when a
+ * position is not stored or when it has the maximum length.
+ *
+ * @param board The board, it is unchanged when this method returns.
+ * @param player The player who makes the next move.
+ * @param bestMove The best move of the player.
+ * @param maximumLength Maximum number of moves, at least 1.
+ * @return The best move followed by the expected moves.
+ */
+std::vector<ArtificialIntelligence::ColumnType>
+ArtificialIntelligence::findPrincipalVariation(Board& board, ArtificialIntelligence::PlayerType player,
+                                               unsigned int bestMove, unsigned int maximumLength) const
+{
+	std::vector<ColumnType> principalVariation;
+	unsigned int move = bestMove;
+	Node node = Node::MAX_NODE;
+
+	while (principalVariation.size() < maximumLength && move != MoveOrdering::NO_MOVE &&
+	       board.getColumnHeight(move) < board.getNumberOfRows() && board.findWinningCells().isEmpty())
+	{
+		principalVariation.push_back(move);
+		board.makeMove(move, player);
+
+		// The position after the move was stored for the other player and node type.
+
+		node = (node == Node::MAX_NODE) ? Node::MIN_NODE : Node::MAX_NODE;
+		player = this->getOtherPlayer(player);
+		move = this->findHashMove(board, node, player);
+
+		for (std::size_t i = 0; i < this->helpers.size() && move == MoveOrdering::NO_MOVE; ++i)
+		{
+			move = this->helpers[i]->findHashMove(board, node, player);
+		}
+	}
+
+	for (std::size_t i = 0; i < principalVariation.size(); ++i)
+	{
+		board.unmakeMove();
+	}
+
+	return principalVariation;
+}
+
+/**
+ * Calls the iteration callback with the given result.
+ *
+ * Subclasses can override this method, e.g. to suppress the results of cancelled computations.
+ *
+ * @param result The result of the completed search depth.
+ */
+void ArtificialIntelligence::callIterationCallback(const ArtificialIntelligence::IterationResult& result) const
+{
+	this->iterationCallback(result);
+}
+
+/**
+ * Returns the number of empty cells of the given board.
+ *
+ * @param board The board.
+ * @return Number of empty cells.
+ */
+unsigned int ArtificialIntelligence::countEmptyCells(const Board& board) const
+{
+	unsigned int nEmptyCells = board.getNumberOfColumns() * board.getNumberOfRows();
+
+	for (unsigned int x = 0; x < board.getNumberOfColumns(); ++x)
+	{
+		nEmptyCells -= board.getColumnHeight(x);
+	}
+
+	return nEmptyCells;
+}
+
+/**
+ * Computes the exact score of the given game for the current player.
+ *
+ * The computation is not limited by the time budget, but can be stopped by overriding
+ * checkSearchStop().
+ *
+ * @param game The game, it must not be over and its board must be supported by the solver.
+ * @return The exact score of the board, see Solver.
+ */
+Solver::ScoreType ArtificialIntelligence::computeExactScore(const Game& game) const
+{
+	this->solver.setStopFunction([this]() { this->checkSearchStop(); });
+
+	return this->solver.solve(*game.getBoard(), game.getCurrentPlayer());
+}
+
+/**
+ * Computes the exact scores of all moves of the current player of the given game.
+ *
+ * The computation is not limited by the time budget, but can be stopped by overriding
+ * checkSearchStop().
+ *
+ * @param game The game, it must not be over and its board must be supported by the solver.
+ * @return The exact score of every column from the point of view of the current player,
+ *         Solver::INVALID_SCORE for full columns.
+ */
+std::vector<Solver::ScoreType> ArtificialIntelligence::computeExactMoveScores(const Game& game) const
+{
+	this->solver.setStopFunction([this]() { this->checkSearchStop(); });
+
+	return this->solver.scoreMoves(*game.getBoard(), game.getCurrentPlayer());
+}
+
+/**
+ * Returns the possible moves of the current player of the given game, the most likely moves first.
+ *
+ * The current player is assumed to be the opponent of the artificial intelligence, e.g. right after
+ * the artificial intelligence made a move. The move which the last computation expected the
+ * opponent to make (the best move stored in the transposition table) comes first, the other moves
+ * follow in the static order of the move ordering.
+ *
+ * Must not be called while a move is computed, because the transposition table is used.
+ *
+ * @param game The game.
+ * @return The possible moves, the most likely move first. Empty when the game is over.
+ */
+std::vector<unsigned int> ArtificialIntelligence::predictMoves(const Game& game) const
+{
+	const Board& board = *game.getBoard();
+	std::vector<unsigned int> moves;
+
+	if (game.isOver())
+	{
+		return moves;
+	}
+
+	AvailableColumns possibleMoves = board.getAvailableColumnsRange();
+	moves.assign(possibleMoves.begin(), possibleMoves.end());
+
+	this->moveOrdering->orderStatically(board, moves);
+
+	// The position was searched as a minimizing node, because the opponent makes the next move.
+
+	unsigned int expectedMove = this->findHashMove(board, Node::MIN_NODE, game.getCurrentPlayer());
+
+	for (std::size_t i = 0; i < this->helpers.size() && expectedMove == MoveOrdering::NO_MOVE; ++i)
+	{
+		expectedMove = this->helpers[i]->findHashMove(board, Node::MIN_NODE, game.getCurrentPlayer());
+	}
+
+	auto it = std::find(moves.begin(), moves.end(), expectedMove);
+
+	if (it != moves.end())
+	{
+		std::rotate(moves.begin(), it, it + 1);
+	}
+
+	return moves;
+}
+
+/**
+ * Returns the other player.
+ *
+ * @param player The player.
+ * @return The other player.
+ */
+ArtificialIntelligence::PlayerType
+ArtificialIntelligence::getOtherPlayer(ArtificialIntelligence::PlayerType player) const
+{
+	return (player == Game::PLAYER_ONE) ? Game::PLAYER_TWO : Game::PLAYER_ONE;
+}
+
+/**
+ * Searches the given board with the given search depth and returns the best move.
+ *
+ * When the moves are scored, the root moves are searched by searchBestMoveInParallel() also with a
+ * single thread, because minimax() cuts off the root moves that can not become the best move.
+ *
+ * @param board The board to search, it is unchanged when this method returns.
+ * @param player The player who makes the next move.
+ * @param depth Search depth.
+ * @param moveScores When not nullptr, the scores of all moves are stored here (see getMoveScores()).
+ * @return The best move and its score.
+ */
+ArtificialIntelligence::ScoredMoveType
+ArtificialIntelligence::searchBestMove(Board& board, ArtificialIntelligence::PlayerType player,
+                                       unsigned int depth,
+                                       std::vector<ArtificialIntelligence::MoveScore>* moveScores) const
+{
+	ScoredMoveType bestMove;
+
+	this->currentSearchDepth = depth;
+
+	if ((!this->helpers.empty() || moveScores != nullptr) && depth > 0 &&
+	    !board.getAvailableColumnsRange().isEmpty() && board.findWinningCells().isEmpty())
+	{
+		return this->searchBestMoveInParallel(board, player, depth, moveScores);
+	}
+
+	if (!this->minimax(Node::MAX_NODE, board, player, depth, std::numeric_limits<ScoreType>::min(),
+	                   std::numeric_limits<ScoreType>::max(), bestMove))
+	{
+		throw std::runtime_error("Tried to find the best move on a board without possible moves.");
+	}
+
+	return bestMove;
+}
+
 /**
- * Create a new artificial intelligence using the given search depth.
+ * Searches the given board with the given search depth in several threads and returns the best
+ * move.
  *
- * @param searchDepth The search depth to use.
+ * The moves of the root node are sorted statically and every thread repeatedly takes the next move
+ * that was not yet searched. Every thread searches on its own copy of the board, this thread uses
+ * this artificial intelligence and the other threads use the helpers.
+ *
+ * A root move is searched with a window whose lower bound is the best score found so far. When the
+ * best move so far comes before the move in the static ordering, the move has to be better to
+ * replace it, otherwise an equal score is enough. Because a score is only exact when it is inside
+ * the window, only exact scores replace the best move and the result is the first move with the
+ * highest score in the static ordering, the same as the result of searchBestMove() with one thread.
+ *
+ * When the moves are scored (multi-PV), the lower bound of the window is at most the best score so
+ * far minus the move score window and winning moves do not cut off the other moves. A lower bound
+ * only makes more scores exact, so the best move is the same as without scoring the moves.
+ *
+ * When one of the threads throws an exception (e.g. because the search is stopped), the other
+ * threads stop taking moves and the exception is rethrown after all threads have finished.
+ *
+ * @param board The board to search, it must contain possible moves and no winner. It is unchanged
+ *        when this method returns.
+ * @param player The player who makes the next move.
+ * @param depth Search depth, at least 1.
+ * @param moveScores When not nullptr, the scores of all moves are stored here (see getMoveScores()).
+ * @return The best move and its score.
  */
-ArtificialIntelligence::ArtificialIntelligence(unsigned int searchDepth)
-    : searchDepth(searchDepth)
+ArtificialIntelligence::ScoredMoveType
+ArtificialIntelligence::searchBestMoveInParallel(Board& board,
+                                                 ArtificialIntelligence::PlayerType player,
+                                                 unsigned int depth,
+                                                 std::vector<ArtificialIntelligence::MoveScore>* moveScores) const
 {
+	AvailableColumns possibleMoves = board.getAvailableColumnsRange();
+	std::vector<unsigned int>& moves = this->moveBuffers[0];
+
+	this->countNode();
+
+	moves.assign(possibleMoves.begin(), possibleMoves.end());
+	this->moveOrdering->orderStatically(board, moves);
+
+	std::atomic<std::size_t> nextMove(0);
+	std::atomic<bool> isFailed(false);
+	std::mutex bestMoveMutex;
+	bool hasBestMove = false;
+	std::size_t bestMoveIndex = 0;
+	ScoreType bestScore = std::numeric_limits<ScoreType>::min();
+	std::size_t arenaSize = this->searchArena.getUsedSize();
+	MoveScore* scores = this->searchArena.allocateArray<MoveScore>(moves.size());
+
+	auto searchMoves = [&](const ArtificialIntelligence* ai, Board& workerBoard)
+	{
+		for (std::size_t i = nextMove++; i < moves.size() && !isFailed; i = nextMove++)
+		{
+			ScoreType alpha = std::numeric_limits<ScoreType>::min();
+
+			{
+				std::lock_guard<std::mutex> lock(bestMoveMutex);
+
+				if (hasBestMove && bestMoveIndex < i)
+				{
+					if (bestScore == std::numeric_limits<ScoreType>::max() && moveScores == nullptr)
+					{
+						// Winning can not be improved, the serial search is cut off here.
+
+						continue;
+					}
+
+					alpha = bestScore;
+				}
+				else if (hasBestMove && bestScore != std::numeric_limits<ScoreType>::min())
+				{
+					alpha = bestScore - 1;
+				}
+
+				if (hasBestMove && moveScores != nullptr)
+				{
+					// The moves close to the best move get exact scores. The window must not be
+					// empty, otherwise a score below it could also be a lower bound.
+
+					ScoreType lowestScore = std::numeric_limits<ScoreType>::min();
+					ScoreType highestScore = std::numeric_limits<ScoreType>::max();
+					ScoreType lowerBound = lowestScore;
+
+					if (this->moveScoreWindow != highestScore &&
+					    bestScore >= lowestScore + this->moveScoreWindow)
+					{
+						lowerBound = bestScore - this->moveScoreWindow;
+					}
+
+					alpha = std::min({ alpha, lowerBound, highestScore - 1 });
+				}
+			}
+
+			workerBoard.makeMove(moves[i], player);
+
+			ScoreType score = ai->computeScore(Node::MAX_NODE, workerBoard, player, depth, alpha,
+			                                   std::numeric_limits<ScoreType>::max());
+
+			workerBoard.unmakeMove();
+
+			std::lock_guard<std::mutex> lock(bestMoveMutex);
+
+			// Scores outside of the window are only upper bounds, the minimum score is always exact.
+
+			bool isUpperBound = (score <= alpha && score != std::numeric_limits<ScoreType>::min());
+
+			scores[i] = MoveScore { moves[i], score, isUpperBound ? TranspositionTable::Bound::UPPER :
+			                                                        TranspositionTable::Bound::EXACT };
+
+			if (!hasBestMove || score > bestScore || (score == bestScore && i < bestMoveIndex))
+			{
+				hasBestMove = true;
+				bestMoveIndex = i;
+				bestScore = score;
+			}
+		}
+	};
+
+	auto runSearch = [&](const ArtificialIntelligence* ai, Board& workerBoard)
+	{
+		try
+		{
+			searchMoves(ai, workerBoard);
+		}
+		catch (...)
+		{
+			isFailed = true;
+			throw;
+		}
+	};
+
+	// Not more threads than root moves. Every helper searches on its own board, which is kept
+	// between the searches, so it only has to be set to the searched position.
+
+	std::size_t nHelpers = std::min(this->helpers.size(), moves.size() - 1);
+	std::vector<std::future<void> > tasks;
+
+	for (std::size_t i = 0; i < nHelpers; ++i)
+	{
+		std::unique_ptr<Board>& helperBoard = this->helpers[i]->searchBoard;
+
+		if (helperBoard)
+		{
+			*helperBoard = board;
+		}
+		else
+		{
+			helperBoard.reset(new Board(board));
+		}
+	}
+
+	for (std::size_t i = 0; i < nHelpers; ++i)
+	{
+		const ArtificialIntelligence* helper = this->helpers[i].get();
+		Board& helperBoard = *helper->searchBoard;
+
+		helper->currentSearchDepth = depth;
+		tasks.push_back(std::async(std::launch::async, [&runSearch, helper, &helperBoard]()
+		{
+			runSearch(helper, helperBoard);
+		}));
+	}
+
+	std::exception_ptr exception;
+
+	try
+	{
+		runSearch(this, board);
+	}
+	catch (...)
+	{
+		exception = std::current_exception();
+	}
+
+	for (auto& task : tasks)
+	{
+		try
+		{
+			task.get();
+		}
+		catch (...)
+		{
+			if (!exception)
+			{
+				exception = std::current_exception();
+			}
+		}
+	}
+
+	for (auto& helper : this->helpers)
+	{
+		const SearchStatistics& helperStatistics = helper->statistics;
+
+		this->statistics.nNodes += helperStatistics.nNodes;
+		this->statistics.nBetaCutoffs += helperStatistics.nBetaCutoffs;
+		this->statistics.nEvaluations += helperStatistics.nEvaluations;
+		this->statistics.nTranspositionTableProbes += helperStatistics.nTranspositionTableProbes;
+		this->statistics.nTranspositionTableHits += helperStatistics.nTranspositionTableHits;
+		helper->statistics = SearchStatistics();
+	}
+
+	if (exception)
+	{
+		this->searchArena.rewind(arenaSize);
+		std::rethrow_exception(exception);
+	}
+
+	if (moveScores != nullptr)
+	{
+		// Insertion sort, it is stable, so moves with the same score stay in the static ordering,
+		// and it does not allocate memory.
+
+		auto isBetter = [](const MoveScore& a, const MoveScore& b)
+		{
+			return a.score > b.score || (a.score == b.score && a.bound == TranspositionTable::Bound::EXACT &&
+			                             b.bound != TranspositionTable::Bound::EXACT);
+		};
+
+		for (std::size_t i = 1; i < moves.size(); ++i)
+		{
+			MoveScore score = scores[i];
+			std::size_t j = i;
+
+			while (j > 0 && isBetter(score, scores[j - 1]))
+			{
+				scores[j] = scores[j - 1];
+				j--;
+			}
+
+			scores[j] = score;
+		}
 
+		moveScores->assign(scores, scores + moves.size());
+	}
+
+	this->searchArena.rewind(arenaSize);
+
+	return std::make_pair(moves[bestMoveIndex], bestScore);
 }
 
 /**
- * Frees all used resources.
+ * Creates or removes helpers, so that there is one helper for every thread except this one.
+ *
+ * With a node budget there are no helpers: which root moves a thread searches depends on the
+ * scheduling, so with several threads the visited nodes and the computed move would depend on the
+ * machine.
+ *
+ * New helpers use a transposition table of the same size as this artificial intelligence, all
+ * helpers use its evaluation weights.
  */
-ArtificialIntelligence::~ArtificialIntelligence()
+void ArtificialIntelligence::prepareHelpers() const
 {
+	std::size_t nHelpers = this->hasNodeBudget() ? 0 : this->nThreads - 1;
+
+	if (this->helpers.size() > nHelpers)
+	{
+		this->helpers.resize(nHelpers);
+	}
+
+	while (this->helpers.size() < nHelpers)
+	{
+		std::unique_ptr<ArtificialIntelligence> helper(new ArtificialIntelligence(this->searchDepth));
 
+		helper->setTranspositionTableSize(this->transpositionTable.getSize());
+		helper->master = this;
+		this->helpers.push_back(std::move(helper));
+	}
+
+	for (auto& helper : this->helpers)
+	{
+		helper->evaluationWeights = this->evaluationWeights;
+	}
 }
 
 /**
- * Sets the search depth to the given search depth.
+ * Prepares the move ordering and the move buffers for a search on the given board.
  *
- * @param searchDepth The new search depth.
+ * @param board The board that will be searched.
+ * @param maximumDepth Maximum search depth of the search.
  */
-void ArtificialIntelligence::setSearchDepth(unsigned int searchDepth)
+void ArtificialIntelligence::prepareSearch(const Board& board, unsigned int maximumDepth) const
 {
-	this->searchDepth = searchDepth;
+	this->moveOrdering->prepare(board, maximumDepth);
+
+	if (this->moveBuffers.size() < maximumDepth)
+	{
+		this->moveBuffers.resize(maximumDepth);
+	}
+
+	for (auto& moves : this->moveBuffers)
+	{
+		moves.reserve(board.getNumberOfColumns());
+	}
+
+	// Every helper gets its own copy of the move ordering, the move ordering is not thread-safe.
+
+	for (auto& helper : this->helpers)
+	{
+		helper->moveOrdering = this->moveOrdering->clone();
+		helper->prepareSearch(board, maximumDepth);
+	}
 }
 
 /**
- * Returns the search depth.
+ * Returns the peak scratch memory of the current computation of this artificial intelligence and
+ * its helpers: the used part of the search arenas and the move buffers.
  *
- * @return Search depth.
+ * @return Number of bytes.
  */
-unsigned int ArtificialIntelligence::getSearchDepth() const
+std::size_t ArtificialIntelligence::computeScratchSize() const
 {
-	return this->searchDepth;
+	std::size_t scratchSize = this->searchArena.getPeakSize();
+
+	for (const auto& moves : this->moveBuffers)
+	{
+		scratchSize += moves.capacity() * sizeof(unsigned int);
+	}
+
+	for (const auto& helper : this->helpers)
+	{
+		scratchSize += helper->computeScratchSize();
+	}
+
+	return scratchSize;
 }
 
 /**
- * Computes the next best move for the given game.
+ * Returns the best move stored in the transposition table for the given position.
  *
- * @param game The game to evaluate.
- * @return Column index.
+ * @param board The board.
+ * @param node Whether the node is minimizing or maximizing.
+ * @param player The player who makes the next move.
+ * @return Column of the best move or MoveOrdering::NO_MOVE.
  */
-unsigned int ArtificialIntelligence::computeNextMove(const Game& game) const
+unsigned int ArtificialIntelligence::findHashMove(const Board& board, ArtificialIntelligence::Node node,
+                                                  ArtificialIntelligence::PlayerType player) const
 {
-	ScoredMovesType scoredMoves;
-	ScoredMoveType bestMove;
-	std::shared_ptr<const Board> board = game.getBoard();
-	Board myBoard(*board);
-	unsigned int player = game.getCurrentPlayer();
+	TranspositionTable::Entry entry;
+
+	if (!this->transpositionTable.lookup(this->computePositionKey(board, node, player), entry) ||
+	    entry.bestMove == TranspositionTable::NO_MOVE)
+	{
+		return MoveOrdering::NO_MOVE;
+	}
 
-	scoredMoves = this->minimax(Node::MAX_NODE, myBoard, player, this->searchDepth,
-	                            std::numeric_limits<ScoreType>::min(),
-	                            std::numeric_limits<ScoreType>::max());
+	// The best move is stored for the canonical board.
 
-	bestMove = this->findBestMove(Node::MAX_NODE, scoredMoves);
+	if (board.isCanonicalHashKeyMirrored())
+	{
+		return board.getNumberOfColumns() - 1 - entry.bestMove;
+	}
 
-	return bestMove.first;
+	return entry.bestMove;
 }
 
 /**
- * Returns the other player.
+ * Returns whether the time budget of the current search is used up.
  *
- * @param player The player.
- * @return The other player.
+ * The search is stopped when this returns true and there is a result to fall back to, e.g. from
+ * the second iteration of iterative deepening on. Subclasses can override this method to stop the
+ * search for other reasons, the result of the deepest completed search is then still used.
+ *
+ * @return When the search should be stopped true, otherwise false.
  */
-ArtificialIntelligence::PlayerType
-ArtificialIntelligence::getOtherPlayer(ArtificialIntelligence::PlayerType player) const
+bool ArtificialIntelligence::isTimeBudgetUsedUp() const
 {
-	return (player == Game::PLAYER_ONE) ? Game::PLAYER_TWO : Game::PLAYER_ONE;
+	return this->hasTimeBudget() && std::chrono::steady_clock::now() >= this->deadline;
 }
 
 /**
- * Finds and returns the best move in the given set of moves.
- *
- * For minimizing nodes this method returns the move with the lowest score, for maximizing nodes
- * the move with the highest score is returned.
+ * Throws an exception when the current search has to be stopped.
  *
- * @param node Whether to look for the move with the minimum score (Node::MIN_NODE) or the maximum
- *        score (Node::MAX_NODE).
- * @param scoredMoves List of moves.
- * @return The scored move with the maximum/minimum (see node) score.
+ * Called by every node of the search. By default the search is stopped when it can be stopped and
+ * the time budget is used up. Helpers call this method of their master, so overriding it also stops
+ * the searches in the other threads.
  */
-ArtificialIntelligence::ScoredMoveType
-ArtificialIntelligence::findBestMove(ArtificialIntelligence::Node node,
-                                     const ArtificialIntelligence::ScoredMovesType& scoredMoves) const
+void ArtificialIntelligence::checkSearchStop() const
 {
-	ScoredMoveType result;
-
-	auto compareMoves = [](const ScoredMoveType& move1, const ScoredMoveType& move2)
-	{
-		return move1.second < move2.second;
-	};
-
-	if (scoredMoves.empty())
+	if (this->isStoppable && this->isTimeBudgetUsedUp())
 	{
-		throw std::runtime_error("Tried to find the best move in an empty list of moves.");
+		throw SearchTimeoutException("Time budget used up.");
 	}
+}
 
-	if (node == Node::MIN_NODE)
-	{
-		result = *std::min_element(scoredMoves.cbegin(), scoredMoves.cend(), compareMoves);
-	}
-	else
+/**
+ * Counts a visited node and throws an exception when the current search has to be stopped.
+ *
+ * Calls checkSearchStop() (of the master when this is a helper) and stops the search when the
+ * node limit of this artificial intelligence is reached.
+ */
+void ArtificialIntelligence::countNode() const
+{
+	((this->master != nullptr) ? this->master : this)->checkSearchStop();
+
+	if (this->statistics.nNodes >= this->nodeLimit)
 	{
-		result = *std::max_element(scoredMoves.cbegin(), scoredMoves.cend(), compareMoves);
+		throw SearchTimeoutException("Node budget used up.");
 	}
 
-	return result;
+	this->statistics.nNodes++;
 }
 
 /**
- * Returns a list of scored moves.
+ * Searches the moves of the given board and finds the best move.
  *
  * This method is implementing the minimax-algorithm.
  *
  * First it will create a list of possible moves on the given board. If the remaining search depth
  * is greater than 0 and there are possible moves, it will iterate over the moves and execute and
- * score them using computeScore(). The result is saved in a list which is returned at the end.
+ * score them using computeScore(). The best move is tracked while the moves are scored: for
+ * minimizing nodes it is the move with the lowest score, for maximizing nodes the move with the
+ * highest score. When several moves have the same score, the first one of them is used.
+ *
+ * The moves are searched in the order decided by the move ordering, at the root node only the
+ * static ordering is used. Moves which cause a cutoff are reported to the move ordering.
+ *
+ * The moves are made on the given board and undone after they were scored, so the board is
+ * unchanged when this method returns.
  *
  * Each time a move is scored, it is checked whether the branch can be pruned using
  * alpha-beta-pruning.
  *
+ * Every node calls countNode(), which stops the search by throwing an exception, e.g. when the
+ * time budget or the node budget is used up.
+ *
  * @param node Whether this node is minimizing or maximizing.
  * @param board The board to evaluate.
  * @param player The current player (who made the last move on the board).
  * @param depth Remaining search depth.
  * @param alpha Maximum score the maximizing player is assured of.
  * @param beta Minimum score the minimizing player is assured of.
- * @return List of scored moves.
+ * @param bestMove The best move and its score are stored here.
+ * @return When moves were searched true, when the search depth has been exceeded, the board is full
+ *         or there is a winner false.
  * @see ArtificialIntelligence::canPruneBranch() Alpha-beta-pruning.
  */
-ArtificialIntelligence::ScoredMovesType
-ArtificialIntelligence::minimax(ArtificialIntelligence::Node node, const Board& board,
-                                ArtificialIntelligence::PlayerType player, unsigned int depth,
-                                ScoreType alpha, ScoreType beta) const
+bool ArtificialIntelligence::minimax(ArtificialIntelligence::Node node, Board& board,
+                                     ArtificialIntelligence::PlayerType player, unsigned int depth,
+                                     ScoreType alpha, ScoreType beta,
+                                     ArtificialIntelligence::ScoredMoveType& bestMove) const
 {
-	ArtificialIntelligence::ScoredMovesType result;
-	std::vector<unsigned int> possibleMoves = board.getAvailableColumns();
+	bool hasBestMove = false;
+	AvailableColumns possibleMoves = board.getAvailableColumnsRange();
+
+	this->countNode();
 
-	// Return an empty set of results when:
+	// Return no result when:
 	//
 	// - The search depth has been exceeded.
 	// - No more moves are possible (board full).
 	// - There is a winner.
 
-	if (depth > 0 && possibleMoves.size() > 0 && board.findWinningCells().isEmpty())
+	if (depth > 0 && !possibleMoves.isEmpty() && board.findWinningCells().isEmpty())
 	{
-		for(auto it = possibleMoves.begin(); it != possibleMoves.end(); ++it)
+		unsigned int ply = this->currentSearchDepth - depth;
+		std::vector<unsigned int>& moves = this->moveBuffers[ply];
+
+		moves.assign(possibleMoves.begin(), possibleMoves.end());
+
+		if (ply == 0)
+		{
+			this->moveOrdering->orderStatically(board, moves);
+		}
+		else
 		{
-			Board boardAfterMove(board);
+			unsigned int hashMove = this->findHashMove(board, node, player);
+			this->moveOrdering->orderMoves(board, ply, hashMove, moves);
+		}
+
+		for (unsigned int move : moves)
+		{
+			board.makeMove(move, player);
+
+			ScoreType score = this->computeScore(node, board, player, depth, alpha, beta);
 
-			boardAfterMove.dropToken(*it, player);
+			board.unmakeMove();
 
-			ScoreType score = this->computeScore(node, boardAfterMove, player, depth, alpha, beta);
-			result[*it] = score;
+			if (!hasBestMove || (node == Node::MAX_NODE && score > bestMove.second) ||
+			    (node == Node::MIN_NODE && score < bestMove.second))
+			{
+				bestMove = std::make_pair(move, score);
+				hasBestMove = true;
+			}
 
 			if (this->canPruneBranch(node, score, alpha, beta))
 			{
+				this->statistics.nBetaCutoffs++;
+				this->moveOrdering->addCutoff(board, ply, depth, move);
 				break;
 			}
 		}
 	}
 
-	return result;
+	return hasBestMove;
 }
 
 /**
@@ -191,13 +1751,17 @@ ArtificialIntelligence::minimax(ArtificialIntelligence::Node node, const Board&
  * Thereby the minimax-algorithm is always alternately called with the minimizing and maximizing
  * player and in minimizing and maximizing mode.
  *
- * When the minimax algorithm returns no results that means that either the search depth has been
+ * When the minimax algorithm returns no result that means that either the search depth has been
  * exceeded or no more moves were possible. In that case the given board is evaluated and the
  * score is returned.
  *
- * When the minimax algorithm returns a list of scored moves, the best move is selected and
- * returned. If the given node type is minimizing, the move with the lowest score is returned, if
- * the given node type is maximizing, the move with the highest score is returned.
+ * Otherwise the score of the best move found by the minimax algorithm is returned. If the given
+ * node type is minimizing, this is the move with the lowest score, if the given node type is
+ * maximizing, the move with the highest score.
+ *
+ * The computed score is stored in the transposition table. When the table already contains a score
+ * of the board which was computed with the same remaining search depth and which is exact or a
+ * bound that causes a cutoff, that score is returned without searching the board again.
  *
  * @param node Whether this node is minimizing or maximizing.
  * @param board The board to evaluate.
@@ -208,27 +1772,66 @@ ArtificialIntelligence::minimax(ArtificialIntelligence::Node node, const Board&
  * @return The computed score.
  */
 ArtificialIntelligence::ScoreType
-ArtificialIntelligence::computeScore(ArtificialIntelligence::Node node, const Board& board,
+ArtificialIntelligence::computeScore(ArtificialIntelligence::Node node, Board& board,
                                      ArtificialIntelligence::PlayerType player, unsigned int depth,
                                      ScoreType alpha, ScoreType beta) const
 {
 	ScoreType score;
-	ScoredMovesType scoredMoves;
+	ScoredMoveType bestChildMove;
 	Node childNode = (node == Node::MAX_NODE) ? Node::MIN_NODE : Node::MAX_NODE;
 	PlayerType aiPlayer = (node == Node::MAX_NODE) ? player : this->getOtherPlayer(player);
+	PlayerType otherPlayer = this->getOtherPlayer(player);
+	std::uint64_t key = this->computePositionKey(board, childNode, otherPlayer);
+	TranspositionTable::Entry entry;
+
+	this->statistics.nTranspositionTableProbes++;
+
+	if (this->transpositionTable.lookup(key, entry) && entry.depth == depth - 1)
+	{
+		if (entry.bound == TranspositionTable::Bound::EXACT ||
+		    (entry.bound == TranspositionTable::Bound::LOWER && entry.score >= beta) ||
+		    (entry.bound == TranspositionTable::Bound::UPPER && entry.score <= alpha))
+		{
+			this->statistics.nTranspositionTableHits++;
+
+			return entry.score;
+		}
+	}
 
-	scoredMoves = this->minimax(childNode, board, this->getOtherPlayer(player), depth - 1, alpha, beta);
-	if (scoredMoves.empty())
+	TranspositionTable::Bound bound = TranspositionTable::Bound::EXACT;
+	unsigned int bestMove = TranspositionTable::NO_MOVE;
+
+	if (!this->minimax(childNode, board, otherPlayer, depth - 1, alpha, beta, bestChildMove))
 	{
 		// No more moves were possible or depth exceeded.
 
 		score = this->evaluateBoard(board, aiPlayer);
+		this->statistics.nEvaluations++;
 	}
 	else
 	{
-		score = this->findBestMove(childNode, scoredMoves).second;
+		score = bestChildMove.second;
+		bestMove = bestChildMove.first;
+
+		// Because of alpha-beta-pruning, scores outside of the window are only bounds.
+
+		if (score <= alpha)
+		{
+			bound = TranspositionTable::Bound::UPPER;
+		}
+		else if (score >= beta)
+		{
+			bound = TranspositionTable::Bound::LOWER;
+		}
+
+		if (board.isCanonicalHashKeyMirrored())
+		{
+			bestMove = board.getNumberOfColumns() - 1 - bestMove;
+		}
 	}
 
+	this->transpositionTable.store(key, depth - 1, bound, score, bestMove);
+
 	return score;
 }
 
@@ -239,6 +1842,9 @@ ArtificialIntelligence::computeScore(ArtificialIntelligence::Node node, const Bo
  * the minimum possible score is returned. Otherwise, the result is the score of the player
  * subtracted by the score of the other player.
  *
+ * When the board counts the tokens in its windows, the scores of the players are computed from the
+ * counts in constant time, otherwise all windows of the board are scanned.
+ *
  * @param board The board to evaluate.
  * @param player The player for which the score should be computed.
  * @return The computed score.
@@ -249,8 +1855,19 @@ ArtificialIntelligence::evaluateBoard(const Board& board, ArtificialIntelligence
 	ScoreType result;
 	PlayerType otherPlayer = this->getOtherPlayer(player);
 
-	int playerScore = this->computePlayerScore(board, player);
-	int otherPlayerScore = this->computePlayerScore(board, otherPlayer);
+	int playerScore;
+	int otherPlayerScore;
+
+	if (board.isWindowCountingUsed())
+	{
+		playerScore = this->computePlayerScoreFromWindowCounts(board, player);
+		otherPlayerScore = this->computePlayerScoreFromWindowCounts(board, otherPlayer);
+	}
+	else
+	{
+		playerScore = this->computePlayerScore(board, player);
+		otherPlayerScore = this->computePlayerScore(board, otherPlayer);
+	}
 
 	// If one of the players won, return the score of the winner, otherwise, subtract the score
 	// of the other player from the score of the player.
@@ -272,20 +1889,19 @@ ArtificialIntelligence::evaluateBoard(const Board& board, ArtificialIntelligence
 }
 
 /**
- * Iterates over all cells of the given board and computes a score for the given player.
+ * Iterates over all windows of the given board and computes a score for the given player.
  *
  * The higher the returned score, the higher is the probability that the given player wins the game.
  *
- * The algorithm iterates over all horizontal/vertical/diagonal rows in the board and then checks
- * how many consecutive cells are owned by the player or empty (but not owned by the other player).
- * Whenever the algorithm finds 4 consecutive cells containing the player's token or an empty token,
- * it will increase the score depending on the amount of tokens in the 4 cells that belong to the
- * player.
+ * The algorithm iterates over all windows of 4 consecutive cells in the horizontal/vertical/diagonal
+ * rows of the board (see WindowTable). Whenever all 4 cells of a window contain the player's token
+ * or an empty token (but no token of the other player), it will increase the score depending on the
+ * amount of tokens in the 4 cells that belong to the player.
  *
  * If in 4 consecutive tokens, 1 is owned by the player, the score is increased by 1, when 2 tokens
  * are owned by the player it is increased by 10. When the player owns 3 of the 4 tokens, the score
  * is increased by 100 and if the player owns all 4 tokens the score is set to the maximum score
- * (player wins).
+ * (player wins). These are the default weights, see setEvaluationWeights().
  *
  * @param board The board to evaluate.
  * @param player The player for which the score is calculated.
@@ -295,48 +1911,91 @@ ArtificialIntelligence::ScoreType
 ArtificialIntelligence::computePlayerScore(const Board& board, unsigned int player) const
 {
 	ScoreType score = 0;
-	std::vector<CellSet> sets = board.getAllRows();
-	std::vector<CellSet>::const_iterator i;
-	CellSetIterator j;
-	unsigned int nConsecutive;
+	const WindowTable& windows = board.getWindowTable();
+	unsigned int nWindows = windows.getNumberOfWindows();
 
-	for (i = sets.begin(); i != sets.end() && score != std::numeric_limits<ScoreType>::max(); i++)
+	for (unsigned int window = 0; window < nWindows; ++window)
 	{
-		nConsecutive = 0;
-		for(j = i->begin(); j != i->end() && score != std::numeric_limits<ScoreType>::max(); j++)
+		const unsigned int* windowCells = windows.getWindowCells(window);
+		int value = 0;
+		bool isBlocked = false;
+
+		for (unsigned int i = 0; i < WindowTable::WINDOW_SIZE; ++i)
 		{
-			if (Board::CELL_EMPTY == *j || player == *j)
+			Board::TokenType token = board.getCellByIndex(windowCells[i]);
+
+			if (token == player)
 			{
-				nConsecutive++;
+				value++;
 			}
-			else
+			else if (token != Board::CELL_EMPTY)
 			{
-				nConsecutive = 0;
+				isBlocked = true;
+				break;
 			}
+		}
 
-			if (nConsecutive >= 4)
-			{
-				int value = 0;
-
-				value += (i->getContent(j.getIndex() - 3) == player) ? 1 : 0;
-				value += (i->getContent(j.getIndex() - 2) == player) ? 1 : 0;
-				value += (i->getContent(j.getIndex() - 1) == player) ? 1 : 0;
-				value += (*j == player) ? 1 : 0;
+		if (isBlocked)
+		{
+			continue;
+		}
 
-				switch(value)
-				{
-					case 1: score += 1; break;
-					case 2: score += 10; break;
-					case 3: score += 100; break;
-					case 4: score = std::numeric_limits<ScoreType>::max();
-				}
-			}
+		switch(value)
+		{
+			case 1: score += this->evaluationWeights.oneToken; break;
+			case 2: score += this->evaluationWeights.twoTokens; break;
+			case 3: score += this->evaluationWeights.threeTokens; break;
+			case 4: return std::numeric_limits<ScoreType>::max();
 		}
 	}
 
 	return score;
 }
 
+/**
+ * Computes the same score as computePlayerScore() from the window counts of the board.
+ *
+ * Takes constant time, the board has to count the tokens in its windows (see
+ * Board::isWindowCountingUsed()).
+ *
+ * @param board The board to evaluate.
+ * @param player The player for which the score is calculated.
+ * @return Score for the given board/player.
+ */
+ArtificialIntelligence::ScoreType
+ArtificialIntelligence::computePlayerScoreFromWindowCounts(const Board& board,
+                                                           unsigned int player) const
+{
+	if (board.getNumberOfOpenWindows(player, 4) > 0)
+	{
+		return std::numeric_limits<ScoreType>::max();
+	}
+
+	return this->evaluationWeights.oneToken * board.getNumberOfOpenWindows(player, 1) +
+	       this->evaluationWeights.twoTokens * board.getNumberOfOpenWindows(player, 2) +
+	       this->evaluationWeights.threeTokens * board.getNumberOfOpenWindows(player, 3);
+}
+
+/**
+ * Computes the key identifying a position in the transposition table.
+ *
+ * The score of a position depends on the board, the player who makes the next move and on whether
+ * the node is minimizing or maximizing (which determines for which player the board is evaluated).
+ *
+ * @param board The board.
+ * @param node Whether the node is minimizing or maximizing.
+ * @param player The player who makes the next move.
+ * @return Key of the position.
+ */
+std::uint64_t ArtificialIntelligence::computePositionKey(const Board& board,
+                                                         ArtificialIntelligence::Node node,
+                                                         ArtificialIntelligence::PlayerType player) const
+{
+	std::uint64_t perspective = 2 * static_cast<std::uint64_t>(player) + ((node == Node::MAX_NODE) ? 1 : 0);
+
+	return board.getCanonicalHashKey() ^ (perspective * 0x9e3779b97f4a7c15ULL);
+}
+
 /**
  * Adjusts given alpha/beta values if neccessary and returns whether the current branch can be
  * pruned.
@@ -3,9 +3,20 @@
 
 #include "Game.hpp"
 #include "Board.hpp"
+#include "TranspositionTable.hpp"
+#include "MoveOrdering.hpp"
+#include "OpeningBook.hpp"
+#include "Solver.hpp"
+#include "Tablebase.hpp"
+#include "MonteCarloTreeSearch.hpp"
+#include "SearchArena.hpp"
 
 #include <utility>
-#include <map>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <string>
 
 namespace GameLogic
 {
@@ -17,11 +28,100 @@ namespace FourInALine
  *
  * This class implements an artificial intelligence for a four in a line game. It uses the minimax
  * algorithm to find the next best move. The amount of game boards to evaluate is reduced with
- * alpha-beta-pruning.
+ * alpha-beta-pruning. The search works on a single copy of the game board, moves are made and
+ * undone in place with Board::makeMove() and Board::unmakeMove().
  *
  * It is possible to specify the maximum search depth using setSearchDepth() or during construction.
  *
- * Use computeNextMove(game) to find the next best move.
+ * Scores of searched positions are stored in a TranspositionTable, so that positions reached through
+ * different sequences of moves are only searched once. Positions are identified by the canonical
+ * hash key of the board (see Board::getCanonicalHashKey()), so mirrored positions share an entry.
+ * The size of the table can be changed with setTranspositionTableSize(). By default the table is
+ * cleared before every computation, use setKeepTranspositionTable() to keep it across the moves of a
+ * game. Stored scores are only used when they were computed with the same remaining search depth,
+ * so the computed moves are the same as without the table.
+ *
+ * Instead of always searching with the full search depth, it is possible to give the artificial
+ * intelligence a time budget with setTimeBudget(). The search is then done with iterative
+ * deepening: the board is searched with a search depth of 1, 2, 3, ... up to the search depth until
+ * the time budget is used up. The best move of the deepest completed search is returned, the search
+ * with a depth of 1 is always completed. getCompletedSearchDepth() returns the depth of the last
+ * completed search.
+ *
+ * A node budget set with setNodeBudget() limits the search like a time budget, but by the number of
+ * visited nodes instead of the time: every node increases a counter and compares it with the
+ * limit, so the check costs almost nothing and a computation never visits (much) more nodes than the
+ * budget, independent of the board size and the position. A search with a node budget always uses
+ * one thread, so unlike a time budget, a node budget gives the same move on every machine. Both
+ * budgets can be combined, the search stops at the first one that is used up.
+ *
+ * The order in which the moves of a node are searched is decided by a MoveOrdering (center first,
+ * hash move, killer moves and history heuristic), it can be replaced or configured with
+ * setMoveOrdering()/getMoveOrdering(). The moves of the root node are always sorted statically, so
+ * that the computed move only depends on the scores of the moves and not on the state of the
+ * dynamic heuristics. Of several moves with the same score, the first one in the static ordering is
+ * chosen. getNumberOfNodes() returns the number of nodes visited by the last computation.
+ *
+ * Every computation fills in SearchStatistics (visited nodes, beta cutoffs, evaluations,
+ * transposition table probes and hits, completed depth and elapsed time), getSearchStatistics()
+ * returns them after the computation. With setStatisticsLogged() they are also written to the debug
+ * output, one line per computation. The counters are plain per-thread counters, the counters of the
+ * helpers are added after every search depth.
+ *
+ * The search does not allocate memory per node: the moves of a node are stored in a buffer per ply
+ * which is reused, and the best move of a node is tracked while its moves are searched. The other
+ * scratch memory of a computation (e.g. the scores of the root moves) comes from a SearchArena,
+ * which is reset in one step before every computation. Every thread has its own move buffers,
+ * arena and board, which are kept between computations, so the threads do not compete for the
+ * heap. The peak scratch memory of a computation is part of the SearchStatistics.
+ *
+ * The search can use several threads, see setNumberOfThreads(). The moves of the root node are then
+ * split among the threads (root splitting), each thread searches its moves on its own copy of the
+ * board with its own transposition table and move ordering. The window used for a root move depends
+ * on the best score found so far, such that the computed move is always the same as the move
+ * computed by a single thread.
+ *
+ * An OpeningBook can be set with setOpeningBook(). The moves of the positions stored in the book
+ * are taken from the book without searching, when the book was computed with at least the search
+ * depth of the artificial intelligence.
+ *
+ * A Tablebase can be set with setTablebase(). On boards of the size of the tablebase the moves are
+ * taken from the tablebase, which contains the exact score of every position. Every position of
+ * the board size is in the tablebase, so the root node is the only node which has to be probed.
+ *
+ * With setPerfectPlay() the artificial intelligence plays perfectly on boards supported by the
+ * Solver (e.g. 7x6): the moves are computed by solving the board exactly instead of searching it
+ * heuristically. With a time budget the solver gets half of the budget, when it does not finish in
+ * time the move is taken from the opening book or searched as usual with the rest of the budget.
+ * computeExactScore() and computeExactMoveScores() return the exact scores of a board and of its
+ * moves, e.g. to tell the player whether a move wins, loses or draws.
+ *
+ * With setScoreAllMoves() every computation also scores all moves of the root node in the same
+ * search (multi-PV), getMoveScores() returns them afterwards and computeMoveScores() is a shortcut.
+ * The moves are searched with a window whose lower bound is the best score found so far minus the
+ * move score window (see setMoveScoreWindow()), so the scores of the moves close to the best move
+ * are exact and the other scores are upper bounds. The positions below the root moves share the
+ * transposition table, so scoring all moves costs little more than finding the best move. Moves
+ * taken from the tablebase or computed by the solver get exact scores: the maximum score for a
+ * win, the minimum score for a loss and 0 for a draw.
+ *
+ * A function set with setIterationCallback() is called after every completed search depth with the
+ * move scores and the principal variation (the expected moves of both players, read from the
+ * transposition table). With a callback the search always uses iterative deepening, also without a
+ * time budget, e.g. to analyse a position with an increasing search depth until the computation is
+ * stopped.
+ *
+ * With setSearchAlgorithm() the alpha-beta search can be replaced by a MonteCarloTreeSearch, which
+ * plays random games from the position instead of searching all moves up to the search depth and
+ * therefore suits very big boards. The node budget is then the number of playouts, without budgets
+ * DEFAULT_NUMBER_OF_PLAYOUTS playouts are done. The tablebase, the solver and the opening book are
+ * still tried first. The completed search depth is the length of the principal variation of the
+ * tree, the scores of the moves are derived from their win rates.
+ *
+ * Use computeNextMove(game) to find the next best move. predictMoves() returns the moves of the
+ * opponent sorted by how likely they are, e.g. to search the positions after the likely moves of
+ * the opponent in advance (pondering). The positions are then already stored in the kept
+ * transposition table when the next move is computed.
  *
  * This class is reentrant but not thread-safe.
  */
@@ -49,9 +149,155 @@ class ArtificialIntelligence
 		using ScoredMoveType = std::pair<ColumnType, ScoreType>;
 
 		/**
-		 * Map of column indexes to scores.
+		 * Score of a move of the root node.
+		 */
+		struct MoveScore
+		{
+			/**
+			 * Column of the move.
+			 */
+			ColumnType column;
+
+			/**
+			 * Score of the move for the player who makes it.
+			 */
+			ScoreType score;
+
+			/**
+			 * TranspositionTable::Bound::EXACT when the score is exact,
+			 * TranspositionTable::Bound::UPPER when the exact score can be lower.
+			 */
+			TranspositionTable::Bound bound;
+		};
+
+		/**
+		 * Algorithm used to search the board when the move is not taken from the tablebase, the
+		 * solver or the opening book.
+		 */
+		enum class SearchAlgorithm
+		{
+			ALPHA_BETA = 1,             ///< Alpha-beta search up to the search depth.
+			MONTE_CARLO_TREE_SEARCH = 2 ///< Monte Carlo tree search, see MonteCarloTreeSearch.
+		};
+
+		/**
+		 * Result of a completed search depth, see setIterationCallback().
+		 */
+		struct IterationResult
+		{
+			/**
+			 * The completed search depth.
+			 */
+			unsigned int depth;
+
+			/**
+			 * Scores of all moves, the best move first. Empty when the moves are not scored.
+			 */
+			std::vector<MoveScore> moveScores;
+
+			/**
+			 * The best move followed by the expected moves of both players.
+			 */
+			std::vector<ColumnType> principalVariation;
+		};
+
+		/**
+		 * Weights of the evaluation, see computePlayerScore().
+		 */
+		struct EvaluationWeights
+		{
+			/**
+			 * Added for every open window with one token of the player.
+			 */
+			ScoreType oneToken;
+
+			/**
+			 * Added for every open window with two tokens of the player.
+			 */
+			ScoreType twoTokens;
+
+			/**
+			 * Added for every open window with three tokens of the player.
+			 */
+			ScoreType threeTokens;
+		};
+
+		/**
+		 * Statistics of a computation, see getSearchStatistics().
+		 */
+		struct SearchStatistics
+		{
+			/**
+			 * Number of visited nodes, nodes whose score was found in the transposition table are
+			 * not counted. Nodes of the solver when the move was solved, playouts of the Monte Carlo
+			 * tree search.
+			 */
+			unsigned long long nNodes;
+
+			/**
+			 * Number of nodes whose remaining moves were pruned (alpha-beta cutoffs).
+			 */
+			unsigned long long nBetaCutoffs;
+
+			/**
+			 * Number of evaluated leaf boards.
+			 */
+			unsigned long long nEvaluations;
+
+			/**
+			 * Number of positions looked up in the transposition table for their score.
+			 */
+			unsigned long long nTranspositionTableProbes;
+
+			/**
+			 * Number of looked up positions whose stored score was used instead of searching them.
+			 */
+			unsigned long long nTranspositionTableHits;
+
+			/**
+			 * The completed search depth, see getCompletedSearchDepth().
+			 */
+			unsigned int depth;
+
+			/**
+			 * Peak scratch memory of all threads in bytes: the used part of the search arenas, the
+			 * move buffers and the nodes of the Monte Carlo tree search.
+			 */
+			std::size_t scratchSize;
+
+			/**
+			 * Time used by the computation.
+			 */
+			std::chrono::microseconds elapsedTime;
+
+			double getNodesPerSecond() const;
+			std::string toString() const;
+		};
+
+		/**
+		 * Function called after every completed search depth.
 		 */
-		using ScoredMovesType = std::map<ColumnType, ScoreType>;
+		using IterationCallbackType = std::function<void(const IterationResult& result)>;
+
+		/**
+		 * Default number of entries of the transposition table.
+		 */
+		static const std::size_t DEFAULT_TRANSPOSITION_TABLE_SIZE;
+
+		/**
+		 * Default distance to the best score below which move scores are only upper bounds.
+		 */
+		static const ScoreType DEFAULT_MOVE_SCORE_WINDOW;
+
+		/**
+		 * Default weights of the evaluation: 1, 10 and 100.
+		 */
+		static const EvaluationWeights DEFAULT_EVALUATION_WEIGHTS;
+
+		/**
+		 * Number of playouts of the Monte Carlo tree search when there is no budget.
+		 */
+		static const unsigned long long DEFAULT_NUMBER_OF_PLAYOUTS;
 
 		ArtificialIntelligence(unsigned int searchDepth);
 		virtual ~ArtificialIntelligence();
@@ -59,7 +305,58 @@ class ArtificialIntelligence
 		void setSearchDepth(unsigned int searchDepth);
 		unsigned int getSearchDepth() const;
 
+		void setTranspositionTableSize(std::size_t nEntries);
+		std::size_t getTranspositionTableSize() const;
+		void setKeepTranspositionTable(bool keepTranspositionTable);
+		bool isTranspositionTableKept() const;
+		void clearTranspositionTable();
+
+		void setTimeBudget(std::chrono::milliseconds timeBudget);
+		std::chrono::milliseconds getTimeBudget() const;
+		bool hasTimeBudget() const;
+		void setNodeBudget(unsigned long long nodeBudget);
+		unsigned long long getNodeBudget() const;
+		bool hasNodeBudget() const;
+		unsigned int getCompletedSearchDepth() const;
+
+		void setMoveOrdering(std::shared_ptr<MoveOrdering> moveOrdering);
+		std::shared_ptr<MoveOrdering> getMoveOrdering() const;
+		unsigned long long getNumberOfNodes() const;
+		const SearchStatistics& getSearchStatistics() const;
+		void setStatisticsLogged(bool statisticsLogged);
+		bool isStatisticsLogged() const;
+
+		void setNumberOfThreads(unsigned int nThreads);
+		unsigned int getNumberOfThreads() const;
+
+		void setOpeningBook(std::shared_ptr<const OpeningBook> openingBook);
+		std::shared_ptr<const OpeningBook> getOpeningBook() const;
+
+		void setTablebase(std::shared_ptr<const Tablebase> tablebase);
+		std::shared_ptr<const Tablebase> getTablebase() const;
+
+		void setPerfectPlay(bool perfectPlay);
+		bool isPerfectPlay() const;
+
+		void setScoreAllMoves(bool scoreAllMoves);
+		bool isScoringAllMoves() const;
+		void setMoveScoreWindow(ScoreType moveScoreWindow);
+		ScoreType getMoveScoreWindow() const;
+		const std::vector<MoveScore>& getMoveScores() const;
+
+		void setEvaluationWeights(const EvaluationWeights& evaluationWeights);
+		const EvaluationWeights& getEvaluationWeights() const;
+
+		void setSearchAlgorithm(SearchAlgorithm searchAlgorithm);
+		SearchAlgorithm getSearchAlgorithm() const;
+
+		void setIterationCallback(IterationCallbackType iterationCallback);
+
 		virtual unsigned int computeNextMove(const Game& game) const;
+		std::vector<MoveScore> computeMoveScores(const Game& game) const;
+		Solver::ScoreType computeExactScore(const Game& game) const;
+		std::vector<Solver::ScoreType> computeExactMoveScores(const Game& game) const;
+		std::vector<unsigned int> predictMoves(const Game& game) const;
 
 	protected:
 		/**
@@ -71,23 +368,230 @@ class ArtificialIntelligence
 			MAX_NODE = 2  ///< Maximizing node.
 		};
 
+		unsigned int computeNextMove(Board& board, PlayerType player, bool scoreAllMoves) const;
+		unsigned int findNextMove(Board& board, PlayerType player, bool scoreAllMoves) const;
+		bool solveNextMove(const Board& board, PlayerType player, bool scoreAllMoves,
+		                   unsigned int& move) const;
+		unsigned int searchWithMonteCarloTreeSearch(Board& board, PlayerType player, bool scoreAllMoves,
+		                                            std::chrono::steady_clock::time_point startTime) const;
+		unsigned int storeExactMoveScores(const Board& board,
+		                                  const std::vector<Solver::ScoreType>& exactScores) const;
+		unsigned int countEmptyCells(const Board& board) const;
+		void reportIteration(Board& board, PlayerType player, unsigned int depth,
+		                     unsigned int bestMove) const;
+		std::vector<ColumnType> findPrincipalVariation(Board& board, PlayerType player,
+		                                               unsigned int bestMove,
+		                                               unsigned int maximumLength) const;
+		virtual void callIterationCallback(const IterationResult& result) const;
 		PlayerType getOtherPlayer(PlayerType player) const;
-		ScoredMoveType findBestMove(Node node, const ScoredMovesType& scoredMoves) const;
-		virtual ScoredMovesType minimax(Node node, const Board& board, PlayerType player,
-		                                unsigned int depth, ScoreType alpha, ScoreType beta) const;
+		ScoredMoveType searchBestMove(Board& board, PlayerType player, unsigned int depth,
+		                              std::vector<MoveScore>* moveScores = nullptr) const;
+		ScoredMoveType searchBestMoveInParallel(Board& board, PlayerType player, unsigned int depth,
+		                                        std::vector<MoveScore>* moveScores) const;
+		void prepareHelpers() const;
+		void prepareSearch(const Board& board, unsigned int maximumDepth) const;
+		std::size_t computeScratchSize() const;
+		unsigned int findHashMove(const Board& board, Node node, PlayerType player) const;
+		virtual bool isTimeBudgetUsedUp() const;
+		virtual void checkSearchStop() const;
+		void countNode() const;
+		bool minimax(Node node, Board& board, PlayerType player, unsigned int depth,
+		             ScoreType alpha, ScoreType beta, ScoredMoveType& bestMove) const;
 
-		ScoreType computeScore(Node node, const Board& board, PlayerType player, unsigned int depth,
+		ScoreType computeScore(Node node, Board& board, PlayerType player, unsigned int depth,
 		                       ScoreType alpha, ScoreType beta) const;
 
 		ScoreType evaluateBoard(const Board& board, PlayerType player) const;
 		ScoreType computePlayerScore(const Board& board, unsigned int player) const;
+		ScoreType computePlayerScoreFromWindowCounts(const Board& board, unsigned int player) const;
 
 		bool canPruneBranch(Node node, ScoreType score, ScoreType& alpha, ScoreType& beta) const;
 
+		std::uint64_t computePositionKey(const Board& board, Node node, PlayerType player) const;
+
 		/**
 		 * Maximum search depth (how many levels the search tree has).
 		 */
 		unsigned int searchDepth;
+
+		/**
+		 * Scores of already searched positions.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable TranspositionTable transpositionTable;
+
+		/**
+		 * Whether the transposition table is kept between computations.
+		 */
+		bool keepTranspositionTable;
+
+		/**
+		 * Time budget for the computation of a move, 0 when the full search depth is always used.
+		 */
+		std::chrono::milliseconds timeBudget;
+
+		/**
+		 * Point in time when the current search has to be stopped.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable std::chrono::steady_clock::time_point deadline;
+
+		/**
+		 * Whether the current search can be stopped, because there is a result to fall back to.
+		 * It is then stopped when isTimeBudgetUsedUp() returns true.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable bool isStoppable;
+
+		/**
+		 * Maximum number of nodes visited by a computation, 0 when the number is not limited.
+		 */
+		unsigned long long nodeBudget;
+
+		/**
+		 * Number of visited nodes at which the current search has to be stopped, the maximum when
+		 * it is not limited. A node budget forces a single search thread, so there are no helpers.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable unsigned long long nodeLimit;
+
+		/**
+		 * Search depth of the last completed search.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable unsigned int completedSearchDepth;
+
+		/**
+		 * Decides in which order moves are searched.
+		 */
+		std::shared_ptr<MoveOrdering> moveOrdering;
+
+		/**
+		 * Search depth of the current search (iteration), used to compute the ply of a node.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable unsigned int currentSearchDepth;
+
+		/**
+		 * One buffer per ply for the moves of a node, so that no memory has to be allocated.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable std::vector<std::vector<unsigned int> > moveBuffers;
+
+		/**
+		 * Scratch memory of the current computation, reset before every computation.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable SearchArena searchArena;
+
+		/**
+		 * Copy of the searched board used by a helper, kept so that its memory is reused. nullptr
+		 * until the helper searches for the first time.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable std::unique_ptr<Board> searchBoard;
+
+		/**
+		 * Statistics of the last computation, the counters are increased during the search.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable SearchStatistics statistics;
+
+		/**
+		 * Whether the statistics are written to the debug output after every computation.
+		 */
+		bool statisticsLogged;
+
+		/**
+		 * Number of threads used by the search.
+		 */
+		unsigned int nThreads;
+
+		/**
+		 * Artificial intelligences searching root moves in the other threads, nThreads - 1 of them.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable std::vector<std::unique_ptr<ArtificialIntelligence> > helpers;
+
+		/**
+		 * The artificial intelligence which uses this one as helper, nullptr when this is not a
+		 * helper. Helpers ask the master whether the search has to be stopped.
+		 */
+		const ArtificialIntelligence* master;
+
+		/**
+		 * Opening book used before searching, nullptr when there is none.
+		 */
+		std::shared_ptr<const OpeningBook> openingBook;
+
+		/**
+		 * Tablebase used before searching, nullptr when there is none.
+		 */
+		std::shared_ptr<const Tablebase> tablebase;
+
+		/**
+		 * Whether the moves are computed by the solver when the board is supported.
+		 */
+		bool perfectPlay;
+
+		/**
+		 * Solver used for perfect play and exact scores, its transposition table is kept as long as
+		 * the board size does not change.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable Solver solver;
+
+		/**
+		 * Whether every computation scores all moves of the root node.
+		 */
+		bool scoreAllMoves;
+
+		/**
+		 * Distance to the best score below which move scores are only upper bounds.
+		 */
+		ScoreType moveScoreWindow;
+
+		/**
+		 * Scores of the moves of the root node computed by the last computation, the best move first.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable std::vector<MoveScore> moveScores;
+
+		/**
+		 * Called after every completed search depth, empty when there is no callback.
+		 */
+		IterationCallbackType iterationCallback;
+
+		/**
+		 * Weights of the evaluation.
+		 */
+		EvaluationWeights evaluationWeights;
+
+		/**
+		 * Algorithm used to search the board.
+		 */
+		SearchAlgorithm searchAlgorithm;
+
+		/**
+		 * Monte Carlo tree search used when it is the search algorithm, its arena is allocated by
+		 * the first search.
+		 *
+		 * Mutable so that computeNextMove() can stay const.
+		 */
+		mutable MonteCarloTreeSearch monteCarloTreeSearch;
 };
 
 }
@@ -0,0 +1,139 @@
+#include "AvailableColumns.hpp"
+#include "Board.hpp"
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Creates an iterator pointing at the first available column at or after the given column.
+ *
+ * @param board The board.
+ * @param x Position of the column on the x axis.
+ */
+AvailableColumns::Iterator::Iterator(const Board* board, unsigned int x)
+    : board(board), x(x)
+{
+	this->skipFullColumns();
+}
+
+/**
+ * Returns the current column.
+ *
+ * @return Position of the column on the x axis.
+ */
+unsigned int AvailableColumns::Iterator::operator*() const
+{
+	return this->x;
+}
+
+/**
+ * Advances the iterator to the next available column.
+ *
+ * @return The iterator.
+ */
+AvailableColumns::Iterator& AvailableColumns::Iterator::operator++()
+{
+	this->x++;
+	this->skipFullColumns();
+
+	return *this;
+}
+
+/**
+ * Returns whether both iterators point at the same column.
+ *
+ * @param it The other iterator.
+ * @return When both point at the same column true, otherwise false.
+ */
+bool AvailableColumns::Iterator::operator==(const AvailableColumns::Iterator& it) const
+{
+	return this->x == it.x;
+}
+
+/**
+ * Returns whether the iterators point at different columns.
+ *
+ * @param it The other iterator.
+ * @return When they point at different columns true, otherwise false.
+ */
+bool AvailableColumns::Iterator::operator!=(const AvailableColumns::Iterator& it) const
+{
+	return this->x != it.x;
+}
+
+/**
+ * Advances the iterator until it points at a column which is not full or after the last column.
+ */
+void AvailableColumns::Iterator::skipFullColumns()
+{
+	unsigned int nColumns = this->board->getNumberOfColumns();
+	unsigned int nRows = this->board->getNumberOfRows();
+
+	while (this->x < nColumns && this->board->getColumnHeight(this->x) >= nRows)
+	{
+		this->x++;
+	}
+}
+
+/**
+ * Creates a range of the available columns of the given board.
+ *
+ * @param board The board.
+ */
+AvailableColumns::AvailableColumns(const Board* board)
+    : board(board)
+{
+
+}
+
+/**
+ * Returns an iterator pointing at the first available column.
+ *
+ * @return Iterator pointing at the first available column.
+ */
+AvailableColumns::Iterator AvailableColumns::begin() const
+{
+	return Iterator(this->board, 0);
+}
+
+/**
+ * Returns an iterator positioned after the last column.
+ *
+ * @return Iterator positioned after the last column.
+ */
+AvailableColumns::Iterator AvailableColumns::end() const
+{
+	return Iterator(this->board, this->board->getNumberOfColumns());
+}
+
+/**
+ * Returns the number of available columns.
+ *
+ * @return Number of columns in which a token can be dropped.
+ */
+unsigned int AvailableColumns::getNumberOfColumns() const
+{
+	unsigned int result = 0;
+
+	for (auto it = this->begin(); it != this->end(); ++it)
+	{
+		result++;
+	}
+
+	return result;
+}
+
+/**
+ * Returns whether there are no available columns, i.e. the board is full.
+ *
+ * @return When no token can be dropped true, otherwise false.
+ */
+bool AvailableColumns::isEmpty() const
+{
+	return this->begin() == this->end();
+}
+
+}
+}
@@ -0,0 +1,85 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_AVAILABLECOLUMNS_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_AVAILABLECOLUMNS_HPP
+
+#include <iterator>
+#include <cstddef>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+class Board;
+
+/**
+ * Range of the columns of a board in which a token can be dropped.
+ *
+ * The range does not copy the columns, it references the board and skips full columns while
+ * iterating, using the column heights maintained by the board. Creating and iterating over the
+ * range never allocates memory, which makes it suitable for algorithms that have to list the
+ * possible moves very often (e.g. an artificial intelligence).
+ *
+ * Use begin() and end() to iterate over the columns from left to right, getNumberOfColumns() to
+ * count them and isEmpty() to check whether there are any.
+ *
+ * The range reflects the current state of the board, i.e. it changes when tokens are dropped or
+ * removed. The board must outlive the range.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class AvailableColumns
+{
+	public:
+		/**
+		 * Forward iterator over the available columns.
+		 */
+		class Iterator
+		{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = unsigned int;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const unsigned int*;
+				using reference = unsigned int;
+
+				Iterator(const Board* board, unsigned int x);
+
+				unsigned int operator*() const;
+				Iterator& operator++();
+
+				bool operator==(const Iterator& it) const;
+				bool operator!=(const Iterator& it) const;
+
+			private:
+				void skipFullColumns();
+
+				/**
+				 * The board.
+				 */
+				const Board* board;
+
+				/**
+				 * Current column.
+				 */
+				unsigned int x;
+		};
+
+		explicit AvailableColumns(const Board* board);
+
+		Iterator begin() const;
+		Iterator end() const;
+
+		unsigned int getNumberOfColumns() const;
+		bool isEmpty() const;
+
+	private:
+		/**
+		 * The board.
+		 */
+		const Board* board;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_AVAILABLECOLUMNS_HPP
@@ -0,0 +1,487 @@
+#include "BitBoard.hpp"
+
+#include <stdexcept>
+#include <climits>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const unsigned int BitBoard::MAXIMUM_NUMBER_OF_BITS = sizeof(BitBoard::MaskType) * CHAR_BIT;
+
+/**
+ * Returns whether a board with the given dimensions fits into a bit board.
+ *
+ * Every column needs nRows + 1 bits, therefore the board fits when
+ * nColumns * (nRows + 1) <= MAXIMUM_NUMBER_OF_BITS.
+ *
+ * @param nColumns Number of columns.
+ * @param nRows Number of rows.
+ * @return When the board fits into a bit board true, otherwise false.
+ */
+bool BitBoard::isSupported(unsigned int nColumns, unsigned int nRows)
+{
+	if (nColumns < 1 || nRows < 1 || nRows >= BitBoard::MAXIMUM_NUMBER_OF_BITS)
+	{
+		return false;
+	}
+
+	return nColumns <= BitBoard::MAXIMUM_NUMBER_OF_BITS / (nRows + 1);
+}
+
+/**
+ * Creates a bit board without any cells.
+ *
+ * Used as placeholder by boards which are too big to be represented by a bit board.
+ */
+BitBoard::BitBoard()
+    : nColumns(0), nRows(0), columnHeight(1), occupied(0), bottomMask(0), boardMask(0)
+{
+	this->playerMasks[0] = 0;
+	this->playerMasks[1] = 0;
+}
+
+/**
+ * Creates a new empty bit board with the given dimensions.
+ *
+ * @param nColumns Number of columns.
+ * @param nRows Number of rows.
+ * @see BitBoard::isSupported() To check whether the dimensions are supported.
+ */
+BitBoard::BitBoard(unsigned int nColumns, unsigned int nRows)
+    : nColumns(nColumns), nRows(nRows), columnHeight(nRows + 1), occupied(0), bottomMask(0)
+{
+	if (!BitBoard::isSupported(nColumns, nRows))
+	{
+		throw std::domain_error("The board is too big to be represented by a bit board.");
+	}
+
+	for (unsigned int i = 0; i < this->nColumns; ++i)
+	{
+		this->bottomMask |= this->getBottomBit(i);
+	}
+
+	this->boardMask = this->bottomMask * ((static_cast<MaskType>(1) << this->nRows) - 1);
+
+	this->playerMasks[0] = 0;
+	this->playerMasks[1] = 0;
+}
+
+/**
+ * Removes all tokens from the board.
+ */
+void BitBoard::clear()
+{
+	this->playerMasks[0] = 0;
+	this->playerMasks[1] = 0;
+	this->occupied = 0;
+}
+
+/**
+ * Returns the number of columns.
+ *
+ * @return Number of columns.
+ */
+unsigned int BitBoard::getNumberOfColumns() const
+{
+	return this->nColumns;
+}
+
+/**
+ * Returns the number of rows.
+ *
+ * @return Number of rows.
+ */
+unsigned int BitBoard::getNumberOfRows() const
+{
+	return this->nRows;
+}
+
+/**
+ * Returns whether a token can be dropped in the given column.
+ *
+ * @param x Position of the column on the x axis.
+ * @return When the column is not full true, otherwise false.
+ */
+bool BitBoard::canDropToken(unsigned int x) const
+{
+	return 0 == (this->occupied & this->getTopBit(x));
+}
+
+/**
+ * Drops a token of the given player into the given column.
+ *
+ * @param x Position of the column on the x axis.
+ * @param player Player index (0 or 1).
+ * @return Position of the dropped token on the y axis.
+ */
+unsigned int BitBoard::dropToken(unsigned int x, unsigned int player)
+{
+	// Adding the bottom bit to the occupied cells of the column yields the lowest empty cell.
+
+	MaskType bit = (this->occupied + this->getBottomBit(x)) & this->getColumnMask(x);
+
+	if (0 == bit)
+	{
+		throw std::runtime_error("Can't drop token in given column.");
+	}
+
+	this->occupied |= bit;
+	this->playerMasks[player] |= bit;
+
+	return this->nRows - 1 - (BitBoard::countTrailingZeros(bit) - x * this->columnHeight);
+}
+
+/**
+ * Removes the top token of the given column.
+ *
+ * @param x Position of the column on the x axis.
+ * @return Position of the removed token on the y axis.
+ */
+unsigned int BitBoard::removeToken(unsigned int x)
+{
+	MaskType column = this->occupied & this->getColumnMask(x);
+
+	if (0 == column)
+	{
+		throw std::runtime_error("Cannot remove token, column is already empty.");
+	}
+
+	// The occupied cells of a column are contiguous, adding the bottom bit gives the first empty
+	// cell, the cell below it is the top token.
+
+	MaskType bit = (column + this->getBottomBit(x)) >> 1;
+
+	this->occupied &= ~bit;
+	this->playerMasks[0] &= ~bit;
+	this->playerMasks[1] &= ~bit;
+
+	return this->nRows - 1 - (BitBoard::countTrailingZeros(bit) - x * this->columnHeight);
+}
+
+/**
+ * Puts a token of the given player into the given cell.
+ *
+ * This does not check whether the cell is on top of the column, it is used to build a bit board
+ * from an existing board.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ * @param player Player index (0 or 1).
+ */
+void BitBoard::setCell(unsigned int x, unsigned int y, unsigned int player)
+{
+	MaskType bit = this->getBit(x, y);
+
+	this->occupied |= bit;
+	this->playerMasks[player] |= bit;
+}
+
+/**
+ * Removes the token from the given cell.
+ *
+ * Like setCell() this does not keep the tokens of the column contiguous, the caller has to move
+ * the tokens above the cell down.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ */
+void BitBoard::clearCell(unsigned int x, unsigned int y)
+{
+	MaskType bit = this->getBit(x, y);
+
+	this->occupied &= ~bit;
+	this->playerMasks[0] &= ~bit;
+	this->playerMasks[1] &= ~bit;
+}
+
+/**
+ * Returns the player whose token is in the given cell.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ * @return Player index (0 or 1) or -1 when the cell is empty.
+ */
+int BitBoard::getCell(unsigned int x, unsigned int y) const
+{
+	MaskType bit = this->getBit(x, y);
+
+	if (0 != (this->playerMasks[0] & bit))
+	{
+		return 0;
+	}
+
+	if (0 != (this->playerMasks[1] & bit))
+	{
+		return 1;
+	}
+
+	return -1;
+}
+
+/**
+ * Returns the number of tokens in the given column.
+ *
+ * @param x Position of the column on the x axis.
+ * @return Number of tokens in the column.
+ */
+unsigned int BitBoard::getColumnHeight(unsigned int x) const
+{
+	return BitBoard::countBits(this->occupied & this->getColumnMask(x));
+}
+
+/**
+ * Returns whether the given column is full.
+ *
+ * @param x Position of the column on the x axis.
+ * @return When the column is full true, otherwise false.
+ */
+bool BitBoard::isColumnFull(unsigned int x) const
+{
+	return !this->canDropToken(x);
+}
+
+/**
+ * Returns whether the given column is empty.
+ *
+ * @param x Position of the column on the x axis.
+ * @return When the column is empty true, otherwise false.
+ */
+bool BitBoard::isColumnEmpty(unsigned int x) const
+{
+	return 0 == (this->occupied & this->getBottomBit(x));
+}
+
+/**
+ * Returns whether all cells of the board are occupied.
+ *
+ * @return When the board is full true, otherwise false.
+ */
+bool BitBoard::isFull() const
+{
+	return this->occupied == this->boardMask;
+}
+
+/**
+ * Returns whether the board contains no tokens.
+ *
+ * @return When the board is empty true, otherwise false.
+ */
+bool BitBoard::isEmpty() const
+{
+	return 0 == this->occupied;
+}
+
+/**
+ * Returns whether the given player has four tokens in a row.
+ *
+ * @param player Player index (0 or 1).
+ * @return When the player has four tokens in a row true, otherwise false.
+ */
+bool BitBoard::hasWon(unsigned int player) const
+{
+	MaskType mask = this->playerMasks[player];
+
+	return 0 != (this->findFourInARow(mask, 1) |
+	             this->findFourInARow(mask, this->columnHeight - 1) |
+	             this->findFourInARow(mask, this->columnHeight) |
+	             this->findFourInARow(mask, this->columnHeight + 1));
+}
+
+/**
+ * Finds four tokens in a row of the given player.
+ *
+ * The result uses the same start cell and direction as the cell sets returned by
+ * ::GameLogic::Board::getRow(), getColumn(), getMinorDiagonal() and getMajorDiagonal().
+ *
+ * @param player Player index (0 or 1).
+ * @param startX Set to the position of the first winning cell on the x axis.
+ * @param startY Set to the position of the first winning cell on the y axis.
+ * @param deltaX Set to the difference on the x axis to the next winning cell.
+ * @param deltaY Set to the difference on the y axis to the next winning cell.
+ * @return When four tokens in a row were found true, otherwise false.
+ */
+bool BitBoard::findWinningCells(unsigned int player, unsigned int& startX, unsigned int& startY,
+                                int& deltaX, int& deltaY) const
+{
+	MaskType mask = this->playerMasks[player];
+	MaskType found;
+	unsigned int bitIndex;
+
+	// Horizontal.
+
+	if (0 != (found = this->findFourInARow(mask, this->columnHeight)))
+	{
+		bitIndex = BitBoard::countTrailingZeros(found);
+		startX = bitIndex / this->columnHeight;
+		startY = this->nRows - 1 - bitIndex % this->columnHeight;
+		deltaX = 1;
+		deltaY = 0;
+
+		return true;
+	}
+
+	// Vertical, the lowest bit is the bottom cell, the cell set starts at the top cell.
+
+	if (0 != (found = this->findFourInARow(mask, 1)))
+	{
+		bitIndex = BitBoard::countTrailingZeros(found);
+		startX = bitIndex / this->columnHeight;
+		startY = this->nRows - 1 - bitIndex % this->columnHeight - 3;
+		deltaX = 0;
+		deltaY = 1;
+
+		return true;
+	}
+
+	// Minor diagonal (bottom left to top right), the cell set starts at the top right cell.
+
+	if (0 != (found = this->findFourInARow(mask, this->columnHeight + 1)))
+	{
+		bitIndex = BitBoard::countTrailingZeros(found);
+		startX = bitIndex / this->columnHeight + 3;
+		startY = this->nRows - 1 - bitIndex % this->columnHeight - 3;
+		deltaX = -1;
+		deltaY = 1;
+
+		return true;
+	}
+
+	// Major diagonal (top left to bottom right).
+
+	if (0 != (found = this->findFourInARow(mask, this->columnHeight - 1)))
+	{
+		bitIndex = BitBoard::countTrailingZeros(found);
+		startX = bitIndex / this->columnHeight;
+		startY = this->nRows - 1 - bitIndex % this->columnHeight;
+		deltaX = 1;
+		deltaY = 1;
+
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Returns the mask containing the tokens of the given player.
+ *
+ * @param player Player index (0 or 1).
+ * @return Mask of the player.
+ */
+BitBoard::MaskType BitBoard::getPlayerMask(unsigned int player) const
+{
+	return this->playerMasks[player];
+}
+
+/**
+ * Returns the mask containing all occupied cells.
+ *
+ * @return Mask of occupied cells.
+ */
+BitBoard::MaskType BitBoard::getOccupiedMask() const
+{
+	return this->occupied;
+}
+
+/**
+ * Returns a mask with only the bit of the given cell set.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ * @return Mask of the cell.
+ */
+BitBoard::MaskType BitBoard::getBit(unsigned int x, unsigned int y) const
+{
+	return this->getBottomBit(x) << (this->nRows - 1 - y);
+}
+
+/**
+ * Returns a mask with only the bottom cell of the given column set.
+ *
+ * @param x Position of the column on the x axis.
+ * @return Mask of the bottom cell.
+ */
+BitBoard::MaskType BitBoard::getBottomBit(unsigned int x) const
+{
+	return static_cast<MaskType>(1) << (x * this->columnHeight);
+}
+
+/**
+ * Returns a mask with only the top cell (not the sentinel) of the given column set.
+ *
+ * @param x Position of the column on the x axis.
+ * @return Mask of the top cell.
+ */
+BitBoard::MaskType BitBoard::getTopBit(unsigned int x) const
+{
+	return this->getBottomBit(x) << (this->nRows - 1);
+}
+
+/**
+ * Returns a mask containing all cells (without the sentinel) of the given column.
+ *
+ * @param x Position of the column on the x axis.
+ * @return Mask of the column.
+ */
+BitBoard::MaskType BitBoard::getColumnMask(unsigned int x) const
+{
+	return ((static_cast<MaskType>(1) << this->nRows) - 1) << (x * this->columnHeight);
+}
+
+/**
+ * Returns a mask containing the first cell of every four consecutive bits in the given direction.
+ *
+ * @param mask Mask of a player.
+ * @param shift Distance between two neighbouring cells in the bit layout (1 = vertical,
+ *        columnHeight = horizontal, columnHeight - 1/columnHeight + 1 = diagonal).
+ * @return Mask containing the first cell of every four in a row.
+ */
+BitBoard::MaskType BitBoard::findFourInARow(BitBoard::MaskType mask, unsigned int shift) const
+{
+	MaskType pairs = mask & (mask >> shift);
+
+	return pairs & (pairs >> (2 * shift));
+}
+
+/**
+ * Returns the number of trailing zero bits in the given (non-empty) mask.
+ *
+ * @param mask The mask, must not be 0.
+ * @return Index of the lowest set bit.
+ */
+unsigned int BitBoard::countTrailingZeros(BitBoard::MaskType mask)
+{
+#if defined(__SIZEOF_INT128__)
+	std::uint64_t low = static_cast<std::uint64_t>(mask);
+
+	if (0 != low)
+	{
+		return __builtin_ctzll(low);
+	}
+
+	return 64 + __builtin_ctzll(static_cast<std::uint64_t>(mask >> 64));
+#else
+	return __builtin_ctzll(mask);
+#endif
+}
+
+/**
+ * Returns the number of set bits in the given mask.
+ *
+ * @param mask The mask.
+ * @return Number of set bits.
+ */
+unsigned int BitBoard::countBits(BitBoard::MaskType mask)
+{
+#if defined(__SIZEOF_INT128__)
+	return __builtin_popcountll(static_cast<std::uint64_t>(mask)) +
+	       __builtin_popcountll(static_cast<std::uint64_t>(mask >> 64));
+#else
+	return __builtin_popcountll(mask);
+#endif
+}
+
+}
+}
@@ -0,0 +1,140 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_BITBOARD_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_BITBOARD_HPP
+
+#include <cstdint>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Compact two player four in a line board stored in bit masks.
+ *
+ * The bit board stores one mask per player and a mask containing all occupied cells. Every column
+ * uses nRows + 1 consecutive bits, the lowest bit is the bottom cell of the column and the
+ * additional top bit is always empty (sentinel). The sentinel bits make sure that horizontal and
+ * diagonal lines never wrap around into the next column, so that four in a row can be detected
+ * with a few shifts and ANDs.
+ *
+ *     Bit layout of a board with 3 columns and 3 rows:
+ *
+ *       3  7 11   <- sentinel bits
+ *       2  6 10
+ *       1  5  9
+ *       0  4  8   <- bottom row
+ *
+ * The occupied mask also encodes the height of every column, a token is dropped by adding the
+ * bottom bit of the column to the occupied mask.
+ *
+ * A bit board can only be used when the board fits into a mask (see isSupported()). On compilers
+ * with 128 bit integer support a mask has 128 bits, which covers every board size selectable in
+ * the user interface, otherwise it has 64 bits.
+ *
+ * The players are identified by their index (0 or 1). Positions are given in the same coordinate
+ * system as used by ::GameLogic::Board, i.e. y = 0 is the top row.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class BitBoard
+{
+	public:
+#if defined(__SIZEOF_INT128__)
+		/**
+		 * Type used for the bit masks.
+		 */
+		using MaskType = unsigned __int128;
+#else
+		/**
+		 * Type used for the bit masks.
+		 */
+		using MaskType = std::uint64_t;
+#endif
+
+		/**
+		 * Maximum number of bits (cells including sentinel cells) a bit board can have.
+		 */
+		static const unsigned int MAXIMUM_NUMBER_OF_BITS;
+
+		static bool isSupported(unsigned int nColumns, unsigned int nRows);
+
+		BitBoard();
+		BitBoard(unsigned int nColumns, unsigned int nRows);
+
+		void clear();
+
+		unsigned int getNumberOfColumns() const;
+		unsigned int getNumberOfRows() const;
+
+		bool canDropToken(unsigned int x) const;
+		unsigned int dropToken(unsigned int x, unsigned int player);
+		unsigned int removeToken(unsigned int x);
+		void setCell(unsigned int x, unsigned int y, unsigned int player);
+		void clearCell(unsigned int x, unsigned int y);
+		int getCell(unsigned int x, unsigned int y) const;
+
+		unsigned int getColumnHeight(unsigned int x) const;
+		bool isColumnFull(unsigned int x) const;
+		bool isColumnEmpty(unsigned int x) const;
+
+		bool isFull() const;
+		bool isEmpty() const;
+
+		bool hasWon(unsigned int player) const;
+		bool findWinningCells(unsigned int player, unsigned int& startX, unsigned int& startY,
+		                      int& deltaX, int& deltaY) const;
+
+		MaskType getPlayerMask(unsigned int player) const;
+		MaskType getOccupiedMask() const;
+
+	private:
+		MaskType getBit(unsigned int x, unsigned int y) const;
+		MaskType getBottomBit(unsigned int x) const;
+		MaskType getTopBit(unsigned int x) const;
+		MaskType getColumnMask(unsigned int x) const;
+		MaskType findFourInARow(MaskType mask, unsigned int shift) const;
+
+		static unsigned int countTrailingZeros(MaskType mask);
+		static unsigned int countBits(MaskType mask);
+
+		/**
+		 * Number of columns.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * Number of bits per column (number of rows + 1 sentinel bit).
+		 */
+		unsigned int columnHeight;
+
+		/**
+		 * Contains a mask for every player, a bit is set when the cell contains a token of the
+		 * player.
+		 */
+		MaskType playerMasks[2];
+
+		/**
+		 * Contains all occupied cells.
+		 */
+		MaskType occupied;
+
+		/**
+		 * Contains the bottom cell of every column.
+		 */
+		MaskType bottomMask;
+
+		/**
+		 * Contains all cells of the board (without the sentinel bits).
+		 */
+		MaskType boardMask;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_BITBOARD_HPP
@@ -2,6 +2,7 @@
 
 #include <QDebug>
 #include <stdexcept>
+#include <algorithm>
 
 namespace GameLogic
 {
@@ -17,9 +18,36 @@ const ::GameLogic::Board::TokenType Board::CELL_EMPTY = 0;
  * @param nRows Number of rows. Minimum 1.
  */
 Board::Board(unsigned int nColumns, unsigned int nRows)
-    : ::GameLogic::Board(nColumns, nRows, Board::CELL_EMPTY)
+    : ::GameLogic::Board(nColumns, nRows, Board::CELL_EMPTY),
+      useBitBoard(BitBoard::isSupported(nColumns, nRows)),
+      windowTable(WindowTable::getInstance(nColumns, nRows)), useWindowCounting(true)
 {
+	if (this->useBitBoard)
+	{
+		// The masks store the cells, the cell vector is only used by boards which are too big.
+
+		this->bitBoard = BitBoard(nColumns, nRows);
+		this->cells.clear();
+		this->cells.shrink_to_fit();
+	}
+
+	this->playerTokens[0] = Board::CELL_EMPTY;
+	this->playerTokens[1] = Board::CELL_EMPTY;
+
+	this->rebuildWindowCounts();
+
+	this->columnHeights = std::vector<unsigned int>(nColumns, 0);
+	this->nTokens = 0;
+
+	this->winningCells.state = WinningCellsState::NONE;
+	this->nOutdatedMoves = 0;
 
+	this->hashKey = this->getEmptyBoardHashKey();
+	this->mirroredHashKey = this->hashKey;
+
+	// Reserve enough space so that makeMove() never has to allocate memory.
+
+	this->moveStack.reserve(nColumns * nRows);
 }
 
 /**
@@ -28,9 +56,18 @@ Board::Board(unsigned int nColumns, unsigned int nRows)
  * @param board Board to copy.
  */
 Board::Board(const Board& board)
-    : ::GameLogic::Board(board)
+    : ::GameLogic::Board(board), useBitBoard(board.useBitBoard), bitBoard(board.bitBoard),
+      columnHeights(board.columnHeights), nTokens(board.nTokens),
+      windowTable(board.windowTable), useWindowCounting(board.useWindowCounting),
+      windowTokenCounts(board.windowTokenCounts), nOpenWindows(board.nOpenWindows),
+      winningCells(board.winningCells), nOutdatedMoves(board.nOutdatedMoves),
+      hashKey(board.hashKey), mirroredHashKey(board.mirroredHashKey)
 {
+	this->playerTokens[0] = board.playerTokens[0];
+	this->playerTokens[1] = board.playerTokens[1];
 
+	this->moveStack.reserve(this->nColumns * this->nRows);
+	this->moveStack = board.moveStack;
 }
 
 /**
@@ -41,6 +78,78 @@ Board::~Board()
 
 }
 
+/**
+ * Copy assignment.
+ *
+ * The memory of this board is reused, so assigning a board of the same size does not allocate
+ * memory, e.g. to reset the board of a search thread to the searched position.
+ *
+ * @param board Board to copy.
+ * @return This board.
+ */
+Board& Board::operator=(const Board& board)
+{
+	// The empty token can not be assigned, it is the same for all four in a line boards.
+
+	this->cells = board.cells;
+	this->nRows = board.nRows;
+	this->nColumns = board.nColumns;
+
+	this->useBitBoard = board.useBitBoard;
+	this->bitBoard = board.bitBoard;
+	this->columnHeights = board.columnHeights;
+	this->nTokens = board.nTokens;
+	this->playerTokens[0] = board.playerTokens[0];
+	this->playerTokens[1] = board.playerTokens[1];
+	this->windowTable = board.windowTable;
+	this->useWindowCounting = board.useWindowCounting;
+	this->windowTokenCounts = board.windowTokenCounts;
+	this->nOpenWindows = board.nOpenWindows;
+	this->winningCells = board.winningCells;
+	this->nOutdatedMoves = board.nOutdatedMoves;
+	this->hashKey = board.hashKey;
+	this->mirroredHashKey = board.mirroredHashKey;
+
+	this->moveStack.reserve(this->nColumns * this->nRows);
+	this->moveStack = board.moveStack;
+
+	return *this;
+}
+
+/**
+ * @copydoc ::GameLogic::Board::clear()
+ *
+ * Also resets the column heights, the cached winning cells, the hash keys and the window counts, so
+ * that the windows are counted again. A board which fits into a bit board stores its cells in the
+ * bit board again.
+ */
+void Board::clear()
+{
+	::GameLogic::Board::clear();
+
+	this->bitBoard.clear();
+
+	if (!this->useBitBoard && BitBoard::isSupported(this->nColumns, this->nRows))
+	{
+		this->useBitBoard = true;
+		this->cells.clear();
+	}
+
+	std::fill(this->columnHeights.begin(), this->columnHeights.end(), 0);
+	this->nTokens = 0;
+
+	this->playerTokens[0] = Board::CELL_EMPTY;
+	this->playerTokens[1] = Board::CELL_EMPTY;
+	this->useWindowCounting = true;
+	this->rebuildWindowCounts();
+	this->moveStack.clear();
+	this->winningCells.state = WinningCellsState::NONE;
+	this->nOutdatedMoves = 0;
+
+	this->hashKey = this->getEmptyBoardHashKey();
+	this->mirroredHashKey = this->hashKey;
+}
+
 /**
  * Returns whether it is possible to drop a token in the specified column.
  *
@@ -49,6 +158,13 @@ Board::~Board()
  */
 bool Board::canDropToken(unsigned int x) const
 {
+	if (this->useBitBoard)
+	{
+		this->checkPosition(x, 0);
+
+		return this->bitBoard.canDropToken(x);
+	}
+
 	return !this->isColumnFull(x);
 }
 
@@ -64,21 +180,47 @@ bool Board::canDropToken(unsigned int x) const
  */
 void Board::dropToken(unsigned int x, TokenType token)
 {
-	if (this->canDropToken(x))
+	if (token == Board::CELL_EMPTY || !this->canDropToken(x))
 	{
-		for (unsigned int i = this->nRows; i-- != 0;)
-		{
-			if (this->isCellEmpty(x, i))
-			{
-				// Lowest empty cell found, drop token here.
+		throw std::runtime_error("Can't drop token in given column.");
+	}
 
-				this->setCell(x, i, token);
-				return;
-			}
+	// The lowest empty cell is directly above the top token of the column.
+
+	unsigned int y = this->nRows - 1 - this->columnHeights[x];
+	int player = this->getPlayerIndex(token);
+
+	if (player < 0)
+	{
+		// A third kind of token can't be represented by the window counts and the bit board.
+
+		this->useWindowCounting = false;
+
+		if (this->useBitBoard)
+		{
+			this->switchToCells();
 		}
 	}
 
-	throw std::runtime_error("Can't drop token in given column.");
+	if (this->useWindowCounting)
+	{
+		this->changeWindowCounts(y * this->nColumns + x, player, true);
+	}
+
+	if (this->useBitBoard)
+	{
+		this->bitBoard.dropToken(x, player);
+	}
+	else
+	{
+		this->cells[y * this->nColumns + x] = token;
+	}
+
+	this->columnHeights[x]++;
+	this->nTokens++;
+
+	this->toggleHashKeys(x, y, token);
+	this->updateWinningCells(x, y);
 }
 
 /**
@@ -93,13 +235,34 @@ void Board::removeToken(unsigned int x)
 		throw std::runtime_error("Cannot remove token, column is already empty.");
 	}
 
-	for (unsigned int i = 0; i < this->nRows; ++i)
+	this->columnHeights[x]--;
+	this->nTokens--;
+
+	unsigned int y = this->nRows - 1 - this->columnHeights[x];
+	TokenType token = this->useBitBoard ? this->playerTokens[this->bitBoard.getCell(x, y)]
+	                                    : this->cells[y * this->nColumns + x];
+
+	this->toggleHashKeys(x, y, token);
+
+	if (this->useBitBoard)
 	{
-		if (this->isCellOccupied(x, i))
-		{
-			this->setCell(x, i, Board::CELL_EMPTY);
-			break;
-		}
+		this->bitBoard.removeToken(x);
+	}
+	else
+	{
+		this->cells[y * this->nColumns + x] = Board::CELL_EMPTY;
+	}
+
+	if (this->useWindowCounting)
+	{
+		this->changeWindowCounts(y * this->nColumns + x, this->getPlayerIndex(token), false);
+	}
+
+	// Winning cells that don't contain the removed token are still winning cells.
+
+	if (this->winningCells.state == WinningCellsState::FOUND && this->containsWinningCell(x, y))
+	{
+		this->winningCells.state = WinningCellsState::UNKNOWN;
 	}
 }
 
@@ -125,42 +288,171 @@ void Board::removeToken(unsigned int x, unsigned int y)
 		this->swapCells(x, y - 1, x, y);
 		y--;
 	}
+
+	this->columnHeights[x]--;
+	this->nTokens--;
+
+	// Falling tokens can create and destroy any number of lines, scan the board again when needed.
+
+	this->winningCells.state = WinningCellsState::UNKNOWN;
+	this->nOutdatedMoves = this->moveStack.size();
+
+	this->rebuildHashKeys();
+
+	if (this->useWindowCounting)
+	{
+		this->rebuildWindowCounts();
+	}
 }
 
 /**
- * @copydoc ::Game::Board::isColumnFull()
+ * Makes a move, i.e. drops the given token into the given column and remembers the move so that
+ * it can be undone with unmakeMove().
+ *
+ * The cached winning cells are remembered too, so unmakeMove() never has to scan the board.
  *
- * This method is optimized for four in a line, because in this game it is only necessary to check
- * the top cell to see whether a column is full.
+ * @param x Position of the column on the x axis.
+ * @param token The token.
+ * @see Board::unmakeMove() To undo the move.
  */
-bool Board::isColumnFull(unsigned int x) const
+void Board::makeMove(unsigned int x, ::GameLogic::Board::TokenType token)
 {
-	bool result = true;
+	WinningCells previousWinningCells = this->winningCells;
+
+	this->dropToken(x, token);
+	this->moveStack.push_back(std::make_pair(x, previousWinningCells));
+}
 
-	if (this->isCellEmpty(x, 0))
+/**
+ * Undoes the last move made with makeMove(), i.e. removes the token from the top of the column.
+ */
+void Board::unmakeMove()
+{
+	if (this->moveStack.empty())
 	{
-		result = false;
+		throw std::runtime_error("There is no move to unmake.");
 	}
 
-	return result;
+	this->removeToken(this->moveStack.back().first);
+
+	if (this->moveStack.size() > this->nOutdatedMoves)
+	{
+		this->winningCells = this->moveStack.back().second;
+	}
+	else
+	{
+		this->winningCells.state = WinningCellsState::UNKNOWN;
+		this->nOutdatedMoves--;
+	}
+
+	this->moveStack.pop_back();
+}
+
+/**
+ * @copydoc ::Game::Board::isColumnFull()
+ *
+ * This method is optimized for four in a line, it only compares the column height with the
+ * number of rows.
+ */
+bool Board::isColumnFull(unsigned int x) const
+{
+	return this->getColumnHeight(x) == this->nRows;
 }
 
 /**
  * @copydoc ::Game::Board::isColumnEmpty()
  *
- * This method is optimized for four in a line, because in this game it is only necessary to check
- * the bottom cell to see whether a column is full.
+ * This method is optimized for four in a line, it only checks whether the column height is 0.
  */
 bool Board::isColumnEmpty(unsigned int x) const
 {
-	bool result = false;
+	return 0 == this->getColumnHeight(x);
+}
 
-	if (this->isCellEmpty(x, this->nRows - 1))
+/**
+ * @copydoc ::GameLogic::Board::isFull()
+ *
+ * This method is optimized for four in a line, it only compares the occupied cells of the bit board
+ * with all cells, or the number of tokens on the board with the number of cells.
+ */
+bool Board::isFull() const
+{
+	if (this->useBitBoard)
 	{
-		result = true;
+		return this->bitBoard.isFull();
 	}
 
-	return result;
+	return this->nTokens == this->nRows * this->nColumns;
+}
+
+/**
+ * @copydoc ::GameLogic::Board::isEmpty()
+ *
+ * This method is optimized for four in a line, it only checks whether the number of tokens on the
+ * board is 0.
+ */
+bool Board::isEmpty() const
+{
+	return 0 == this->nTokens;
+}
+
+/**
+ * @copydoc ::GameLogic::Board::getCell()
+ *
+ * Reads the cell from the bit board when the board is stored in it.
+ */
+::GameLogic::Board::TokenType Board::getCell(unsigned int x, unsigned int y) const
+{
+	this->checkPosition(x, y);
+
+	return this->getToken(y * this->nColumns + x);
+}
+
+/**
+ * @copydoc ::GameLogic::Board::setCell()
+ *
+ * Writes the cell into the bit board when the board is stored in it. A token of a third player moves
+ * the cells into the cell vector. This does not update the column heights, the hash keys, the window
+ * counts or the cached winning cells, the caller has to do this.
+ */
+void Board::setCell(unsigned int x, unsigned int y, ::GameLogic::Board::TokenType token)
+{
+	if (this->useBitBoard)
+	{
+		this->checkPosition(x, y);
+
+		int player = this->getPlayerIndex(token);
+
+		if (token == Board::CELL_EMPTY || player >= 0)
+		{
+			this->bitBoard.clearCell(x, y);
+
+			if (player >= 0)
+			{
+				this->bitBoard.setCell(x, y, player);
+			}
+
+			return;
+		}
+
+		this->useWindowCounting = false;
+		this->switchToCells();
+	}
+
+	::GameLogic::Board::setCell(x, y, token);
+}
+
+/**
+ * Returns the number of tokens in the given column.
+ *
+ * @param x Position of the column on the x axis.
+ * @return Number of tokens in the column.
+ */
+unsigned int Board::getColumnHeight(unsigned int x) const
+{
+	this->checkPosition(x, 0);
+
+	return this->columnHeights[x];
 }
 
 /**
@@ -172,61 +464,565 @@ std::vector<unsigned int> Board::getAvailableColumns() const
 {
 	std::vector<unsigned int> columns;
 
-	for(unsigned int i = 0; i < this->nColumns; ++i)
+	for (unsigned int column : this->getAvailableColumnsRange())
 	{
-		if (this->canDropToken(i))
-		{
-			columns.push_back(i);
-		}
+		columns.push_back(column);
 	}
 
 	return columns;
 }
 
+/**
+ * Returns a range of all columns in which a token can be dropped.
+ *
+ * In contrast to getAvailableColumns() this does not allocate memory.
+ *
+ * @return Range of the columns in which a token can be dropped.
+ */
+AvailableColumns Board::getAvailableColumnsRange() const
+{
+	return AvailableColumns(this);
+}
+
 /**
  * Finds and returns the cells that won the game.
  *
+ * Returns the cached result when it is known, otherwise the whole board is scanned once.
+ *
  * @return Cell set referencing the winning cells or empty cell set if game isn't won yet.
  */
 CellSet Board::findWinningCells() const
+{
+	if (this->winningCells.state == WinningCellsState::UNKNOWN)
+	{
+		CellSet result = this->scanForWinningCells();
+
+		if (result.isEmpty())
+		{
+			this->winningCells.state = WinningCellsState::NONE;
+		}
+		else
+		{
+			this->winningCells.state = WinningCellsState::FOUND;
+			this->winningCells.startX = result.getCellXPosition(0);
+			this->winningCells.startY = result.getCellYPosition(0);
+			this->winningCells.deltaX = result.getDeltaX();
+			this->winningCells.deltaY = result.getDeltaY();
+		}
+
+		return result;
+	}
+
+	if (this->winningCells.state == WinningCellsState::FOUND)
+	{
+		return CellSet(this, this->winningCells.startX, this->winningCells.startY,
+		               this->winningCells.deltaX, this->winningCells.deltaY, 4);
+	}
+
+	return CellSet();
+}
+
+/**
+ * Scans the whole board for cells that won the game.
+ *
+ * In contrast to findWinningCells() this method ignores the cached result, it is slower but does
+ * not depend on the history of the board.
+ *
+ * @return Cell set referencing the winning cells or empty cell set if game isn't won yet.
+ */
+CellSet Board::scanForWinningCells() const
 {
 	CellSet result;
-	auto sets = this->getAllRows();
-	std::vector<CellSet>::const_iterator i;
-	unsigned int nConsecutive = 1;
-	::GameLogic::Board::TokenType lastToken;
-	auto emptyToken = this->getEmptyToken();
 
-	for (i = sets.begin(); i != sets.end() && nConsecutive != 4; i++)
+	if (this->useBitBoard && !this->bitBoard.hasWon(0) && !this->bitBoard.hasWon(1))
 	{
-		nConsecutive = 1;
-		lastToken = emptyToken;
+		return result;
+	}
 
-		for(CellSetIterator j = i->begin(); j != i->end(); j++)
-		{
-			if (lastToken == *j && emptyToken != *j)
-			{
-				nConsecutive++;
-			}
-			else
-			{
-				lastToken = *j;
-				nConsecutive = 1;
-			}
+	// The windows are ordered like the rows returned by getAllRows(), so the first window
+	// containing four equal tokens is the first four in a line in these rows.
 
-			if (nConsecutive == 4)
-			{
-				unsigned int startX = i->getCellXPosition(j.getIndex() - 3);
-				unsigned int startY = i->getCellYPosition(j.getIndex() - 3);
+	const WindowTable& windows = *this->windowTable;
+	unsigned int nWindows = windows.getNumberOfWindows();
 
-				result = CellSet(this, startX, startY, i->getDeltaX(), i->getDeltaY(), 4);
-				break;
-			}
+	for (unsigned int window = 0; window < nWindows; ++window)
+	{
+		const unsigned int* cells = windows.getWindowCells(window);
+		TokenType token = this->getToken(cells[0]);
+
+		if (token != Board::CELL_EMPTY && this->getToken(cells[1]) == token &&
+		    this->getToken(cells[2]) == token && this->getToken(cells[3]) == token)
+		{
+			result = CellSet(this, cells[0] % this->nColumns, cells[0] / this->nColumns,
+			                 windows.getWindowDeltaX(window), windows.getWindowDeltaY(window), 4);
+			break;
 		}
 	}
 
 	return result;
 }
 
+/**
+ * Returns the window table of the board geometry.
+ *
+ * @return The window table.
+ */
+const WindowTable& Board::getWindowTable() const
+{
+	return *this->windowTable;
+}
+
+/**
+ * Returns the content of the cell with the given index.
+ *
+ * The cell at position x/y has the index y * number of columns + x, the same index the
+ * WindowTable uses.
+ *
+ * @param cell Index of the cell.
+ * @return The token in the cell (can be an empty token).
+ */
+::GameLogic::Board::TokenType Board::getCellByIndex(unsigned int cell) const
+{
+	if (cell >= this->nColumns * this->nRows)
+	{
+		throw std::out_of_range("Cell index is greater or equal the number of cells.");
+	}
+
+	return this->getToken(cell);
+}
+
+/**
+ * Returns whether the cells are stored in a bit board, which is the case when the board fits into a
+ * bit board and contains tokens of at most two different players.
+ *
+ * @return When the cells are stored in a bit board true, otherwise false.
+ */
+bool Board::isBitBoardUsed() const
+{
+	return this->useBitBoard;
+}
+
+/**
+ * Returns the hash key of the board.
+ *
+ * The hash key is a Zobrist key, i.e. the XOR of a pseudo random key for every occupied cell and
+ * token and a key for the board geometry. It is updated incrementally when tokens are dropped or
+ * removed. Equal boards always have the same hash key, different boards have different hash keys
+ * with a very high probability. The keys are deterministic, they are the same in every run.
+ *
+ * @return Hash key of the board.
+ */
+std::uint64_t Board::getHashKey() const
+{
+	return this->hashKey;
+}
+
+/**
+ * Returns the hash key of the mirrored board.
+ *
+ * This is the hash key the board would have if every column x were moved to column
+ * nColumns - 1 - x. Mirrored positions are equivalent in four in a line, use getCanonicalHashKey()
+ * to retrieve a key which is the same for a board and its mirror image.
+ *
+ * @return Hash key of the mirrored board.
+ */
+std::uint64_t Board::getMirroredHashKey() const
+{
+	return this->mirroredHashKey;
+}
+
+/**
+ * Returns a hash key that is the same for the board and its mirror image.
+ *
+ * This is the smaller one of getHashKey() and getMirroredHashKey().
+ *
+ * @return Canonical hash key of the board.
+ */
+std::uint64_t Board::getCanonicalHashKey() const
+{
+	return std::min(this->hashKey, this->mirroredHashKey);
+}
+
+/**
+ * Returns whether the board is mirrored to get its canonical hash key.
+ *
+ * Columns of the board have to be mirrored (x becomes nColumns - 1 - x) to match information stored
+ * for the canonical hash key when this returns true.
+ *
+ * @return When getCanonicalHashKey() is the mirrored hash key true, otherwise false.
+ */
+bool Board::isCanonicalHashKeyMirrored() const
+{
+	return this->mirroredHashKey < this->hashKey;
+}
+
+/**
+ * Returns whether the board counts the tokens in the windows, which is the case as long as the board
+ * contains tokens of at most two different players.
+ *
+ * @return When the windows are counted true, otherwise false.
+ */
+bool Board::isWindowCountingUsed() const
+{
+	return this->useWindowCounting;
+}
+
+/**
+ * Returns the number of windows which contain the given number of tokens of the given player and no
+ * tokens of another player.
+ *
+ * Takes constant time, the counts are updated whenever a token is dropped or removed.
+ *
+ * @param token The token of the player.
+ * @param nTokens Number of tokens of the player in the window, from 1 to WindowTable::WINDOW_SIZE.
+ * @return Number of open windows with the given number of tokens.
+ * @see Board::isWindowCountingUsed() To check whether the windows are counted.
+ */
+unsigned int Board::getNumberOfOpenWindows(::GameLogic::Board::TokenType token,
+                                           unsigned int nTokens) const
+{
+	if (!this->useWindowCounting)
+	{
+		throw std::runtime_error("The windows are not counted, the board contains more than two different tokens.");
+	}
+
+	if (nTokens == 0 || nTokens > WindowTable::WINDOW_SIZE)
+	{
+		throw std::out_of_range("Number of tokens must be between 1 and the window size.");
+	}
+
+	for (unsigned int player = 0; player < 2; ++player)
+	{
+		if (token != Board::CELL_EMPTY && this->playerTokens[player] == token)
+		{
+			return this->nOpenWindows[player * (WindowTable::WINDOW_SIZE + 1) + nTokens];
+		}
+	}
+
+	// The player has no tokens on the board.
+
+	return 0;
+}
+
+/**
+ * Updates the cached winning cells after a token was dropped at the given position.
+ *
+ * Only the lines through the new token can contain new winning cells, so only these are checked.
+ *
+ * @param x Position of the new token on the x axis.
+ * @param y Position of the new token on the y axis.
+ */
+void Board::updateWinningCells(unsigned int x, unsigned int y)
+{
+	// When winning cells were found they are still there, when the result is unknown it stays
+	// unknown.
+
+	if (this->winningCells.state != WinningCellsState::NONE)
+	{
+		return;
+	}
+
+	// There were no winning cells, so the masks only contain four in a line when the new token
+	// completed one. Most tokens don't, only then the lines through the token are checked.
+
+	if (this->useBitBoard && !this->bitBoard.hasWon(this->bitBoard.getCell(x, y)))
+	{
+		return;
+	}
+
+	if (this->findWinningCellsThrough(x, y, this->winningCells))
+	{
+		this->winningCells.state = WinningCellsState::FOUND;
+	}
+}
+
+/**
+ * Searches the windows containing the given cell for four tokens of the same player.
+ *
+ * The windows are checked in the same order as scanForWinningCells() checks them, the first cell
+ * of the result is the first cell of the window.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ * @param result When winning cells were found, their position is stored here.
+ * @return When winning cells were found true, otherwise false.
+ */
+bool Board::findWinningCellsThrough(unsigned int x, unsigned int y, WinningCells& result) const
+{
+	unsigned int cell = y * this->nColumns + x;
+	TokenType token = this->getToken(cell);
+
+	if (token == Board::CELL_EMPTY)
+	{
+		return false;
+	}
+
+	const WindowTable& windows = *this->windowTable;
+	const unsigned int* cellWindows = windows.getWindowsContaining(cell);
+	unsigned int nCellWindows = windows.getNumberOfWindowsContaining(cell);
+
+	for (unsigned int i = 0; i < nCellWindows; ++i)
+	{
+		const unsigned int* cells = windows.getWindowCells(cellWindows[i]);
+
+		if (this->getToken(cells[0]) == token && this->getToken(cells[1]) == token &&
+		    this->getToken(cells[2]) == token && this->getToken(cells[3]) == token)
+		{
+			result.startX = cells[0] % this->nColumns;
+			result.startY = cells[0] / this->nColumns;
+			result.deltaX = windows.getWindowDeltaX(cellWindows[i]);
+			result.deltaY = windows.getWindowDeltaY(cellWindows[i]);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Returns whether the given cell is one of the cached winning cells.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ * @return When the cell is a winning cell true, otherwise false.
+ */
+bool Board::containsWinningCell(unsigned int x, unsigned int y) const
+{
+	if (this->winningCells.state != WinningCellsState::FOUND)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < 4; ++i)
+	{
+		int cellX = static_cast<int>(this->winningCells.startX) + i * this->winningCells.deltaX;
+		int cellY = static_cast<int>(this->winningCells.startY) + i * this->winningCells.deltaY;
+
+		if (cellX == static_cast<int>(x) && cellY == static_cast<int>(y))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Returns the player index (used by the window counts) that represents the given token.
+ *
+ * Assigns the token to a free player index if it is not assigned yet.
+ *
+ * @param token The token.
+ * @return Player index (0 or 1) or -1 when both player indices are assigned to other tokens.
+ */
+int Board::getPlayerIndex(::GameLogic::Board::TokenType token)
+{
+	if (token == Board::CELL_EMPTY)
+	{
+		return -1;
+	}
+
+	for (unsigned int player = 0; player < 2; ++player)
+	{
+		if (this->playerTokens[player] == token)
+		{
+			return player;
+		}
+
+		if (this->playerTokens[player] == Board::CELL_EMPTY)
+		{
+			this->playerTokens[player] = token;
+			return player;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * Returns the token in the cell with the given index, from the bit board or the cell vector.
+ *
+ * @param cell Index of the cell (y * nColumns + x).
+ * @return The token in the cell (can be an empty token).
+ */
+::GameLogic::Board::TokenType Board::getToken(unsigned int cell) const
+{
+	if (!this->useBitBoard)
+	{
+		return this->cells[cell];
+	}
+
+	int player = this->bitBoard.getCell(cell % this->nColumns, cell / this->nColumns);
+
+	return (player < 0) ? Board::CELL_EMPTY : this->playerTokens[player];
+}
+
+/**
+ * Moves the cells from the bit board into the cell vector, e.g. when a third kind of token is put
+ * on the board.
+ */
+void Board::switchToCells()
+{
+	std::vector<TokenType> tokens(this->nColumns * this->nRows);
+
+	for (unsigned int cell = 0; cell < tokens.size(); ++cell)
+	{
+		tokens[cell] = this->getToken(cell);
+	}
+
+	this->cells.swap(tokens);
+	this->useBitBoard = false;
+}
+
+/**
+ * Updates the window counts of all windows containing the given cell, after a token of the given
+ * player was added to or removed from the cell.
+ *
+ * @param cell Index of the cell (y * nColumns + x).
+ * @param player Player index (0 or 1) of the token.
+ * @param isTokenAdded When the token was added true, when it was removed false.
+ */
+void Board::changeWindowCounts(unsigned int cell, unsigned int player, bool isTokenAdded)
+{
+	unsigned int otherPlayer = 1 - player;
+	unsigned int* playerWindows = &this->nOpenWindows[player * (WindowTable::WINDOW_SIZE + 1)];
+	unsigned int* otherPlayerWindows = &this->nOpenWindows[otherPlayer * (WindowTable::WINDOW_SIZE + 1)];
+	unsigned int nWindows = this->windowTable->getNumberOfWindowsContaining(cell);
+	const unsigned int* windows = this->windowTable->getWindowsContaining(cell);
+
+	for (unsigned int i = 0; i < nWindows; ++i)
+	{
+		std::uint8_t* counts = &this->windowTokenCounts[2 * windows[i]];
+		unsigned int nPlayerTokens = counts[player];
+		unsigned int nOtherPlayerTokens = counts[otherPlayer];
+
+		// A window is open for a player as long as the other player has no token in it, so only
+		// the open windows of a player without tokens of the other player change.
+
+		if (nOtherPlayerTokens == 0)
+		{
+			playerWindows[nPlayerTokens]--;
+		}
+
+		if (nPlayerTokens == 0)
+		{
+			otherPlayerWindows[nOtherPlayerTokens]--;
+		}
+
+		nPlayerTokens = isTokenAdded ? nPlayerTokens + 1 : nPlayerTokens - 1;
+		counts[player] = static_cast<std::uint8_t>(nPlayerTokens);
+
+		if (nOtherPlayerTokens == 0)
+		{
+			playerWindows[nPlayerTokens]++;
+		}
+
+		if (nPlayerTokens == 0)
+		{
+			otherPlayerWindows[nOtherPlayerTokens]++;
+		}
+	}
+}
+
+/**
+ * Rebuilds the window counts from the cells.
+ */
+void Board::rebuildWindowCounts()
+{
+	unsigned int nWindows = this->windowTable->getNumberOfWindows();
+
+	this->windowTokenCounts.assign(2 * nWindows, 0);
+	this->nOpenWindows.assign(2 * (WindowTable::WINDOW_SIZE + 1), 0);
+
+	// On the empty board, all windows are open for both players.
+
+	this->nOpenWindows[0] = nWindows;
+	this->nOpenWindows[WindowTable::WINDOW_SIZE + 1] = nWindows;
+
+	for (unsigned int cell = 0; cell < this->nColumns * this->nRows; ++cell)
+	{
+		TokenType token = this->getToken(cell);
+
+		if (token != Board::CELL_EMPTY)
+		{
+			this->changeWindowCounts(cell, (token == this->playerTokens[0]) ? 0 : 1, true);
+		}
+	}
+}
+
+/**
+ * Mixes the bits of the given value, this is the finalizer of the SplitMix64 generator.
+ *
+ * @param value The value to mix.
+ * @return Pseudo random value.
+ */
+std::uint64_t Board::mixHashKey(std::uint64_t value)
+{
+	value += 0x9e3779b97f4a7c15ULL;
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+
+	return value ^ (value >> 31);
+}
+
+/**
+ * Returns the hash key of the empty board, which depends on the board geometry only.
+ *
+ * @return Hash key of the empty board.
+ */
+std::uint64_t Board::getEmptyBoardHashKey() const
+{
+	return Board::mixHashKey((static_cast<std::uint64_t>(this->nColumns) << 32) | this->nRows);
+}
+
+/**
+ * Returns the Zobrist key of the given token in the given cell.
+ *
+ * @param cell Index of the cell (y * nColumns + x).
+ * @param token The token.
+ * @return Key of the token in the cell.
+ */
+std::uint64_t Board::getCellHashKey(unsigned int cell, ::GameLogic::Board::TokenType token)
+{
+	return Board::mixHashKey((static_cast<std::uint64_t>(token) << 32) ^ (cell + 1));
+}
+
+/**
+ * Adds the given token at the given position to the hash keys, or removes it when it is already
+ * contained in the hash keys.
+ *
+ * @param x Position of the cell on the x axis.
+ * @param y Position of the cell on the y axis.
+ * @param token The token.
+ */
+void Board::toggleHashKeys(unsigned int x, unsigned int y, ::GameLogic::Board::TokenType token)
+{
+	this->hashKey ^= Board::getCellHashKey(y * this->nColumns + x, token);
+	this->mirroredHashKey ^= Board::getCellHashKey(y * this->nColumns + (this->nColumns - 1 - x), token);
+}
+
+/**
+ * Rebuilds the hash keys from the cells.
+ */
+void Board::rebuildHashKeys()
+{
+	this->hashKey = this->getEmptyBoardHashKey();
+	this->mirroredHashKey = this->hashKey;
+
+	for (unsigned int y = 0; y < this->nRows; ++y)
+	{
+		for (unsigned int x = 0; x < this->nColumns; ++x)
+		{
+			TokenType token = this->getToken(y * this->nColumns + x);
+
+			if (token != Board::CELL_EMPTY)
+			{
+				this->toggleHashKeys(x, y, token);
+			}
+		}
+	}
+}
+
 }
 }
@@ -3,8 +3,14 @@
 
 #include "../CellSet.hpp"
 #include "../Board.hpp"
+#include "AvailableColumns.hpp"
+#include "BitBoard.hpp"
+#include "WindowTable.hpp"
 
 #include <vector>
+#include <utility>
+#include <memory>
+#include <cstdint>
 
 namespace GameLogic
 {
@@ -26,12 +32,49 @@ namespace FourInALine
  * above the removed token will fall down, this can be used to implement special game modes or for
  * an undo functionality.
  *
+ * The board keeps track of the number of tokens in every column, so dropping/removing tokens and
+ * checking whether a column or the whole board is full takes constant time. The height of a column
+ * can be retrieved with getColumnHeight(column).
+ *
+ * Boards which fit into a BitBoard (every size selectable in the user interface) store their cells
+ * in its masks, one mask per player, the cell vector of ::GameLogic::Board is only used by bigger
+ * boards. Whether a token can be dropped, whether the board is full and whether a dropped token
+ * completed four in a line are then checked with a few shifts and ANDs. The masks can only store
+ * the tokens of two players, when a third kind of token is put on the board, the cells are moved
+ * into the cell vector until the board is cleared. Use isBitBoardUsed() to check where the cells
+ * are stored. Use getAvailableColumns() to retrieve the columns
+ * in which a token can be dropped in a vector, or getAvailableColumnsRange() to iterate over them
+ * without allocating memory.
+ *
  * The content of a cell can be retrieved with getCell(row, column). To determine if the game was
  * won, or to evaluate moves for an artificial intelligence, it is often necessary to iterate over
  * all horizontal/vertical/diagonal rows. This is easily possible with the getRow()/getColumn()
  * methods for horizontal/vertical rows and the getMajorDiagonal()/getMinorDiagonal() methods for
  * diagonal rows. Use getAllRows() to retrieve all horizontal/vertical/diagonal rows in a vector.
  *
+ * Every board shares the WindowTable of its geometry, which contains all windows of 4 cells in which
+ * a player can win. getWindowTable() together with getCellByIndex() allows to iterate over the
+ * windows using plain cell indices, without creating CellSet objects.
+ *
+ * The board maintains a Zobrist hash key, which is updated incrementally whenever a token is
+ * dropped or removed, and the hash key of its mirror image. Use getHashKey() or
+ * getCanonicalHashKey() (which is the same for mirrored boards) to identify positions, e.g. in a
+ * transposition table.
+ *
+ * The result of findWinningCells() is cached. Whenever a token is dropped, only the four lines
+ * through the new token are checked, so finding the winning cells takes constant time even on big
+ * boards. With the bit board, the lines are only checked when the masks show that the token completed
+ * four in a line. makeMove()/unmakeMove() also save and restore the cached result. Only when the cache
+ * becomes invalid (e.g. after tokens fell down because of removeToken(x, y)) the whole board is
+ * scanned again. Use scanForWinningCells() to force a scan of the whole board.
+ *
+ * As long as the board contains tokens of at most two different players, it also counts for every
+ * window how many tokens of each player it contains. From these counts it maintains the number of
+ * open windows of each player, i.e. windows containing 1, 2, 3 or 4 tokens of the player and no
+ * tokens of the other player. getNumberOfOpenWindows() returns them in constant time, which allows
+ * to evaluate a board without iterating over all windows. Use isWindowCountingUsed() to check
+ * whether the counts are available.
+ *
  * This class is reentrant but not thread-safe.
  */
 class Board : public ::GameLogic::Board
@@ -46,21 +89,189 @@ class Board : public ::GameLogic::Board
 		Board(const Board& board);
 		virtual ~Board();
 
+		Board& operator=(const Board& board);
+
+		virtual void clear() override;
+
 		bool canDropToken(unsigned int x) const;
 		void dropToken(unsigned int x, ::GameLogic::Board::TokenType token);
 		void removeToken(unsigned int x);
 		void removeToken(unsigned int x, unsigned int y);
 
+		void makeMove(unsigned int x, ::GameLogic::Board::TokenType token);
+		void unmakeMove();
+
 		virtual bool isColumnFull(unsigned int x) const override;
 		virtual bool isColumnEmpty(unsigned int x) const override;
 
+		virtual bool isFull() const override;
+		virtual bool isEmpty() const override;
+
+		virtual ::GameLogic::Board::TokenType getCell(unsigned int x, unsigned int y) const override;
+
+		unsigned int getColumnHeight(unsigned int x) const;
+
 		std::vector<unsigned int> getAvailableColumns() const;
+		AvailableColumns getAvailableColumnsRange() const;
 
 		CellSet findWinningCells() const;
+		CellSet scanForWinningCells() const;
+
+		const WindowTable& getWindowTable() const;
+		::GameLogic::Board::TokenType getCellByIndex(unsigned int cell) const;
+
+		bool isBitBoardUsed() const;
+
+		std::uint64_t getHashKey() const;
+		std::uint64_t getMirroredHashKey() const;
+		std::uint64_t getCanonicalHashKey() const;
+		bool isCanonicalHashKeyMirrored() const;
+
+		bool isWindowCountingUsed() const;
+		unsigned int getNumberOfOpenWindows(::GameLogic::Board::TokenType token,
+		                                    unsigned int nTokens) const;
 
 	protected:
-		using ::GameLogic::Board::setCell;
+		virtual void setCell(unsigned int x, unsigned int y, ::GameLogic::Board::TokenType token) override;
 		using ::GameLogic::Board::swapCells;
+
+	private:
+		/**
+		 * State of the cached winning cells.
+		 */
+		enum class WinningCellsState
+		{
+			UNKNOWN, ///< The board has to be scanned to know whether there are winning cells.
+			NONE,    ///< There are no winning cells.
+			FOUND    ///< Winning cells were found.
+		};
+
+		/**
+		 * Cached result of the search for winning cells.
+		 */
+		struct WinningCells
+		{
+			/**
+			 * Whether winning cells were found or the result is unknown.
+			 */
+			WinningCellsState state;
+
+			/**
+			 * Position of the first winning cell on the x axis.
+			 */
+			unsigned int startX;
+
+			/**
+			 * Position of the first winning cell on the y axis.
+			 */
+			unsigned int startY;
+
+			/**
+			 * Difference on the x axis to the next winning cell.
+			 */
+			int deltaX;
+
+			/**
+			 * Difference on the y axis to the next winning cell.
+			 */
+			int deltaY;
+		};
+
+		void updateWinningCells(unsigned int x, unsigned int y);
+		bool findWinningCellsThrough(unsigned int x, unsigned int y, WinningCells& result) const;
+		bool containsWinningCell(unsigned int x, unsigned int y) const;
+
+		static std::uint64_t mixHashKey(std::uint64_t value);
+		static std::uint64_t getCellHashKey(unsigned int cell, ::GameLogic::Board::TokenType token);
+		std::uint64_t getEmptyBoardHashKey() const;
+		void toggleHashKeys(unsigned int x, unsigned int y, ::GameLogic::Board::TokenType token);
+		void rebuildHashKeys();
+
+		int getPlayerIndex(::GameLogic::Board::TokenType token);
+
+		::GameLogic::Board::TokenType getToken(unsigned int cell) const;
+		void switchToCells();
+
+		void changeWindowCounts(unsigned int cell, unsigned int player, bool isTokenAdded);
+		void rebuildWindowCounts();
+
+		/**
+		 * Whether the cells are stored in the bit board instead of the cell vector.
+		 */
+		bool useBitBoard;
+
+		/**
+		 * Cells of boards which fit into a bit board, empty for bigger boards.
+		 */
+		BitBoard bitBoard;
+
+		/**
+		 * Number of tokens in every column.
+		 */
+		std::vector<unsigned int> columnHeights;
+
+		/**
+		 * Number of tokens on the board.
+		 */
+		unsigned int nTokens;
+
+		/**
+		 * Tokens represented by the players of the window counts (index 0 and 1), CELL_EMPTY when
+		 * the player is not assigned to a token yet.
+		 */
+		::GameLogic::Board::TokenType playerTokens[2];
+
+		/**
+		 * Windows of the board geometry, shared with all other boards of this geometry.
+		 */
+		std::shared_ptr<const WindowTable> windowTable;
+
+		/**
+		 * Whether the window counts are kept in sync with the cells.
+		 */
+		bool useWindowCounting;
+
+		/**
+		 * Number of tokens of both players (index 0 and 1) in every window, 2 entries per window.
+		 */
+		std::vector<std::uint8_t> windowTokenCounts;
+
+		/**
+		 * Number of windows containing n tokens of a player and no tokens of the other player, the
+		 * entry player * (WindowTable::WINDOW_SIZE + 1) + n is used for player 0 and 1.
+		 */
+		std::vector<unsigned int> nOpenWindows;
+
+		/**
+		 * Cached winning cells.
+		 *
+		 * Mutable so that findWinningCells() can stay const.
+		 */
+		mutable WinningCells winningCells;
+
+		/**
+		 * Moves made with makeMove() which were not unmade yet.
+		 *
+		 * The first element of the pair is the column, the second element the winning cells before
+		 * the move was made.
+		 */
+		std::vector<std::pair<unsigned int, WinningCells> > moveStack;
+
+		/**
+		 * Number of moves at the bottom of the move stack whose saved winning cells are outdated,
+		 * because the board was changed with removeToken(x, y) after they were made.
+		 */
+		std::size_t nOutdatedMoves;
+
+		/**
+		 * Zobrist hash key of the board.
+		 */
+		std::uint64_t hashKey;
+
+		/**
+		 * Zobrist hash key of the mirrored board.
+		 */
+		std::uint64_t mirroredHashKey;
 };
 
 }
@@ -1,11 +1,39 @@
 include(../../Defines.pri)
 
 SOURCES += Board.cpp \
+           BitBoard.cpp \
+           AvailableColumns.cpp \
+           WindowTable.cpp \
+           TranspositionTable.cpp \
+           MoveOrdering.cpp \
+           SearchWorker.cpp \
+           OpeningBook.cpp \
+           OpeningBookGenerator.cpp \
+           Solver.cpp \
+           Tablebase.cpp \
+           TablebaseGenerator.cpp \
+           Tournament.cpp \
+           MonteCarloTreeSearch.cpp \
+           SearchArena.cpp \
            Game.cpp \
            ArtificialIntelligence.cpp \  
     AAI.cpp
 
 HEADERS += Board.hpp \
+           BitBoard.hpp \
+           AvailableColumns.hpp \
+           WindowTable.hpp \
+           TranspositionTable.hpp \
+           MoveOrdering.hpp \
+           SearchWorker.hpp \
+           OpeningBook.hpp \
+           OpeningBookGenerator.hpp \
+           Solver.hpp \
+           Tablebase.hpp \
+           TablebaseGenerator.hpp \
+           Tournament.hpp \
+           MonteCarloTreeSearch.hpp \
+           SearchArena.hpp \
            Game.hpp \
            ArtificialIntelligence.hpp \
     AAI.hpp
@@ -129,7 +129,7 @@ void Game::makeMove(unsigned int column)
 		throw std::runtime_error("Not possible to make move.");
 	}
 
-	this->board->dropToken(column, this->currentPlayer);
+	this->board->makeMove(column, this->currentPlayer);
 	this->moves.push_back(std::make_pair(this->currentPlayer, column));
 
 	this->currentPlayer = (this->currentPlayer == Game::PLAYER_ONE) ? Game::PLAYER_TWO : Game::PLAYER_ONE;
@@ -225,10 +225,9 @@ void Game::undoLastMove()
 		{
 			// Just undo the last move.
 
-			std::pair<Game::PlayerType, unsigned int> lastMove = this->moves.back();
 			this->moves.pop_back();
 
-			this->board->removeToken(lastMove.second);
+			this->board->unmakeMove();
 			this->currentPlayer = (this->currentPlayer == Game::PLAYER_ONE) ? Game::PLAYER_TWO : Game::PLAYER_ONE;
 		}
 
@@ -341,6 +340,9 @@ void Game::setTimeoutAction(Game::TimeoutAction action)
 /**
  * Computes and returns the x/y coordinates of the token dropped in the given move.
  *
+ * Uses the column heights of the board, so computing the position of the last move takes
+ * constant time.
+ *
  * @param moveNo Number of the move.
  * @return X/Y coordinates of the token.
  */
@@ -353,16 +355,19 @@ std::pair<unsigned int, unsigned int> Game::computeMovePosition(unsigned int mov
 
 	unsigned int x;
 	unsigned int y;
-	auto replay = this->getReplay();
+	const auto& replay = this->getReplay();
+
+	// The top token of the column belongs to the last move in that column, the token of the given
+	// move lies below the tokens dropped in the same column afterwards.
 
 	x = replay.at(moveNo).second;
-	y = this->board->getNumberOfRows() - 1;
+	y = this->board->getNumberOfRows() - this->board->getColumnHeight(x);
 
-	for (unsigned int i = 0; i < moveNo; ++i)
+	for (unsigned int i = moveNo + 1; i < replay.size(); ++i)
 	{
-		if (replay.at(i).second == x)
+		if (replay[i].second == x)
 		{
-			y--;
+			y++;
 		}
 	}
 
@@ -0,0 +1,834 @@
+#include "MonteCarloTreeSearch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const std::size_t MonteCarloTreeSearch::DEFAULT_NUMBER_OF_NODES = 1 << 20;
+const double MonteCarloTreeSearch::DEFAULT_EXPLORATION_CONSTANT = 1.0;
+
+/**
+ * Minimum number of nodes of the arena, enough for the children of the root of every board.
+ */
+static const std::size_t MINIMUM_NUMBER_OF_NODES = 1 << 16;
+
+/**
+ * Number of playouts of the calling thread between two calls of the stop function.
+ */
+static const unsigned int STOP_CHECK_INTERVAL = 64;
+
+/**
+ * Number of visits of a leaf, including the current visit, at which its children are created. The
+ * root is always expanded.
+ */
+static const std::uint32_t EXPANSION_THRESHOLD = 2;
+
+/**
+ * Result of a playout when the game ended in a draw, the other results are the index of the
+ * winner (0 for the player who makes the next move at the root, 1 for the other player).
+ */
+static const unsigned int DRAW_RESULT = 2;
+
+/**
+ * Expansion state of a node.
+ */
+enum class NodeState : std::uint8_t
+{
+	UNEXPANDED = 0, ///< The node has no children.
+	EXPANDING = 1,  ///< A thread is creating the children.
+	EXPANDED = 2    ///< The children were created.
+};
+
+/**
+ * Result of the move of a node when the game is over after it.
+ */
+enum class Outcome : std::uint8_t
+{
+	NOT_OVER = 0, ///< The game goes on.
+	DRAW = 1,     ///< The move filled the board.
+	WIN = 2       ///< The move completed four in a line.
+};
+
+/**
+ * Compact copy of a board used by the playouts.
+ *
+ * The players are identified by their index, 0 for the player who makes the next move at the root.
+ * The cells are stored column by column, y = 0 is the bottom row. Only the lines through a new
+ * token are checked, so a move costs the same on every board size.
+ */
+class MonteCarloTreeSearch::PlayoutBoard
+{
+	public:
+		/**
+		 * Creates a copy of the given board.
+		 *
+		 * @param board The board.
+		 * @param player The player who makes the next move, gets index 0.
+		 */
+		PlayoutBoard(const Board& board, PlayerType player)
+		    : nColumns(board.getNumberOfColumns()), nRows(board.getNumberOfRows()),
+		      cells(nColumns * nRows, 0), heights(nColumns, 0), nTokens(0), currentPlayer(0)
+		{
+			for (unsigned int x = 0; x < this->nColumns; ++x)
+			{
+				this->heights[x] = board.getColumnHeight(x);
+				this->nTokens += this->heights[x];
+
+				for (unsigned int y = 0; y < this->heights[x]; ++y)
+				{
+					this->cells[x * this->nRows + y] = (board.getCell(x, this->nRows - 1 - y) == player) ? 1 : 2;
+				}
+			}
+		}
+
+		/**
+		 * Returns the number of columns.
+		 *
+		 * @return Number of columns.
+		 */
+		unsigned int getNumberOfColumns() const
+		{
+			return this->nColumns;
+		}
+
+		/**
+		 * Returns the index of the player who makes the next move.
+		 *
+		 * @return 0 or 1.
+		 */
+		unsigned int getCurrentPlayer() const
+		{
+			return this->currentPlayer;
+		}
+
+		/**
+		 * Returns whether a token can be dropped into the given column.
+		 *
+		 * @param x Column index.
+		 * @return When the column is not full true, otherwise false.
+		 */
+		bool canDropToken(unsigned int x) const
+		{
+			return this->heights[x] < this->nRows;
+		}
+
+		/**
+		 * Returns whether the board is full after one more token.
+		 *
+		 * @return When only one cell is empty true, otherwise false.
+		 */
+		bool isLastEmptyCell() const
+		{
+			return this->nTokens + 1 == this->nColumns * this->nRows;
+		}
+
+		/**
+		 * Returns whether the board is full.
+		 *
+		 * @return When all cells are occupied true, otherwise false.
+		 */
+		bool isFull() const
+		{
+			return this->nTokens == this->nColumns * this->nRows;
+		}
+
+		/**
+		 * Returns the number of columns which are not full.
+		 *
+		 * @return Number of columns.
+		 */
+		unsigned int countAvailableColumns() const
+		{
+			unsigned int nAvailableColumns = 0;
+
+			for (unsigned int x = 0; x < this->nColumns; ++x)
+			{
+				nAvailableColumns += this->canDropToken(x) ? 1 : 0;
+			}
+
+			return nAvailableColumns;
+		}
+
+		/**
+		 * Returns whether a token of the given player dropped into the given column completes four
+		 * in a line.
+		 *
+		 * @param x Column index, the column must not be full.
+		 * @param player Index of the player.
+		 * @return When the move wins true, otherwise false.
+		 */
+		bool isWinningMove(unsigned int x, unsigned int player) const
+		{
+			static const int DIRECTIONS[4][2] = { { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, -1 } };
+			int y = this->heights[x];
+
+			for (const auto& direction : DIRECTIONS)
+			{
+				if (1 + this->countTokens(x, y, direction[0], direction[1], player) +
+				    this->countTokens(x, y, -direction[0], -direction[1], player) >= 4)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * Drops a token of the current player into the given column, then the other player makes
+		 * the next move.
+		 *
+		 * @param x Column index, the column must not be full.
+		 */
+		void dropToken(unsigned int x)
+		{
+			this->cells[x * this->nRows + this->heights[x]] = static_cast<std::uint8_t>(this->currentPlayer + 1);
+			this->heights[x]++;
+			this->nTokens++;
+			this->currentPlayer ^= 1;
+		}
+
+	private:
+		/**
+		 * Counts the consecutive tokens of the given player next to the given cell in the given
+		 * direction, up to 3.
+		 *
+		 * @param x Column index of the cell.
+		 * @param y Row index of the cell, 0 is the bottom row.
+		 * @param deltaX Step in x direction.
+		 * @param deltaY Step in y direction.
+		 * @param player Index of the player.
+		 * @return Number of tokens.
+		 */
+		unsigned int countTokens(int x, int y, int deltaX, int deltaY, unsigned int player) const
+		{
+			unsigned int nFound = 0;
+			std::uint8_t token = static_cast<std::uint8_t>(player + 1);
+
+			for (x += deltaX, y += deltaY; nFound < 3 && x >= 0 && y >= 0 &&
+			     x < static_cast<int>(this->nColumns) && y < static_cast<int>(this->nRows) &&
+			     this->cells[x * this->nRows + y] == token; x += deltaX, y += deltaY)
+			{
+				nFound++;
+			}
+
+			return nFound;
+		}
+
+		/**
+		 * Number of columns.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * The cells, 0 when empty, otherwise the index of the player plus one.
+		 */
+		std::vector<std::uint8_t> cells;
+
+		/**
+		 * Number of tokens of every column.
+		 */
+		std::vector<unsigned int> heights;
+
+		/**
+		 * Number of tokens on the board.
+		 */
+		unsigned int nTokens;
+
+		/**
+		 * Index of the player who makes the next move.
+		 */
+		unsigned int currentPlayer;
+};
+
+/**
+ * Creates a new tree search.
+ *
+ * The arena is allocated when the first position is searched.
+ *
+ * @param nNodes Number of nodes of the arena, at least 65536.
+ */
+MonteCarloTreeSearch::MonteCarloTreeSearch(std::size_t nNodes)
+    : nMaximumNodes(std::min<std::size_t>(std::max(nNodes, MINIMUM_NUMBER_OF_NODES),
+                                          std::numeric_limits<std::uint32_t>::max())),
+      nNodes(0), nStartedPlayouts(0), nFinishedPlayouts(0), nPlayoutLimit(0), isStopped(false),
+      nThreads(1), playoutPolicy(PlayoutPolicy::HEURISTIC),
+      explorationConstant(MonteCarloTreeSearch::DEFAULT_EXPLORATION_CONSTANT), seed(1)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+MonteCarloTreeSearch::~MonteCarloTreeSearch()
+{
+
+}
+
+/**
+ * Sets the function which is called periodically during a search.
+ *
+ * @param stopFunction Function returning true when the search has to end, it may throw an
+ *        exception to cancel the search.
+ */
+void MonteCarloTreeSearch::setStopFunction(MonteCarloTreeSearch::StopFunctionType stopFunction)
+{
+	this->stopFunction = stopFunction;
+}
+
+/**
+ * Sets the number of threads searching the tree.
+ *
+ * @param nThreads Number of threads, 0 for one thread per processor core.
+ */
+void MonteCarloTreeSearch::setNumberOfThreads(unsigned int nThreads)
+{
+	if (nThreads == 0)
+	{
+		nThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	this->nThreads = nThreads;
+}
+
+/**
+ * Returns the number of threads searching the tree.
+ *
+ * @return Number of threads.
+ */
+unsigned int MonteCarloTreeSearch::getNumberOfThreads() const
+{
+	return this->nThreads;
+}
+
+/**
+ * Sets how the moves of a playout are chosen.
+ *
+ * @param playoutPolicy The playout policy.
+ */
+void MonteCarloTreeSearch::setPlayoutPolicy(MonteCarloTreeSearch::PlayoutPolicy playoutPolicy)
+{
+	this->playoutPolicy = playoutPolicy;
+}
+
+/**
+ * Returns how the moves of a playout are chosen.
+ *
+ * @return The playout policy.
+ */
+MonteCarloTreeSearch::PlayoutPolicy MonteCarloTreeSearch::getPlayoutPolicy() const
+{
+	return this->playoutPolicy;
+}
+
+/**
+ * Sets the constant of the exploration term of UCT.
+ *
+ * The higher the constant, the more often moves with a low win rate are tried again.
+ *
+ * @param explorationConstant The constant, at least 0.
+ */
+void MonteCarloTreeSearch::setExplorationConstant(double explorationConstant)
+{
+	if (!(explorationConstant >= 0.0))
+	{
+		throw std::invalid_argument("The exploration constant must not be negative.");
+	}
+
+	this->explorationConstant = explorationConstant;
+}
+
+/**
+ * Returns the constant of the exploration term of UCT.
+ *
+ * @return The constant.
+ */
+double MonteCarloTreeSearch::getExplorationConstant() const
+{
+	return this->explorationConstant;
+}
+
+/**
+ * Sets the seed of the random moves.
+ *
+ * @param seed The seed.
+ */
+void MonteCarloTreeSearch::setSeed(unsigned int seed)
+{
+	this->seed = seed;
+}
+
+/**
+ * Searches the given board and returns the best move of the given player.
+ *
+ * The tree of the last search is discarded.
+ *
+ * @param board The board, at least one column must not be full.
+ * @param player The player who makes the next move.
+ * @param nPlayouts Maximum number of playouts, at least one playout is done.
+ * @return Column index of the most visited move.
+ */
+unsigned int MonteCarloTreeSearch::findBestMove(const Board& board, MonteCarloTreeSearch::PlayerType player,
+                                                unsigned long long nPlayouts)
+{
+	PlayoutBoard rootBoard(board, player);
+
+	if (rootBoard.countAvailableColumns() == 0)
+	{
+		throw std::runtime_error("There is no possible move.");
+	}
+
+	if (!this->nodes)
+	{
+		this->nodes.reset(new Node[this->nMaximumNodes]);
+	}
+
+	this->initializeNode(this->nodes[0], 0, static_cast<unsigned int>(Outcome::NOT_OVER));
+	this->nNodes = 1;
+	this->nStartedPlayouts = 0;
+	this->nFinishedPlayouts = 0;
+	this->nPlayoutLimit = std::max(1ull, nPlayouts);
+	this->isStopped = false;
+
+	std::vector<std::future<void> > helpers;
+
+	for (unsigned int thread = 1; thread < this->nThreads; ++thread)
+	{
+		helpers.push_back(std::async(std::launch::async, [this, &rootBoard, thread]()
+		{
+			this->runPlayouts(rootBoard, thread);
+		}));
+	}
+
+	try
+	{
+		this->runPlayouts(rootBoard, 0);
+	}
+	catch (...)
+	{
+		this->isStopped = true;
+
+		for (auto& helper : helpers)
+		{
+			helper.wait();
+		}
+
+		throw;
+	}
+
+	for (auto& helper : helpers)
+	{
+		helper.get();
+	}
+
+	return this->getMoveStatistics().front().column;
+}
+
+/**
+ * Returns the number of playouts of the last search.
+ *
+ * @return Number of playouts.
+ */
+unsigned long long MonteCarloTreeSearch::getNumberOfPlayouts() const
+{
+	return this->nFinishedPlayouts;
+}
+
+/**
+ * Returns the number of nodes of the tree of the last search.
+ *
+ * @return Number of nodes.
+ */
+std::size_t MonteCarloTreeSearch::getNumberOfNodes() const
+{
+	return std::min(this->nNodes.load(), this->nMaximumNodes);
+}
+
+/**
+ * Returns the memory used by the nodes of the tree of the last search.
+ *
+ * The arena itself has the size of the maximum number of nodes, it is allocated once.
+ *
+ * @return Number of bytes.
+ */
+std::size_t MonteCarloTreeSearch::getMemorySize() const
+{
+	return this->getNumberOfNodes() * sizeof(Node);
+}
+
+/**
+ * Returns the statistics of the moves of the root of the last search.
+ *
+ * @return Statistics of all possible moves, the most visited move first. Of several moves with the
+ *         same number of visits, the move closest to the center comes first.
+ */
+std::vector<MonteCarloTreeSearch::MoveStatistics> MonteCarloTreeSearch::getMoveStatistics() const
+{
+	std::vector<MoveStatistics> moveStatistics;
+
+	if (!this->nodes || this->nodes[0].state != static_cast<std::uint8_t>(NodeState::EXPANDED))
+	{
+		return moveStatistics;
+	}
+
+	const Node& root = this->nodes[0];
+
+	for (std::uint32_t i = 0; i < root.nChildren; ++i)
+	{
+		const Node& child = this->nodes[root.firstChild + i];
+		std::uint32_t nVisits = child.nVisits;
+
+		moveStatistics.push_back(MoveStatistics { child.column, nVisits,
+		                                          (nVisits > 0) ? child.score / (2.0 * nVisits) : 0.5 });
+	}
+
+	std::stable_sort(moveStatistics.begin(), moveStatistics.end(),
+	                 [](const MoveStatistics& a, const MoveStatistics& b)
+	{
+		return a.nVisits > b.nVisits;
+	});
+
+	return moveStatistics;
+}
+
+/**
+ * Returns the most visited line of the tree of the last search.
+ *
+ * @return The most visited move of the root followed by the most visited replies.
+ */
+std::vector<unsigned int> MonteCarloTreeSearch::getPrincipalVariation() const
+{
+	std::vector<unsigned int> principalVariation;
+
+	if (!this->nodes)
+	{
+		return principalVariation;
+	}
+
+	const Node* node = &this->nodes[0];
+
+	while (node->state == static_cast<std::uint8_t>(NodeState::EXPANDED) && node->nChildren > 0)
+	{
+		const Node* bestChild = nullptr;
+
+		for (std::uint32_t i = 0; i < node->nChildren; ++i)
+		{
+			const Node& child = this->nodes[node->firstChild + i];
+
+			if (bestChild == nullptr || child.nVisits > bestChild->nVisits)
+			{
+				bestChild = &child;
+			}
+		}
+
+		if (bestChild->nVisits == 0)
+		{
+			break;
+		}
+
+		principalVariation.push_back(bestChild->column);
+		node = bestChild;
+	}
+
+	return principalVariation;
+}
+
+/**
+ * Runs playouts until the playout limit is reached or the search is stopped.
+ *
+ * Thread 0 is the calling thread, it calls the stop function.
+ *
+ * @param rootBoard The searched board.
+ * @param thread Index of the thread.
+ */
+void MonteCarloTreeSearch::runPlayouts(const MonteCarloTreeSearch::PlayoutBoard& rootBoard, unsigned int thread)
+{
+	std::mt19937 random(this->seed + thread);
+	PlayoutBoard board(rootBoard);
+	std::vector<std::uint32_t> path;
+	unsigned int nPlayouts = 0;
+
+	while (!this->isStopped && this->nStartedPlayouts++ < this->nPlayoutLimit)
+	{
+		this->runPlayout(rootBoard, board, path, random);
+		this->nFinishedPlayouts++;
+
+		if (thread == 0 && ++nPlayouts % STOP_CHECK_INTERVAL == 0 && this->stopFunction &&
+		    this->stopFunction())
+		{
+			this->isStopped = true;
+		}
+	}
+}
+
+/**
+ * Runs one playout: selects a path from the root, expands its last node, plays the game until its
+ * end and adds the result to the nodes of the path.
+ *
+ * @param rootBoard The searched board.
+ * @param board Board used for the playout, set to the searched board.
+ * @param path Buffer for the indices of the nodes of the path.
+ * @param random Generator of the random moves.
+ */
+void MonteCarloTreeSearch::runPlayout(const MonteCarloTreeSearch::PlayoutBoard& rootBoard,
+                                      MonteCarloTreeSearch::PlayoutBoard& board,
+                                      std::vector<std::uint32_t>& path, std::mt19937& random)
+{
+	std::uint32_t index = 0;
+	bool hasExpanded = false;
+	unsigned int result = DRAW_RESULT;
+
+	board = rootBoard;
+	path.clear();
+	path.push_back(index);
+	this->nodes[index].nVisits.fetch_add(1, std::memory_order_relaxed);
+
+	while (true)
+	{
+		Node& node = this->nodes[index];
+
+		if (node.outcome != static_cast<std::uint8_t>(Outcome::NOT_OVER))
+		{
+			// The player who made the move of the node is not the player who makes the next move.
+
+			result = (node.outcome == static_cast<std::uint8_t>(Outcome::WIN)) ? board.getCurrentPlayer() ^ 1 :
+			                                                                      DRAW_RESULT;
+			break;
+		}
+
+		// Only one node is expanded per playout, the game is played out from one of its children.
+
+		if (hasExpanded)
+		{
+			result = this->playOut(board, random);
+			break;
+		}
+
+		std::uint8_t state = node.state.load(std::memory_order_acquire);
+		std::uint8_t expectedState = static_cast<std::uint8_t>(NodeState::UNEXPANDED);
+
+		if (state == expectedState &&
+		    (index == 0 || node.nVisits.load(std::memory_order_relaxed) >= EXPANSION_THRESHOLD) &&
+		    node.state.compare_exchange_strong(expectedState, static_cast<std::uint8_t>(NodeState::EXPANDING)))
+		{
+			hasExpanded = this->expand(index, board);
+			state = static_cast<std::uint8_t>(hasExpanded ? NodeState::EXPANDED : NodeState::UNEXPANDED);
+			node.state.store(state, std::memory_order_release);
+		}
+
+		// Nodes which are not expanded yet, which are expanded by another thread or which can not be
+		// expanded are leaves.
+
+		if (state != static_cast<std::uint8_t>(NodeState::EXPANDED))
+		{
+			result = this->playOut(board, random);
+			break;
+		}
+
+		index = this->selectChild(node);
+		this->nodes[index].nVisits.fetch_add(1, std::memory_order_relaxed);
+		path.push_back(index);
+		board.dropToken(this->nodes[index].column);
+	}
+
+	// The node at depth d was reached by a move of the player with index (d - 1) % 2.
+
+	for (std::size_t depth = 1; depth < path.size(); ++depth)
+	{
+		unsigned int mover = (depth - 1) % 2;
+		std::uint32_t score = (result == DRAW_RESULT) ? 1 : ((result == mover) ? 2 : 0);
+
+		this->nodes[path[depth]].score.fetch_add(score, std::memory_order_relaxed);
+	}
+}
+
+/**
+ * Creates the children of the given node, one for every possible move.
+ *
+ * The children are ordered from the center to the sides.
+ *
+ * @param nodeIndex Index of the node, the calling thread must have set its state to EXPANDING.
+ * @param board The board of the node.
+ * @return Whether the children were created, false when the arena is full or there is no move.
+ */
+bool MonteCarloTreeSearch::expand(std::uint32_t nodeIndex, const MonteCarloTreeSearch::PlayoutBoard& board)
+{
+	unsigned int nColumns = board.getNumberOfColumns();
+	unsigned int nChildren = board.countAvailableColumns();
+
+	if (nChildren == 0)
+	{
+		return false;
+	}
+
+	std::size_t firstChild = this->nNodes.fetch_add(nChildren);
+
+	if (firstChild + nChildren > this->nMaximumNodes)
+	{
+		this->nNodes.fetch_sub(nChildren);
+		return false;
+	}
+
+	unsigned int player = board.getCurrentPlayer();
+	std::size_t child = firstChild;
+
+	for (unsigned int i = 0; i < nColumns; ++i)
+	{
+		int offset = (i + 1) / 2;
+		unsigned int x = static_cast<int>(nColumns / 2) + ((i % 2 == 0) ? offset : -offset);
+
+		if (!board.canDropToken(x))
+		{
+			continue;
+		}
+
+		Outcome outcome = board.isWinningMove(x, player) ? Outcome::WIN :
+		                  (board.isLastEmptyCell() ? Outcome::DRAW : Outcome::NOT_OVER);
+
+		this->initializeNode(this->nodes[child++], x, static_cast<unsigned int>(outcome));
+	}
+
+	Node& node = this->nodes[nodeIndex];
+
+	node.firstChild = static_cast<std::uint32_t>(firstChild);
+	node.nChildren = static_cast<std::uint16_t>(nChildren);
+
+	return true;
+}
+
+/**
+ * Selects the child of the given expanded node with the highest upper confidence bound.
+ *
+ * A child whose move wins is always selected, children without visits are selected before the
+ * others.
+ *
+ * @param node The node.
+ * @return Index of the child.
+ */
+std::uint32_t MonteCarloTreeSearch::selectChild(const MonteCarloTreeSearch::Node& node) const
+{
+	double logParentVisits = std::log(std::max<std::uint32_t>(1, node.nVisits.load(std::memory_order_relaxed)));
+	std::uint32_t bestChild = node.firstChild;
+	double bestValue = -std::numeric_limits<double>::infinity();
+
+	for (std::uint32_t i = node.firstChild; i < node.firstChild + node.nChildren; ++i)
+	{
+		const Node& child = this->nodes[i];
+
+		if (child.outcome == static_cast<std::uint8_t>(Outcome::WIN))
+		{
+			return i;
+		}
+
+		std::uint32_t nVisits = child.nVisits.load(std::memory_order_relaxed);
+
+		if (nVisits == 0)
+		{
+			return i;
+		}
+
+		double value = child.score.load(std::memory_order_relaxed) / (2.0 * nVisits) +
+		               this->explorationConstant * std::sqrt(logParentVisits / nVisits);
+
+		if (value > bestValue)
+		{
+			bestValue = value;
+			bestChild = i;
+		}
+	}
+
+	return bestChild;
+}
+
+/**
+ * Plays the game on the given board until its end.
+ *
+ * @param board The board, the game must not be over.
+ * @param random Generator of the random moves.
+ * @return Index of the winner or DRAW_RESULT.
+ */
+unsigned int MonteCarloTreeSearch::playOut(MonteCarloTreeSearch::PlayoutBoard& board, std::mt19937& random) const
+{
+	unsigned int nColumns = board.getNumberOfColumns();
+
+	while (!board.isFull())
+	{
+		unsigned int player = board.getCurrentPlayer();
+		unsigned int move = nColumns;
+
+		if (this->playoutPolicy == PlayoutPolicy::HEURISTIC)
+		{
+			for (unsigned int x = 0; x < nColumns; ++x)
+			{
+				if (board.canDropToken(x) && board.isWinningMove(x, player))
+				{
+					return player;
+				}
+			}
+
+			for (unsigned int x = 0; x < nColumns && move == nColumns; ++x)
+			{
+				if (board.canDropToken(x) && board.isWinningMove(x, player ^ 1))
+				{
+					move = x;
+				}
+			}
+		}
+
+		if (move == nColumns)
+		{
+			// Take the n-th column which is not full.
+
+			unsigned int n = random() % board.countAvailableColumns();
+
+			for (move = 0; !board.canDropToken(move) || n-- > 0; ++move)
+			{
+			}
+
+			if (this->playoutPolicy == PlayoutPolicy::RANDOM && board.isWinningMove(move, player))
+			{
+				return player;
+			}
+		}
+
+		board.dropToken(move);
+	}
+
+	return DRAW_RESULT;
+}
+
+/**
+ * Initializes a node of the arena.
+ *
+ * @param node The node.
+ * @param column Column of the move which leads to the node.
+ * @param outcome Result of the move when the game is over after it.
+ */
+void MonteCarloTreeSearch::initializeNode(MonteCarloTreeSearch::Node& node, unsigned int column,
+                                          unsigned int outcome) const
+{
+	node.nVisits.store(0, std::memory_order_relaxed);
+	node.score.store(0, std::memory_order_relaxed);
+	node.state.store(static_cast<std::uint8_t>(NodeState::UNEXPANDED), std::memory_order_relaxed);
+	node.firstChild = 0;
+	node.nChildren = 0;
+	node.column = static_cast<std::uint16_t>(column);
+	node.outcome = static_cast<std::uint8_t>(outcome);
+}
+
+}
+}
@@ -0,0 +1,247 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_MONTECARLOTREESEARCH_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_MONTECARLOTREESEARCH_HPP
+
+#include "Board.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Monte Carlo tree search for four in a line positions.
+ *
+ * Unlike the ArtificialIntelligence, which searches all moves up to a search depth, the tree search
+ * plays many games from the position until their end (playouts) and grows a tree of the positions
+ * that were played most often. Its cost does not depend on a search depth, so it still plays sensibly
+ * on very big boards (e.g. 15x15) on which an alpha-beta search can only look a few moves ahead.
+ *
+ * Every playout starts at the root and selects a child with UCT (upper confidence bound applied to
+ * trees): the child with the highest win rate plus an exploration term (see
+ * setExplorationConstant()). At a node which has no children yet and was already visited before,
+ * all children are created (expansion). From there a game is played until its end with the playout
+ * policy (see setPlayoutPolicy()):
+ * uniformly random moves or moves that win immediately or block an immediate win of the opponent
+ * before random moves. The result is added to all nodes of the path. The best move is the most
+ * visited move of the root. Moves which win immediately are played without searching.
+ *
+ * The nodes are allocated from an arena with a fixed number of nodes (see the constructor), which is
+ * allocated when the first position is searched and reset in one step before every search. When the
+ * arena is full the tree stops growing, the playouts go on from its leaves. The playouts do not
+ * allocate memory: they work on a compact copy of the board (one byte per cell and the column
+ * heights) and only check the lines through the last token, so boards of every size are supported.
+ *
+ * With setNumberOfThreads() several threads search the same tree (tree parallelism). The counters
+ * of the nodes are atomic. A thread adds a visit to every node of its path while it descends (virtual
+ * loss), so until its result is added the path looks worse to the other threads, which then explore
+ * other moves.
+ *
+ * A search ends after the given number of playouts. A stop function can be set with
+ * setStopFunction(), it is called periodically during a search by the calling thread, the search
+ * ends early when it returns true. It may also throw an exception to cancel the search, the
+ * exception is rethrown by findBestMove() after all threads have stopped.
+ *
+ * With one thread the search only depends on the seed (see setSeed()), so it can be repeated.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class MonteCarloTreeSearch
+{
+	public:
+		/**
+		 * Type used for a player id.
+		 */
+		using PlayerType = unsigned int;
+
+		/**
+		 * Function called periodically during a search, returns true when the search has to end.
+		 */
+		using StopFunctionType = std::function<bool()>;
+
+		/**
+		 * How the moves of a playout are chosen.
+		 */
+		enum class PlayoutPolicy
+		{
+			RANDOM = 1,   ///< Uniformly random moves.
+			HEURISTIC = 2 ///< A winning move, else a move blocking a win of the opponent, else random.
+		};
+
+		/**
+		 * Statistics of a move of the root.
+		 */
+		struct MoveStatistics
+		{
+			/**
+			 * Column of the move.
+			 */
+			unsigned int column;
+
+			/**
+			 * Number of playouts which started with the move.
+			 */
+			unsigned long long nVisits;
+
+			/**
+			 * Average result of these playouts for the player who makes the move, 1 for a win, 0.5
+			 * for a draw and 0 for a loss.
+			 */
+			double winRate;
+		};
+
+		/**
+		 * Default number of nodes of the arena.
+		 */
+		static const std::size_t DEFAULT_NUMBER_OF_NODES;
+
+		/**
+		 * Default constant of the exploration term of UCT.
+		 */
+		static const double DEFAULT_EXPLORATION_CONSTANT;
+
+		MonteCarloTreeSearch(std::size_t nNodes = MonteCarloTreeSearch::DEFAULT_NUMBER_OF_NODES);
+		virtual ~MonteCarloTreeSearch();
+
+		void setStopFunction(StopFunctionType stopFunction);
+		void setNumberOfThreads(unsigned int nThreads);
+		unsigned int getNumberOfThreads() const;
+		void setPlayoutPolicy(PlayoutPolicy playoutPolicy);
+		PlayoutPolicy getPlayoutPolicy() const;
+		void setExplorationConstant(double explorationConstant);
+		double getExplorationConstant() const;
+		void setSeed(unsigned int seed);
+
+		unsigned int findBestMove(const Board& board, PlayerType player, unsigned long long nPlayouts);
+
+		unsigned long long getNumberOfPlayouts() const;
+		std::size_t getNumberOfNodes() const;
+		std::size_t getMemorySize() const;
+		std::vector<MoveStatistics> getMoveStatistics() const;
+		std::vector<unsigned int> getPrincipalVariation() const;
+
+	private:
+		class PlayoutBoard;
+
+		/**
+		 * Node of the tree, stored in the arena.
+		 */
+		struct Node
+		{
+			/**
+			 * Number of playouts through the node, including running playouts (virtual loss).
+			 */
+			std::atomic<std::uint32_t> nVisits;
+
+			/**
+			 * Sum of the results of the finished playouts for the player who made the move of the
+			 * node, 2 for a win, 1 for a draw and 0 for a loss.
+			 */
+			std::atomic<std::uint32_t> score;
+
+			/**
+			 * Expansion state, see NodeState in the implementation.
+			 */
+			std::atomic<std::uint8_t> state;
+
+			/**
+			 * Index of the first child in the arena, the children are stored one after another.
+			 */
+			std::uint32_t firstChild;
+
+			/**
+			 * Number of children, valid when the node is expanded.
+			 */
+			std::uint16_t nChildren;
+
+			/**
+			 * Column of the move which leads to this node.
+			 */
+			std::uint16_t column;
+
+			/**
+			 * Result for the player who made the move when the game is over after the move (see
+			 * Outcome in the implementation).
+			 */
+			std::uint8_t outcome;
+		};
+
+		void runPlayouts(const PlayoutBoard& rootBoard, unsigned int thread);
+		void runPlayout(const PlayoutBoard& rootBoard, PlayoutBoard& board, std::vector<std::uint32_t>& path,
+		                std::mt19937& random);
+		bool expand(std::uint32_t nodeIndex, const PlayoutBoard& board);
+		std::uint32_t selectChild(const Node& node) const;
+		unsigned int playOut(PlayoutBoard& board, std::mt19937& random) const;
+		void initializeNode(Node& node, unsigned int column, unsigned int outcome) const;
+
+		/**
+		 * The nodes, the root is the first node.
+		 */
+		std::unique_ptr<Node[]> nodes;
+
+		/**
+		 * Number of nodes of the arena.
+		 */
+		std::size_t nMaximumNodes;
+
+		/**
+		 * Number of used nodes of the arena.
+		 */
+		std::atomic<std::size_t> nNodes;
+
+		/**
+		 * Number of started playouts of the current search.
+		 */
+		std::atomic<unsigned long long> nStartedPlayouts;
+
+		/**
+		 * Number of finished playouts of the last search.
+		 */
+		std::atomic<unsigned long long> nFinishedPlayouts;
+
+		/**
+		 * Number of playouts of the current search.
+		 */
+		unsigned long long nPlayoutLimit;
+
+		/**
+		 * Whether the threads of the current search have to stop.
+		 */
+		std::atomic<bool> isStopped;
+
+		/**
+		 * Function called periodically during a search.
+		 */
+		StopFunctionType stopFunction;
+
+		/**
+		 * Number of threads.
+		 */
+		unsigned int nThreads;
+
+		/**
+		 * How the moves of a playout are chosen.
+		 */
+		PlayoutPolicy playoutPolicy;
+
+		/**
+		 * Constant of the exploration term of UCT.
+		 */
+		double explorationConstant;
+
+		/**
+		 * Seed of the random moves, thread i uses seed + i.
+		 */
+		unsigned int seed;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_MONTECARLOTREESEARCH_HPP
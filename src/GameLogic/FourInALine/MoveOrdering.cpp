@@ -0,0 +1,318 @@
+#include "MoveOrdering.hpp"
+
+#include <limits>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const unsigned int MoveOrdering::NO_MOVE = std::numeric_limits<unsigned int>::max();
+
+/**
+ * Maximum history score of a cell, when it is exceeded all history scores are halved.
+ */
+static const unsigned int MAXIMUM_HISTORY_SCORE = 1u << 30;
+
+/**
+ * Creates a new move ordering with all heuristics enabled.
+ */
+MoveOrdering::MoveOrdering()
+    : centerFirst(true), hashMoveFirst(true), killerMoves(true), historyHeuristic(true)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+MoveOrdering::~MoveOrdering()
+{
+
+}
+
+/**
+ * Returns a copy of the move ordering, including the killer moves and the history table.
+ *
+ * @return Copy of the move ordering.
+ */
+std::shared_ptr<MoveOrdering> MoveOrdering::clone() const
+{
+	return std::make_shared<MoveOrdering>(*this);
+}
+
+/**
+ * Sets whether moves in the center columns are searched first.
+ *
+ * @param centerFirst When center columns should be searched first true, when the moves should be
+ *        searched from left to right false.
+ */
+void MoveOrdering::setCenterFirst(bool centerFirst)
+{
+	this->centerFirst = centerFirst;
+}
+
+/**
+ * Returns whether moves in the center columns are searched first.
+ *
+ * @return When center columns are searched first true, otherwise false.
+ */
+bool MoveOrdering::isCenterFirst() const
+{
+	return this->centerFirst;
+}
+
+/**
+ * Sets whether the hash move is searched first.
+ *
+ * @param hashMoveFirst When the hash move should be searched first true, otherwise false.
+ */
+void MoveOrdering::setHashMoveFirst(bool hashMoveFirst)
+{
+	this->hashMoveFirst = hashMoveFirst;
+}
+
+/**
+ * Returns whether the hash move is searched first.
+ *
+ * @return When the hash move is searched first true, otherwise false.
+ */
+bool MoveOrdering::isHashMoveFirst() const
+{
+	return this->hashMoveFirst;
+}
+
+/**
+ * Sets whether killer moves are searched early.
+ *
+ * @param killerMoves When killer moves should be used true, otherwise false.
+ */
+void MoveOrdering::setKillerMoves(bool killerMoves)
+{
+	this->killerMoves = killerMoves;
+}
+
+/**
+ * Returns whether killer moves are searched early.
+ *
+ * @return When killer moves are used true, otherwise false.
+ */
+bool MoveOrdering::hasKillerMoves() const
+{
+	return this->killerMoves;
+}
+
+/**
+ * Sets whether the history heuristic is used.
+ *
+ * @param historyHeuristic When the history heuristic should be used true, otherwise false.
+ */
+void MoveOrdering::setHistoryHeuristic(bool historyHeuristic)
+{
+	this->historyHeuristic = historyHeuristic;
+}
+
+/**
+ * Returns whether the history heuristic is used.
+ *
+ * @return When the history heuristic is used true, otherwise false.
+ */
+bool MoveOrdering::hasHistoryHeuristic() const
+{
+	return this->historyHeuristic;
+}
+
+/**
+ * Prepares a new search on the given board, resets the killer moves and the history table.
+ *
+ * @param board The board that will be searched.
+ * @param maximumDepth Maximum search depth, i.e. the number of plies with moves.
+ */
+void MoveOrdering::prepare(const Board& board, unsigned int maximumDepth)
+{
+	this->killers.assign(2 * maximumDepth, MoveOrdering::NO_MOVE);
+	this->history.assign(board.getNumberOfColumns() * board.getNumberOfRows(), 0);
+}
+
+/**
+ * Sorts the given moves using only the static ordering (center first or left to right).
+ *
+ * @param board The board.
+ * @param moves The moves to sort.
+ */
+void MoveOrdering::orderStatically(const Board& board, std::vector<unsigned int>& moves) const
+{
+	// Insertion sort, there are only a few moves and it does not allocate memory.
+
+	for (std::size_t i = 1; i < moves.size(); ++i)
+	{
+		unsigned int move = moves[i];
+		unsigned int rank = this->getStaticRank(board, move);
+		std::size_t j = i;
+
+		while (j > 0 && this->getStaticRank(board, moves[j - 1]) > rank)
+		{
+			moves[j] = moves[j - 1];
+			j--;
+		}
+
+		moves[j] = move;
+	}
+}
+
+/**
+ * Sorts the given moves of a node at the given ply.
+ *
+ * The hash move is searched first, then the killer moves of the ply, then the moves with the
+ * highest history score. Moves with equal priority are sorted statically.
+ *
+ * @param board The board.
+ * @param ply Distance of the node from the root node.
+ * @param hashMove The hash move or NO_MOVE.
+ * @param moves The moves to sort.
+ */
+void MoveOrdering::orderMoves(const Board& board, unsigned int ply, unsigned int hashMove,
+                              std::vector<unsigned int>& moves) const
+{
+	unsigned int killer1 = MoveOrdering::NO_MOVE;
+	unsigned int killer2 = MoveOrdering::NO_MOVE;
+
+	if (this->killerMoves && 2 * ply + 1 < this->killers.size())
+	{
+		killer1 = this->killers[2 * ply];
+		killer2 = this->killers[2 * ply + 1];
+	}
+
+	if (!this->hashMoveFirst)
+	{
+		hashMove = MoveOrdering::NO_MOVE;
+	}
+
+	auto getPriority = [&](unsigned int move)
+	{
+		unsigned long long priority = 0;
+
+		if (move == hashMove)
+		{
+			priority = 3;
+		}
+		else if (move == killer1)
+		{
+			priority = 2;
+		}
+		else if (move == killer2)
+		{
+			priority = 1;
+		}
+
+		priority <<= 32;
+
+		if (this->historyHeuristic && !this->history.empty())
+		{
+			priority += this->history[this->getCell(board, move)];
+		}
+
+		return priority;
+	};
+
+	auto isBefore = [&](unsigned int move1, unsigned int move2)
+	{
+		unsigned long long priority1 = getPriority(move1);
+		unsigned long long priority2 = getPriority(move2);
+
+		if (priority1 != priority2)
+		{
+			return priority1 > priority2;
+		}
+
+		return this->getStaticRank(board, move1) < this->getStaticRank(board, move2);
+	};
+
+	for (std::size_t i = 1; i < moves.size(); ++i)
+	{
+		unsigned int move = moves[i];
+		std::size_t j = i;
+
+		while (j > 0 && isBefore(move, moves[j - 1]))
+		{
+			moves[j] = moves[j - 1];
+			j--;
+		}
+
+		moves[j] = move;
+	}
+}
+
+/**
+ * Informs the move ordering that the given move caused a cutoff.
+ *
+ * The move becomes the first killer move of the ply and the history score of the cell in which the
+ * token of the move lands is increased by depth * depth.
+ *
+ * @param board The board before the move was made.
+ * @param ply Distance of the node from the root node.
+ * @param depth Remaining search depth of the node.
+ * @param move The move that caused the cutoff.
+ */
+void MoveOrdering::addCutoff(const Board& board, unsigned int ply, unsigned int depth,
+                             unsigned int move)
+{
+	if (2 * ply + 1 < this->killers.size() && this->killers[2 * ply] != move)
+	{
+		this->killers[2 * ply + 1] = this->killers[2 * ply];
+		this->killers[2 * ply] = move;
+	}
+
+	if (!this->history.empty() && !board.isColumnFull(move))
+	{
+		unsigned int& score = this->history[this->getCell(board, move)];
+		score += depth * depth;
+
+		if (score > MAXIMUM_HISTORY_SCORE)
+		{
+			for (unsigned int& cellScore : this->history)
+			{
+				cellScore /= 2;
+			}
+		}
+	}
+}
+
+/**
+ * Returns the rank of the given move in the static ordering, moves with lower ranks are searched
+ * first.
+ *
+ * @param board The board.
+ * @param move The move.
+ * @return Rank of the move.
+ */
+unsigned int MoveOrdering::getStaticRank(const Board& board, unsigned int move) const
+{
+	if (!this->centerFirst)
+	{
+		return move;
+	}
+
+	// Twice the distance to the center, the left one of two columns with the same distance first.
+
+	int distance = 2 * static_cast<int>(move) - static_cast<int>(board.getNumberOfColumns() - 1);
+
+	return (distance < 0) ? -2 * distance : 2 * distance + 1;
+}
+
+/**
+ * Returns the index of the cell in which the token of the given move lands.
+ *
+ * @param board The board.
+ * @param move The move.
+ * @return Index of the cell (y * number of columns + x).
+ */
+unsigned int MoveOrdering::getCell(const Board& board, unsigned int move) const
+{
+	unsigned int y = board.getNumberOfRows() - 1 - board.getColumnHeight(move);
+
+	return y * board.getNumberOfColumns() + move;
+}
+
+}
+}
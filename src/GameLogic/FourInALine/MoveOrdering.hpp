@@ -0,0 +1,110 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_MOVEORDERING_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_MOVEORDERING_HPP
+
+#include "Board.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Decides in which order the artificial intelligence searches the moves of a node.
+ *
+ * Alpha-beta-pruning prunes the most branches when the best move is searched first. This class
+ * sorts the moves using the following heuristics, each of them can be enabled or disabled:
+ *
+ * - Center first: Moves in the center columns are searched before moves at the edges, because
+ *   tokens in the center are part of more windows. Without it, the moves are searched from left to
+ *   right.
+ * - Hash move: The best move stored in the transposition table (e.g. by the previous iteration of
+ *   iterative deepening) is searched first.
+ * - Killer moves: The last two moves which caused a cutoff at the same ply are searched next.
+ * - History heuristic: Moves into cells where moves caused many cutoffs (weighted with the
+ *   remaining depth) are searched before other moves.
+ *
+ * The static ordering (center first or left to right) is used as tie-breaker for the other
+ * heuristics. orderStatically() only applies the static ordering, the artificial intelligence uses
+ * it for the moves of the root node, so that the chosen move does not depend on the state of the
+ * dynamic heuristics.
+ *
+ * Call prepare() before a search to reset the killer moves and the history table, report cutoffs
+ * with addCutoff(). Subclasses can override the virtual methods to implement other orderings, they
+ * also have to override clone(), which is used to give every search thread its own move ordering.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class MoveOrdering
+{
+	public:
+		/**
+		 * Value of a hash move when there is no hash move.
+		 */
+		static const unsigned int NO_MOVE;
+
+		MoveOrdering();
+		virtual ~MoveOrdering();
+
+		virtual std::shared_ptr<MoveOrdering> clone() const;
+
+		void setCenterFirst(bool centerFirst);
+		bool isCenterFirst() const;
+		void setHashMoveFirst(bool hashMoveFirst);
+		bool isHashMoveFirst() const;
+		void setKillerMoves(bool killerMoves);
+		bool hasKillerMoves() const;
+		void setHistoryHeuristic(bool historyHeuristic);
+		bool hasHistoryHeuristic() const;
+
+		virtual void prepare(const Board& board, unsigned int maximumDepth);
+
+		virtual void orderStatically(const Board& board, std::vector<unsigned int>& moves) const;
+		virtual void orderMoves(const Board& board, unsigned int ply, unsigned int hashMove,
+		                        std::vector<unsigned int>& moves) const;
+
+		virtual void addCutoff(const Board& board, unsigned int ply, unsigned int depth,
+		                       unsigned int move);
+
+	protected:
+		unsigned int getStaticRank(const Board& board, unsigned int move) const;
+		unsigned int getCell(const Board& board, unsigned int move) const;
+
+	private:
+		/**
+		 * Whether moves in the center are searched first.
+		 */
+		bool centerFirst;
+
+		/**
+		 * Whether the hash move is searched first.
+		 */
+		bool hashMoveFirst;
+
+		/**
+		 * Whether killer moves are searched early.
+		 */
+		bool killerMoves;
+
+		/**
+		 * Whether the history heuristic is used.
+		 */
+		bool historyHeuristic;
+
+		/**
+		 * Two killer moves per ply, NO_MOVE when there is no killer move.
+		 */
+		std::vector<unsigned int> killers;
+
+		/**
+		 * History score of every cell of the board.
+		 */
+		std::vector<unsigned int> history;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_MOVEORDERING_HPP
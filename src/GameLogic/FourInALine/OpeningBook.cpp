@@ -0,0 +1,372 @@
+#include "OpeningBook.hpp"
+
+#include <QByteArray>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const std::uint32_t OpeningBook::VERSION = 1;
+
+/**
+ * Magic bytes at the beginning of a book file.
+ */
+static const char MAGIC[8] = { 'F', 'I', 'A', 'L', 'B', 'O', 'O', 'K' };
+
+/**
+ * Header of a book file.
+ */
+struct Header
+{
+	/**
+	 * The magic bytes.
+	 */
+	char magic[8];
+
+	/**
+	 * Version of the file format.
+	 */
+	std::uint32_t version;
+
+	/**
+	 * Number of columns of the board.
+	 */
+	std::uint32_t nColumns;
+
+	/**
+	 * Number of rows of the board.
+	 */
+	std::uint32_t nRows;
+
+	/**
+	 * The book contains positions with less than this number of tokens.
+	 */
+	std::uint32_t nPlies;
+
+	/**
+	 * Search depth used to compute the moves.
+	 */
+	std::uint32_t searchDepth;
+
+	/**
+	 * Reserved, 0.
+	 */
+	std::uint32_t reserved;
+
+	/**
+	 * Number of entries.
+	 */
+	std::uint64_t nEntries;
+};
+
+static_assert(sizeof(Header) == 40, "The header of a book file must have 40 bytes.");
+
+/**
+ * Creates a new opening book, no book is loaded.
+ */
+OpeningBook::OpeningBook()
+    : data(nullptr), nColumns(0), nRows(0), nPlies(0), searchDepth(0), nEntries(0)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+OpeningBook::~OpeningBook()
+{
+	this->close();
+}
+
+/**
+ * Loads the book from the given file.
+ *
+ * The file is mapped into memory, only the header is read.
+ *
+ * @param fileName Name of the book file.
+ */
+void OpeningBook::load(const QString& fileName)
+{
+	this->close();
+	this->file.setFileName(fileName);
+
+	if (!this->file.open(QIODevice::ReadOnly))
+	{
+		throw std::runtime_error("Could not open the opening book.");
+	}
+
+	Header header;
+	qint64 size = this->file.size();
+
+	if (size < static_cast<qint64>(sizeof(Header)))
+	{
+		this->file.close();
+		throw std::runtime_error("The opening book is too small.");
+	}
+
+	const uchar* data = this->file.map(0, size);
+
+	if (data == nullptr)
+	{
+		this->file.close();
+		throw std::runtime_error("Could not map the opening book into memory.");
+	}
+
+	std::memcpy(&header, data, sizeof(Header));
+
+	bool isValid = std::equal(MAGIC, MAGIC + sizeof(MAGIC), header.magic) &&
+	               header.version == OpeningBook::VERSION &&
+	               header.nEntries <= static_cast<std::uint64_t>(size) &&
+	               static_cast<std::uint64_t>(size) == sizeof(Header) + 9 * header.nEntries;
+
+	if (!isValid)
+	{
+		this->file.unmap(const_cast<uchar*>(data));
+		this->file.close();
+		throw std::runtime_error("The opening book is invalid.");
+	}
+
+	this->data = data;
+	this->nColumns = header.nColumns;
+	this->nRows = header.nRows;
+	this->nPlies = header.nPlies;
+	this->searchDepth = header.searchDepth;
+	this->nEntries = static_cast<std::size_t>(header.nEntries);
+}
+
+/**
+ * Closes the book file.
+ */
+void OpeningBook::close()
+{
+	if (this->data != nullptr)
+	{
+		this->file.unmap(const_cast<uchar*>(this->data));
+		this->data = nullptr;
+	}
+
+	if (this->file.isOpen())
+	{
+		this->file.close();
+	}
+
+	this->nColumns = 0;
+	this->nRows = 0;
+	this->nPlies = 0;
+	this->searchDepth = 0;
+	this->nEntries = 0;
+}
+
+/**
+ * Returns whether a book is loaded.
+ *
+ * @return When a book is loaded true, otherwise false.
+ */
+bool OpeningBook::isLoaded() const
+{
+	return this->data != nullptr;
+}
+
+/**
+ * Returns the number of columns of the board of the book.
+ *
+ * @return Number of columns.
+ */
+unsigned int OpeningBook::getNumberOfColumns() const
+{
+	return this->nColumns;
+}
+
+/**
+ * Returns the number of rows of the board of the book.
+ *
+ * @return Number of rows.
+ */
+unsigned int OpeningBook::getNumberOfRows() const
+{
+	return this->nRows;
+}
+
+/**
+ * Returns the number of plies of the book, the book contains the positions with less tokens.
+ *
+ * @return Number of plies.
+ */
+unsigned int OpeningBook::getNumberOfPlies() const
+{
+	return this->nPlies;
+}
+
+/**
+ * Returns the search depth used to compute the moves of the book.
+ *
+ * @return Search depth.
+ */
+unsigned int OpeningBook::getSearchDepth() const
+{
+	return this->searchDepth;
+}
+
+/**
+ * Returns the number of positions stored in the book.
+ *
+ * @return Number of entries.
+ */
+std::size_t OpeningBook::getNumberOfEntries() const
+{
+	return this->nEntries;
+}
+
+/**
+ * Looks up the best move of the given player on the given board.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @param move The best move is stored here when it was found.
+ * @return When the book contains the position true, otherwise false.
+ */
+bool OpeningBook::lookup(const Board& board, OpeningBook::PlayerType player, unsigned int& move) const
+{
+	if (this->data == nullptr || board.getNumberOfColumns() != this->nColumns ||
+	    board.getNumberOfRows() != this->nRows)
+	{
+		return false;
+	}
+
+	std::uint64_t key = OpeningBook::computeKey(board, player);
+	const uchar* keys = this->data + sizeof(Header);
+	const uchar* moves = keys + 8 * this->nEntries;
+
+	// Binary search for the first key which is not less than the key.
+
+	std::size_t first = 0;
+	std::size_t count = this->nEntries;
+
+	while (count > 0)
+	{
+		std::size_t step = count / 2;
+		std::uint64_t middleKey;
+
+		std::memcpy(&middleKey, keys + 8 * (first + step), sizeof(middleKey));
+
+		if (middleKey < key)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	if (first == this->nEntries)
+	{
+		return false;
+	}
+
+	std::uint64_t foundKey;
+
+	std::memcpy(&foundKey, keys + 8 * first, sizeof(foundKey));
+
+	if (foundKey != key)
+	{
+		return false;
+	}
+
+	unsigned int bookMove = moves[first];
+
+	if (board.isCanonicalHashKeyMirrored())
+	{
+		bookMove = this->nColumns - 1 - bookMove;
+	}
+
+	if (bookMove >= this->nColumns || board.isColumnFull(bookMove))
+	{
+		return false;
+	}
+
+	move = bookMove;
+
+	return true;
+}
+
+/**
+ * Computes the key of the given position, which is used to find it in a book.
+ *
+ * Mirrored positions have the same key.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @return Key of the position.
+ */
+std::uint64_t OpeningBook::computeKey(const Board& board, OpeningBook::PlayerType player)
+{
+	return board.getCanonicalHashKey() ^ (static_cast<std::uint64_t>(player) * 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+ * Writes a book file.
+ *
+ * @param fileName Name of the book file.
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @param nPlies The book contains positions with less than this number of tokens.
+ * @param searchDepth Search depth used to compute the moves.
+ * @param entries Keys (see computeKey()) and best moves for the canonical boards of the positions,
+ *        in any order. Of several entries with the same key only the first one is written.
+ */
+void OpeningBook::write(const QString& fileName, unsigned int nColumns, unsigned int nRows,
+                        unsigned int nPlies, unsigned int searchDepth,
+                        std::vector<OpeningBook::EntryType> entries)
+{
+	std::stable_sort(entries.begin(), entries.end(), [](const EntryType& a, const EntryType& b)
+	{
+		return a.first < b.first;
+	});
+
+	entries.erase(std::unique(entries.begin(), entries.end(), [](const EntryType& a, const EntryType& b)
+	{
+		return a.first == b.first;
+	}), entries.end());
+
+	Header header;
+
+	std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = OpeningBook::VERSION;
+	header.nColumns = nColumns;
+	header.nRows = nRows;
+	header.nPlies = nPlies;
+	header.searchDepth = searchDepth;
+	header.reserved = 0;
+	header.nEntries = entries.size();
+
+	QByteArray bytes;
+	bytes.reserve(static_cast<int>(sizeof(Header) + 9 * entries.size()));
+	bytes.append(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+	for (const EntryType& entry : entries)
+	{
+		bytes.append(reinterpret_cast<const char*>(&entry.first), sizeof(entry.first));
+	}
+
+	for (const EntryType& entry : entries)
+	{
+		bytes.append(static_cast<char>(entry.second));
+	}
+
+	QFile file(fileName);
+
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(bytes) != bytes.size())
+	{
+		throw std::runtime_error("Could not write the opening book.");
+	}
+}
+
+}
+}
@@ -0,0 +1,123 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_OPENINGBOOK_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_OPENINGBOOK_HPP
+
+#include "Board.hpp"
+
+#include <QFile>
+#include <QString>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Best moves of the positions at the beginning of a game, read from a memory mapped file.
+ *
+ * In the first moves of a game the artificial intelligence would have to search the most positions,
+ * but the result does not depend on the game. An opening book is generated once (see
+ * OpeningBookGenerator) for a board size and stores the best move of every position up to a number
+ * of plies, computed with a high search depth.
+ *
+ * The book file is not read when it is loaded with load(), it is only mapped into memory, so loading
+ * takes constant time. lookup() does a binary search on the mapped keys, only the pages which are
+ * needed are read by the operating system.
+ *
+ * File format (all numbers in the byte order of the machine that generated the file, a file with the
+ * wrong byte order is rejected because of its version):
+ *
+ * - Header (40 bytes): the magic "FIALBOOK" (8 bytes), version (32 bit), number of columns (32 bit),
+ *   number of rows (32 bit), number of plies (32 bit), search depth (32 bit), reserved (32 bit) and
+ *   number of entries (64 bit).
+ * - Keys: one 64 bit key per entry, sorted ascending (see computeKey()).
+ * - Moves: one byte per entry, the best move of the position with the key at the same index. The
+ *   move is stored for the canonical board (see Board::getCanonicalHashKey()).
+ *
+ * This class is reentrant, lookup() is thread-safe.
+ */
+class OpeningBook
+{
+	public:
+		/**
+		 * Type used for a player id.
+		 */
+		using PlayerType = unsigned int;
+
+		/**
+		 * Key and best move of a position.
+		 */
+		using EntryType = std::pair<std::uint64_t, unsigned int>;
+
+		/**
+		 * Version of the file format.
+		 */
+		static const std::uint32_t VERSION;
+
+		OpeningBook();
+		virtual ~OpeningBook();
+
+		void load(const QString& fileName);
+		void close();
+		bool isLoaded() const;
+
+		unsigned int getNumberOfColumns() const;
+		unsigned int getNumberOfRows() const;
+		unsigned int getNumberOfPlies() const;
+		unsigned int getSearchDepth() const;
+		std::size_t getNumberOfEntries() const;
+
+		bool lookup(const Board& board, PlayerType player, unsigned int& move) const;
+
+		static std::uint64_t computeKey(const Board& board, PlayerType player);
+		static void write(const QString& fileName, unsigned int nColumns, unsigned int nRows,
+		                  unsigned int nPlies, unsigned int searchDepth,
+		                  std::vector<EntryType> entries);
+
+	private:
+		OpeningBook(const OpeningBook& book) = delete;
+		OpeningBook& operator=(const OpeningBook& book) = delete;
+
+		/**
+		 * The book file.
+		 */
+		QFile file;
+
+		/**
+		 * The memory mapped book file, nullptr when no book is loaded.
+		 */
+		const uchar* data;
+
+		/**
+		 * Number of columns of the board.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows of the board.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * The book contains positions with less than this number of tokens.
+		 */
+		unsigned int nPlies;
+
+		/**
+		 * Search depth used to compute the moves.
+		 */
+		unsigned int searchDepth;
+
+		/**
+		 * Number of entries.
+		 */
+		std::size_t nEntries;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_OPENINGBOOK_HPP
@@ -0,0 +1,126 @@
+#include "OpeningBookGenerator.hpp"
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Creates a new generator for a book of the given board size.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @param nPlies The book contains positions with less than this number of tokens.
+ * @param searchDepth Search depth used to compute the moves.
+ */
+OpeningBookGenerator::OpeningBookGenerator(unsigned int nColumns, unsigned int nRows,
+                                           unsigned int nPlies, unsigned int searchDepth)
+    : nColumns(nColumns), nRows(nRows), nPlies(nPlies), artificialIntelligence(searchDepth)
+{
+	// The positions of the book share many subtrees.
+
+	this->artificialIntelligence.setKeepTranspositionTable(true);
+}
+
+/**
+ * Frees all used resources.
+ */
+OpeningBookGenerator::~OpeningBookGenerator()
+{
+
+}
+
+/**
+ * Sets the number of threads used to compute the moves.
+ *
+ * @param nThreads Number of threads, 0 for one thread per processor core.
+ * @see ArtificialIntelligence::setNumberOfThreads()
+ */
+void OpeningBookGenerator::setNumberOfThreads(unsigned int nThreads)
+{
+	this->artificialIntelligence.setNumberOfThreads(nThreads);
+}
+
+/**
+ * Sets the function which is called after the move of a position was computed.
+ *
+ * @param progressCallback Function called with the number of computed positions.
+ */
+void OpeningBookGenerator::setProgressCallback(OpeningBookGenerator::ProgressCallbackType progressCallback)
+{
+	this->progressCallback = progressCallback;
+}
+
+/**
+ * Computes the moves of all positions and writes the book to the given file.
+ *
+ * @param fileName Name of the book file.
+ * @return Number of positions in the book.
+ */
+std::size_t OpeningBookGenerator::generate(const QString& fileName)
+{
+	this->visitedKeys.clear();
+	this->entries.clear();
+
+	this->visit(Game(this->nRows, this->nColumns, Game::PLAYER_ONE));
+	this->visit(Game(this->nRows, this->nColumns, Game::PLAYER_TWO));
+
+	OpeningBook::write(fileName, this->nColumns, this->nRows, this->nPlies,
+	                   this->artificialIntelligence.getSearchDepth(), this->entries);
+
+	return this->entries.size();
+}
+
+/**
+ * Computes the move of the given position, if it was not visited yet, and visits the positions
+ * after all possible moves.
+ *
+ * @param game The game.
+ */
+void OpeningBookGenerator::visit(const Game& game)
+{
+	if (game.getNumberOfMoves() >= this->nPlies || game.isOver())
+	{
+		return;
+	}
+
+	const Board& board = *game.getBoard();
+	std::uint64_t key = OpeningBook::computeKey(board, game.getCurrentPlayer());
+
+	if (!this->visitedKeys.insert(key).second)
+	{
+		return;
+	}
+
+	unsigned int move = this->artificialIntelligence.computeNextMove(game);
+
+	// The move is stored for the canonical board.
+
+	if (board.isCanonicalHashKeyMirrored())
+	{
+		this->entries.push_back(std::make_pair(key, this->nColumns - 1 - move));
+	}
+	else
+	{
+		this->entries.push_back(std::make_pair(key, move));
+	}
+
+	if (this->progressCallback)
+	{
+		this->progressCallback(this->entries.size());
+	}
+
+	for (unsigned int x = 0; x < this->nColumns; ++x)
+	{
+		if (game.isMovePossible(x))
+		{
+			Game nextGame(game);
+
+			nextGame.makeMove(x);
+			this->visit(nextGame);
+		}
+	}
+}
+
+}
+}
@@ -0,0 +1,91 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_OPENINGBOOKGENERATOR_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_OPENINGBOOKGENERATOR_HPP
+
+#include "ArtificialIntelligence.hpp"
+#include "OpeningBook.hpp"
+#include "Game.hpp"
+
+#include <QString>
+
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Generates opening books.
+ *
+ * Visits every position with less than the given number of tokens, for both players making the
+ * first move, and computes the best move of every position with an artificial intelligence with
+ * the given search depth. Mirrored positions are only computed once. The result is written with
+ * OpeningBook::write().
+ *
+ * Generating a book takes a long time, it is done once with the OpeningBookGenerator tool.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class OpeningBookGenerator
+{
+	public:
+		/**
+		 * Function called after the move of a position was computed, with the number of computed
+		 * positions.
+		 */
+		using ProgressCallbackType = std::function<void(std::size_t nPositions)>;
+
+		OpeningBookGenerator(unsigned int nColumns, unsigned int nRows, unsigned int nPlies,
+		                     unsigned int searchDepth);
+		virtual ~OpeningBookGenerator();
+
+		void setNumberOfThreads(unsigned int nThreads);
+		void setProgressCallback(ProgressCallbackType progressCallback);
+
+		std::size_t generate(const QString& fileName);
+
+	private:
+		void visit(const Game& game);
+
+		/**
+		 * Number of columns of the board.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows of the board.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * The book contains positions with less than this number of tokens.
+		 */
+		unsigned int nPlies;
+
+		/**
+		 * Artificial intelligence computing the moves.
+		 */
+		ArtificialIntelligence artificialIntelligence;
+
+		/**
+		 * Called after the move of a position was computed.
+		 */
+		ProgressCallbackType progressCallback;
+
+		/**
+		 * Keys of the visited positions.
+		 */
+		std::unordered_set<std::uint64_t> visitedKeys;
+
+		/**
+		 * Computed entries of the book.
+		 */
+		std::vector<OpeningBook::EntryType> entries;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_OPENINGBOOKGENERATOR_HPP
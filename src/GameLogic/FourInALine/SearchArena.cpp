@@ -0,0 +1,132 @@
+#include "SearchArena.hpp"
+
+#include <stdexcept>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const std::size_t SearchArena::DEFAULT_CAPACITY = 64 * 1024;
+
+/**
+ * Creates a new empty arena with the given capacity, the memory is allocated by the first
+ * allocation.
+ *
+ * @param capacity Capacity in bytes.
+ */
+SearchArena::SearchArena(std::size_t capacity)
+    : capacity(capacity), usedSize(0), peakSize(0)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+SearchArena::~SearchArena()
+{
+
+}
+
+/**
+ * Allocates the given number of bytes with the given alignment.
+ *
+ * @param size Number of bytes.
+ * @param alignment Alignment of the memory, a power of 2 not bigger than the alignment of
+ *        std::max_align_t.
+ * @return The memory, valid until the next reset().
+ * @throws std::bad_alloc When the memory does not fit into the arena.
+ */
+void* SearchArena::allocate(std::size_t size, std::size_t alignment)
+{
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > alignof(std::max_align_t))
+	{
+		throw std::invalid_argument("The alignment must be a power of 2 up to the alignment of max_align_t.");
+	}
+
+	if (!this->memory)
+	{
+		this->memory.reset(new unsigned char[this->capacity]);
+	}
+
+	// The block is allocated with new[], so it is aligned for every fundamental type.
+
+	std::size_t offset = (this->usedSize + alignment - 1) & ~(alignment - 1);
+
+	if (offset > this->capacity || size > this->capacity - offset)
+	{
+		throw std::bad_alloc();
+	}
+
+	this->usedSize = offset + size;
+
+	if (this->usedSize > this->peakSize)
+	{
+		this->peakSize = this->usedSize;
+	}
+
+	return this->memory.get() + offset;
+}
+
+/**
+ * Frees the allocations made after the arena had the given used size.
+ *
+ * Scratch memory of a part of a search (e.g. one search depth) can be freed this way without
+ * freeing the memory of the whole search. The peak size is kept.
+ *
+ * @param usedSize Used size before the allocations, see getUsedSize().
+ */
+void SearchArena::rewind(std::size_t usedSize)
+{
+	if (usedSize > this->usedSize)
+	{
+		throw std::invalid_argument("Can not rewind the arena to a bigger used size.");
+	}
+
+	this->usedSize = usedSize;
+}
+
+/**
+ * Frees all allocations in one step and resets the peak size.
+ *
+ * The block itself is kept for the next allocations.
+ */
+void SearchArena::reset()
+{
+	this->usedSize = 0;
+	this->peakSize = 0;
+}
+
+/**
+ * Returns the capacity of the arena.
+ *
+ * @return Capacity in bytes.
+ */
+std::size_t SearchArena::getCapacity() const
+{
+	return this->capacity;
+}
+
+/**
+ * Returns the number of bytes in use, including padding for the alignment.
+ *
+ * @return Number of used bytes.
+ */
+std::size_t SearchArena::getUsedSize() const
+{
+	return this->usedSize;
+}
+
+/**
+ * Returns the highest number of bytes in use since the last reset().
+ *
+ * @return Peak number of used bytes.
+ */
+std::size_t SearchArena::getPeakSize() const
+{
+	return this->peakSize;
+}
+
+}
+}
@@ -0,0 +1,105 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_SEARCHARENA_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_SEARCHARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Fixed-size bump-pointer arena for the scratch memory of a search.
+ *
+ * Memory is taken from one block by moving a pointer forward, single allocations are never freed.
+ * reset() frees all allocations in one step, e.g. before the next move is computed, so allocating
+ * costs a few instructions and does not touch the heap. Every search thread uses its own arena,
+ * so the threads never wait for each other (or for the heap) to get memory.
+ *
+ * The block is allocated by the first allocation and kept until the arena is destroyed, it never
+ * grows: an allocation which does not fit throws std::bad_alloc, so the scratch memory of a search
+ * is bounded by the capacity. getPeakSize() returns the most memory used since the last reset().
+ *
+ * Only trivially destructible objects can be created with allocateArray(), their destructors are
+ * not called by reset().
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class SearchArena
+{
+	public:
+		/**
+		 * Default capacity in bytes.
+		 */
+		static const std::size_t DEFAULT_CAPACITY;
+
+		SearchArena(std::size_t capacity = SearchArena::DEFAULT_CAPACITY);
+		virtual ~SearchArena();
+
+		void* allocate(std::size_t size, std::size_t alignment);
+		void rewind(std::size_t usedSize);
+		void reset();
+
+		std::size_t getCapacity() const;
+		std::size_t getUsedSize() const;
+		std::size_t getPeakSize() const;
+
+		/**
+		 * Creates an array of the given number of value-initialized objects in the arena.
+		 *
+		 * @param nElements Number of objects.
+		 * @return The first object, valid until the next reset().
+		 */
+		template <typename T>
+		T* allocateArray(std::size_t nElements)
+		{
+			static_assert(std::is_trivially_destructible<T>::value,
+			              "The arena does not call destructors.");
+
+			if (nElements > this->capacity / sizeof(T))
+			{
+				throw std::bad_alloc();
+			}
+
+			T* elements = static_cast<T*>(this->allocate(nElements * sizeof(T), alignof(T)));
+
+			for (std::size_t i = 0; i < nElements; ++i)
+			{
+				new (elements + i) T();
+			}
+
+			return elements;
+		}
+
+	private:
+		SearchArena(const SearchArena& arena) = delete;
+		SearchArena& operator=(const SearchArena& arena) = delete;
+
+		/**
+		 * The block, nullptr until the first allocation.
+		 */
+		std::unique_ptr<unsigned char[]> memory;
+
+		/**
+		 * Size of the block in bytes.
+		 */
+		std::size_t capacity;
+
+		/**
+		 * Number of used bytes at the beginning of the block.
+		 */
+		std::size_t usedSize;
+
+		/**
+		 * Highest number of used bytes since the last reset.
+		 */
+		std::size_t peakSize;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_SEARCHARENA_HPP
@@ -0,0 +1,182 @@
+#include "SearchWorker.hpp"
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Returns the worker shared by all artificial intelligences that do not use their own worker.
+ *
+ * The worker is created when it is needed and destroyed when nobody uses it anymore.
+ *
+ * @return The shared worker.
+ */
+std::shared_ptr<SearchWorker> SearchWorker::getSharedInstance()
+{
+	static std::mutex mutex;
+	static std::weak_ptr<SearchWorker> sharedWorker;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::shared_ptr<SearchWorker> worker = sharedWorker.lock();
+
+	if (!worker)
+	{
+		worker = std::make_shared<SearchWorker>();
+		sharedWorker = worker;
+	}
+
+	return worker;
+}
+
+/**
+ * Creates a new worker and starts its thread.
+ */
+SearchWorker::SearchWorker()
+    : runningJobOwner(nullptr), isQuitting(false)
+{
+	this->thread = std::thread(&SearchWorker::run, this);
+}
+
+/**
+ * Drops the pending jobs, waits until the running job has finished and stops the thread.
+ *
+ * The worker must not be destroyed by one of its own jobs.
+ */
+SearchWorker::~SearchWorker()
+{
+	std::deque<QueuedJob> droppedJobs;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->isQuitting = true;
+		droppedJobs.swap(this->jobs);
+	}
+
+	this->condition.notify_all();
+	this->thread.join();
+}
+
+/**
+ * Adds a job to the queue, it is executed after all jobs that were added before.
+ *
+ * @param job The job.
+ * @param owner The owner of the job, its jobs can be removed with removeJobs().
+ */
+void SearchWorker::addJob(SearchWorker::JobType job, const void* owner)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->jobs.push_back(QueuedJob{ std::move(job), owner });
+	}
+
+	this->condition.notify_one();
+}
+
+/**
+ * Removes the pending jobs of the given owner from the queue and waits until its running job has
+ * finished.
+ *
+ * The removed jobs are destroyed without being executed. The jobs of other owners are not waited
+ * for. Must not be called by a job of the given owner.
+ *
+ * @param owner The owner of the jobs, not nullptr.
+ */
+void SearchWorker::removeJobs(const void* owner)
+{
+	std::deque<QueuedJob> removedJobs;
+
+	{
+		std::unique_lock<std::mutex> lock(this->mutex);
+
+		for (auto it = this->jobs.begin(); it != this->jobs.end(); )
+		{
+			if (it->owner == owner)
+			{
+				removedJobs.push_back(std::move(*it));
+				it = this->jobs.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		this->jobFinishedCondition.wait(lock, [this, owner]() { return this->runningJobOwner != owner; });
+	}
+
+	// The removed jobs are destroyed here, without holding the lock.
+}
+
+/**
+ * Returns the number of jobs which were not started yet.
+ *
+ * @return Number of pending jobs.
+ */
+std::size_t SearchWorker::getNumberOfPendingJobs() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	return this->jobs.size();
+}
+
+/**
+ * Returns whether the calling thread is the thread of this worker.
+ *
+ * @return When called from a job of this worker true, otherwise false.
+ */
+bool SearchWorker::isWorkerThread() const
+{
+	return this->thread.get_id() == std::this_thread::get_id();
+}
+
+/**
+ * Executes the jobs in the queue until the worker is quitting.
+ */
+void SearchWorker::run()
+{
+	while (true)
+	{
+		QueuedJob job;
+
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+
+			this->condition.wait(lock, [this]() { return this->isQuitting || !this->jobs.empty(); });
+
+			if (this->isQuitting)
+			{
+				return;
+			}
+
+			job = std::move(this->jobs.front());
+			this->jobs.pop_front();
+			this->runningJobOwner = job.owner;
+		}
+
+		try
+		{
+			job.job();
+		}
+		catch (...)
+		{
+			// Jobs report their errors themselves, the worker has to keep running.
+		}
+
+		// The job is destroyed before its owner is told that it has finished, because it may
+		// refer to the owner.
+
+		job.job = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->runningJobOwner = nullptr;
+		}
+
+		this->jobFinishedCondition.notify_all();
+	}
+}
+
+}
+}
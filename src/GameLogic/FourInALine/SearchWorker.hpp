@@ -0,0 +1,115 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_SEARCHWORKER_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_SEARCHWORKER_HPP
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Long-lived thread which executes search jobs one after another.
+ *
+ * Starting a new thread for every computed move is expensive and throws away everything the thread
+ * had set up. The worker instead starts one thread when it is created and keeps it running until it
+ * is destroyed. Jobs are added with addJob() to a queue and executed in the order in which they
+ * were added. A job is a function, it has to report its result itself (e.g. with a
+ * std::packaged_task).
+ *
+ * Several artificial intelligences can share a worker, e.g. the artificial intelligence computing
+ * hints and the artificial intelligences of the computer players. Use getSharedInstance() to
+ * retrieve the worker shared by all of them. A job can be added with an owner (e.g. the artificial
+ * intelligence), removeJobs() then drops the pending jobs of that owner and waits only for its
+ * running job, not for the jobs of the other owners.
+ *
+ * When the worker is destroyed, the jobs that are still in the queue are dropped without being
+ * executed, only the running job is finished before the thread is stopped.
+ *
+ * This class is thread-safe.
+ */
+class SearchWorker
+{
+	public:
+		/**
+		 * Type of a job.
+		 */
+		using JobType = std::function<void()>;
+
+		static std::shared_ptr<SearchWorker> getSharedInstance();
+
+		SearchWorker();
+		virtual ~SearchWorker();
+
+		void addJob(JobType job, const void* owner = nullptr);
+		void removeJobs(const void* owner);
+		std::size_t getNumberOfPendingJobs() const;
+		bool isWorkerThread() const;
+
+	private:
+		SearchWorker(const SearchWorker& worker) = delete;
+		SearchWorker& operator=(const SearchWorker& worker) = delete;
+
+		void run();
+
+		/**
+		 * A job and its owner.
+		 */
+		struct QueuedJob
+		{
+			/**
+			 * The job.
+			 */
+			JobType job;
+
+			/**
+			 * The owner of the job, nullptr when it has none.
+			 */
+			const void* owner;
+		};
+
+		/**
+		 * Protects the queue, the owner of the running job and the quit flag.
+		 */
+		mutable std::mutex mutex;
+
+		/**
+		 * Signalled when a job was added or the worker is quitting.
+		 */
+		std::condition_variable condition;
+
+		/**
+		 * Signalled when a job has finished.
+		 */
+		std::condition_variable jobFinishedCondition;
+
+		/**
+		 * Jobs which were not started yet.
+		 */
+		std::deque<QueuedJob> jobs;
+
+		/**
+		 * Owner of the running job, nullptr when no job or a job without owner is running.
+		 */
+		const void* runningJobOwner;
+
+		/**
+		 * Whether the thread should stop, the pending jobs are dropped.
+		 */
+		bool isQuitting;
+
+		/**
+		 * The thread executing the jobs.
+		 */
+		std::thread thread;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_SEARCHWORKER_HPP
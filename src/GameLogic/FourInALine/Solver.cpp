@@ -0,0 +1,710 @@
+#include "Solver.hpp"
+#include "../CellSet.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const Solver::ScoreType Solver::INVALID_SCORE = -1000;
+const std::size_t Solver::DEFAULT_TRANSPOSITION_TABLE_SIZE = 1 << 22;
+
+/**
+ * Returns whether the solver supports boards of the given size.
+ *
+ * Every column must fit into a 64 bit board together with a sentinel bit, and the shifts used to
+ * find diagonal lines must stay within 64 bits.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @return Whether the solver supports boards of the given size.
+ */
+bool Solver::isSupported(unsigned int nColumns, unsigned int nRows)
+{
+	return nColumns > 0 && nRows > 0 && nColumns * (nRows + 1) <= 64 && 3 * (nRows + 2) < 64;
+}
+
+/**
+ * Creates a new solver.
+ *
+ * The transposition table is allocated when the first position is solved.
+ *
+ * @param nTranspositionTableEntries Number of entries of the transposition table, rounded down
+ *                                   to a power of two.
+ */
+Solver::Solver(std::size_t nTranspositionTableEntries)
+    : nColumns(0), nRows(0), bottomMask(0), boardMask(0), minimumScore(0), maximumScore(0),
+      nIndexBits(0), nNodes(0)
+{
+	while (nTranspositionTableEntries > 1 && this->nIndexBits < 48)
+	{
+		nTranspositionTableEntries >>= 1;
+		++this->nIndexBits;
+	}
+
+	this->nIndexBits = std::max(this->nIndexBits, 1u);
+}
+
+/**
+ * Frees all used resources.
+ */
+Solver::~Solver()
+{
+
+}
+
+/**
+ * Sets the function which is called periodically during a search.
+ *
+ * The function may throw an exception to stop the search, the exception is passed on to the caller
+ * of solve(), scoreMoves() or findBestMove().
+ *
+ * @param stopFunction Function called periodically during a search.
+ */
+void Solver::setStopFunction(Solver::StopFunctionType stopFunction)
+{
+	this->stopFunction = stopFunction;
+}
+
+/**
+ * Removes all entries from the transposition table.
+ */
+void Solver::clearTranspositionTable()
+{
+	std::fill(this->transpositionTable.begin(), this->transpositionTable.end(), Entry { 0, 0 });
+}
+
+/**
+ * Returns the number of nodes visited since the solver was created.
+ *
+ * @return Number of visited nodes.
+ */
+unsigned long long Solver::getNumberOfNodes() const
+{
+	return this->nNodes;
+}
+
+/**
+ * Computes the score of the given board for the given player making the next move.
+ *
+ * @param board The board, the game must not be over yet.
+ * @param player The player who makes the next move.
+ * @return Exact score of the board.
+ */
+Solver::ScoreType Solver::solve(const Board& board, Solver::PlayerType player)
+{
+	Position position;
+	this->setUp(board, player, position);
+
+	return this->solve(position);
+}
+
+/**
+ * Computes the score of every move of the given player on the given board.
+ *
+ * The score of a move is the score of the board after the move from the point of view of the
+ * given player, i.e. the best move has the highest score.
+ *
+ * @param board The board, the game must not be over yet.
+ * @param player The player who makes the next move.
+ * @return Score of every column, INVALID_SCORE for full columns.
+ */
+std::vector<Solver::ScoreType> Solver::scoreMoves(const Board& board, Solver::PlayerType player)
+{
+	Position position;
+	this->setUp(board, player, position);
+
+	std::vector<ScoreType> scores(this->nColumns, Solver::INVALID_SCORE);
+	std::uint64_t possibleMoves = this->getPossibleMoves(position);
+	std::uint64_t winningCells = this->getWinningCells(position.current, position.mask);
+	ScoreType nCells = this->nColumns * this->nRows;
+
+	for (unsigned int x = 0; x < this->nColumns; ++x)
+	{
+		std::uint64_t move = possibleMoves & this->getColumnMask(x);
+
+		if (move == 0)
+		{
+			continue;
+		}
+
+		if (move & winningCells)
+		{
+			scores[x] = (nCells + 1 - position.nMoves) / 2;
+			continue;
+		}
+
+		Position nextPosition(position);
+
+		this->play(nextPosition, move);
+		scores[x] = -this->solve(nextPosition);
+	}
+
+	return scores;
+}
+
+/**
+ * Computes the best move of the given player on the given board.
+ *
+ * When several moves have the best score, the move closest to the center is returned.
+ *
+ * @param board The board, the game must not be over yet.
+ * @param player The player who makes the next move.
+ * @return Column of the best move.
+ */
+unsigned int Solver::findBestMove(const Board& board, Solver::PlayerType player)
+{
+	Position position;
+	this->setUp(board, player, position);
+
+	std::uint64_t possibleMoves = this->getPossibleMoves(position);
+	std::uint64_t winningCells = this->getWinningCells(position.current, position.mask);
+
+	if (possibleMoves == 0)
+	{
+		throw std::runtime_error("Not possible to find a move, the board is full.");
+	}
+
+	for (auto x : this->columnOrder)
+	{
+		if (possibleMoves & winningCells & this->getColumnMask(x))
+		{
+			return x;
+		}
+	}
+
+	std::uint64_t nonLosingMoves = this->getNonLosingMoves(position);
+
+	if (nonLosingMoves == 0)
+	{
+		// All moves lose, prefer blocking one of the threats of the opponent.
+
+		std::uint64_t opponentWinningCells = this->getWinningCells(position.current ^ position.mask,
+		                                                           position.mask);
+		std::uint64_t forcedMoves = possibleMoves & opponentWinningCells;
+		std::uint64_t moves = forcedMoves ? forcedMoves : possibleMoves;
+
+		for (auto x : this->columnOrder)
+		{
+			if (moves & this->getColumnMask(x))
+			{
+				return x;
+			}
+		}
+	}
+
+	// Only the score of the board is computed exactly, the moves are then verified with null-window
+	// searches which mostly hit the transposition table.
+
+	ScoreType score = this->solve(position);
+	ScoreType nCells = this->nColumns * this->nRows;
+	unsigned int bestMove = this->nColumns;
+
+	for (auto x : this->columnOrder)
+	{
+		std::uint64_t move = nonLosingMoves & this->getColumnMask(x);
+
+		if (move == 0)
+		{
+			continue;
+		}
+
+		if (bestMove == this->nColumns)
+		{
+			bestMove = x;
+		}
+
+		Position nextPosition(position);
+		this->play(nextPosition, move);
+
+		ScoreType nextScore = (static_cast<ScoreType>(nextPosition.nMoves) >= nCells) ? 0 :
+		                      this->negamax(nextPosition, -score, -score + 1);
+
+		if (nextScore <= -score)
+		{
+			return x;
+		}
+	}
+
+	return bestMove;
+}
+
+/**
+ * Returns the outcome of a game with the given score.
+ *
+ * @param score Score of a board.
+ * @return Outcome for the player who makes the next move.
+ */
+Solver::Outcome Solver::getOutcome(Solver::ScoreType score)
+{
+	if (score > 0)
+	{
+		return Outcome::WIN;
+	}
+	else if (score < 0)
+	{
+		return Outcome::LOSS;
+	}
+
+	return Outcome::DRAW;
+}
+
+/**
+ * Returns the number of moves until the game ends with perfect play of both players.
+ *
+ * The winner wins as fast as possible and the loser delays the loss as long as possible, a draw
+ * ends when the board is full.
+ *
+ * @param board The board for which the score was computed.
+ * @param score Score of the board.
+ * @return Number of moves until the game ends, including the last move.
+ */
+unsigned int Solver::getNumberOfPliesToEnd(const Board& board, Solver::ScoreType score)
+{
+	int nCells = board.getNumberOfColumns() * board.getNumberOfRows();
+	int nMoves = 0;
+
+	for (unsigned int x = 0; x < board.getNumberOfColumns(); ++x)
+	{
+		nMoves += board.getColumnHeight(x);
+	}
+
+	if (score == 0)
+	{
+		return nCells - nMoves;
+	}
+
+	// The winner has (score - 1) tokens left after the winning move, so the winning move is made
+	// on a board with nCells + 1 - 2 * score or nCells - 2 * score tokens, whichever number of
+	// tokens means that it is the winner's turn.
+
+	int winnerScore = (score > 0) ? score : -score;
+	int nMovesBeforeWin = nCells + 1 - 2 * winnerScore;
+	int winnerParity = (score > 0) ? (nMoves % 2) : ((nMoves + 1) % 2);
+
+	if (nMovesBeforeWin % 2 != winnerParity)
+	{
+		--nMovesBeforeWin;
+	}
+
+	return std::max(nMovesBeforeWin - nMoves, 0) + 1;
+}
+
+/**
+ * Converts the given board into bit masks and prepares the solver for boards of its size.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @param position The bit masks of the board.
+ */
+void Solver::setUp(const Board& board, Solver::PlayerType player, Solver::Position& position)
+{
+	unsigned int nColumns = board.getNumberOfColumns();
+	unsigned int nRows = board.getNumberOfRows();
+
+	if (!Solver::isSupported(nColumns, nRows))
+	{
+		throw std::runtime_error("Board size is not supported by the solver.");
+	}
+
+	if (!board.findWinningCells().isEmpty())
+	{
+		throw std::runtime_error("Not possible to solve the board, the game is over.");
+	}
+
+	if (nColumns != this->nColumns || nRows != this->nRows)
+	{
+		// Keys of different board sizes must not be mixed in the transposition table.
+
+		this->nColumns = nColumns;
+		this->nRows = nRows;
+		this->bottomMask = 0;
+
+		for (unsigned int x = 0; x < nColumns; ++x)
+		{
+			this->bottomMask |= std::uint64_t(1) << (x * (nRows + 1));
+		}
+
+		this->boardMask = this->bottomMask * ((std::uint64_t(1) << nRows) - 1);
+		this->minimumScore = -static_cast<ScoreType>(nColumns * nRows) / 2;
+		this->maximumScore = static_cast<ScoreType>(nColumns * nRows + 1) / 2;
+
+		this->columnOrder.clear();
+
+		for (unsigned int i = 0; i < nColumns; ++i)
+		{
+			// Center first, then alternating left and right of the center.
+
+			int offset = static_cast<int>(i + 1) / 2;
+			this->columnOrder.push_back(nColumns / 2 + ((i % 2 == 0) ? offset : -offset));
+		}
+
+		if (this->transpositionTable.empty())
+		{
+			this->transpositionTable.resize(std::size_t(1) << this->nIndexBits, Entry { 0, 0 });
+		}
+		else
+		{
+			this->clearTranspositionTable();
+		}
+	}
+
+	position.current = 0;
+	position.mask = 0;
+	position.nMoves = 0;
+
+	for (unsigned int x = 0; x < nColumns; ++x)
+	{
+		for (unsigned int y = 0; y < nRows; ++y)
+		{
+			::GameLogic::Board::TokenType token = board.getCell(x, y);
+
+			if (token == Board::CELL_EMPTY)
+			{
+				continue;
+			}
+
+			std::uint64_t cell = std::uint64_t(1) << (x * (nRows + 1) + (nRows - 1 - y));
+
+			position.mask |= cell;
+			++position.nMoves;
+
+			if (token == player)
+			{
+				position.current |= cell;
+			}
+		}
+	}
+}
+
+/**
+ * Computes the exact score of the given position with null-window searches.
+ *
+ * @param position The position.
+ * @return Exact score of the position.
+ */
+Solver::ScoreType Solver::solve(const Solver::Position& position)
+{
+	ScoreType nCells = this->nColumns * this->nRows;
+	ScoreType nMoves = position.nMoves;
+
+	if (nMoves >= nCells)
+	{
+		return 0;
+	}
+
+	if (this->canWinNext(position))
+	{
+		return (nCells + 1 - nMoves) / 2;
+	}
+
+	ScoreType minimum = -(nCells - nMoves) / 2;
+	ScoreType maximum = (nCells + 1 - nMoves) / 2;
+
+	while (minimum < maximum)
+	{
+		// Test scores close to 0 first, most positions are draws or decided late.
+
+		ScoreType median = minimum + (maximum - minimum) / 2;
+
+		if (median <= 0 && minimum / 2 < median)
+		{
+			median = minimum / 2;
+		}
+		else if (median >= 0 && maximum / 2 > median)
+		{
+			median = maximum / 2;
+		}
+
+		ScoreType score = this->negamax(position, median, median + 1);
+
+		if (score <= median)
+		{
+			maximum = score;
+		}
+		else
+		{
+			minimum = score;
+		}
+	}
+
+	return minimum;
+}
+
+/**
+ * Searches the given position with alpha-beta-pruning.
+ *
+ * The player who makes the next move must not be able to win with the next move.
+ *
+ * @param position The position.
+ * @param alpha Lower bound of the searched score interval.
+ * @param beta Upper bound of the searched score interval.
+ * @return The exact score if it is in the interval, otherwise an upper bound if it is lower than
+ *         alpha or a lower bound if it is higher than beta.
+ */
+Solver::ScoreType Solver::negamax(const Solver::Position& position, Solver::ScoreType alpha,
+                                  Solver::ScoreType beta)
+{
+	if ((++this->nNodes & 4095) == 0 && this->stopFunction)
+	{
+		this->stopFunction();
+	}
+
+	ScoreType nCells = this->nColumns * this->nRows;
+	ScoreType nMoves = position.nMoves;
+	std::uint64_t nextMoves = this->getNonLosingMoves(position);
+
+	if (nextMoves == 0)
+	{
+		return -(nCells - nMoves) / 2;
+	}
+
+	if (nMoves >= nCells - 2)
+	{
+		return 0;
+	}
+
+	// The opponent cannot win with the next move, so the score is bounded.
+
+	ScoreType minimum = -(nCells - 2 - nMoves) / 2;
+	ScoreType maximum = (nCells - 1 - nMoves) / 2;
+	std::uint64_t key = this->getKey(position);
+	std::uint8_t value = this->lookup(key);
+
+	if (value != 0)
+	{
+		if (value > this->maximumScore - this->minimumScore + 1)
+		{
+			minimum = value + 2 * this->minimumScore - this->maximumScore - 2;
+		}
+		else
+		{
+			maximum = value + this->minimumScore - 1;
+		}
+	}
+
+	if (alpha < minimum)
+	{
+		alpha = minimum;
+
+		if (alpha >= beta)
+		{
+			return alpha;
+		}
+	}
+
+	if (beta > maximum)
+	{
+		beta = maximum;
+
+		if (alpha >= beta)
+		{
+			return beta;
+		}
+	}
+
+	// Moves creating many threats first, on ties the column order decides (insertion sort is
+	// stable and the number of moves is small).
+
+	std::uint64_t moves[64];
+	unsigned int moveScores[64];
+	unsigned int nSortedMoves = 0;
+
+	for (auto x : this->columnOrder)
+	{
+		std::uint64_t move = nextMoves & this->getColumnMask(x);
+
+		if (move == 0)
+		{
+			continue;
+		}
+
+		unsigned int moveScore = __builtin_popcountll(this->getWinningCells(position.current | move,
+		                                                                    position.mask));
+		unsigned int i = nSortedMoves++;
+
+		for (; i > 0 && moveScores[i - 1] < moveScore; --i)
+		{
+			moves[i] = moves[i - 1];
+			moveScores[i] = moveScores[i - 1];
+		}
+
+		moves[i] = move;
+		moveScores[i] = moveScore;
+	}
+
+	for (unsigned int i = 0; i < nSortedMoves; ++i)
+	{
+		Position nextPosition(position);
+		this->play(nextPosition, moves[i]);
+
+		ScoreType score = -this->negamax(nextPosition, -beta, -alpha);
+
+		if (score >= beta)
+		{
+			this->store(key, score + this->maximumScore - 2 * this->minimumScore + 2);
+			return score;
+		}
+
+		if (score > alpha)
+		{
+			alpha = score;
+		}
+	}
+
+	this->store(key, alpha - this->minimumScore + 1);
+	return alpha;
+}
+
+/**
+ * Makes the given move and passes the turn to the other player.
+ *
+ * @param position The position.
+ * @param move Bit of the cell in which the token is placed.
+ */
+void Solver::play(Solver::Position& position, std::uint64_t move) const
+{
+	position.current ^= position.mask;
+	position.mask |= move;
+	++position.nMoves;
+}
+
+/**
+ * Returns the lowest free cell of every column which is not full.
+ *
+ * @param position The position.
+ * @return Bits of the cells in which a token can be placed.
+ */
+std::uint64_t Solver::getPossibleMoves(const Solver::Position& position) const
+{
+	return (position.mask + this->bottomMask) & this->boardMask;
+}
+
+/**
+ * Returns the moves which do not allow the opponent to win with the next move.
+ *
+ * The player who makes the next move must not be able to win with the next move.
+ *
+ * @param position The position.
+ * @return Bits of the cells in which a token can be placed without losing immediately.
+ */
+std::uint64_t Solver::getNonLosingMoves(const Solver::Position& position) const
+{
+	std::uint64_t possibleMoves = this->getPossibleMoves(position);
+	std::uint64_t opponentWinningCells = this->getWinningCells(position.current ^ position.mask,
+	                                                           position.mask);
+	std::uint64_t forcedMoves = possibleMoves & opponentWinningCells;
+
+	if (forcedMoves)
+	{
+		if (forcedMoves & (forcedMoves - 1))
+		{
+			// The opponent has two threats, only one of them can be blocked.
+
+			return 0;
+		}
+
+		possibleMoves = forcedMoves;
+	}
+
+	// Do not play directly below a threat of the opponent.
+
+	return possibleMoves & ~(opponentWinningCells >> 1);
+}
+
+/**
+ * Returns whether the player who makes the next move can win with the next move.
+ *
+ * @param position The position.
+ * @return Whether the player can win with the next move.
+ */
+bool Solver::canWinNext(const Solver::Position& position) const
+{
+	return this->getWinningCells(position.current, position.mask) & this->getPossibleMoves(position);
+}
+
+/**
+ * Returns the empty cells which complete a line of four tokens of the given tokens.
+ *
+ * @param tokens Bits of the tokens of a player.
+ * @param mask Bits of all tokens.
+ * @return Bits of the empty cells in which the player would win.
+ */
+std::uint64_t Solver::getWinningCells(std::uint64_t tokens, std::uint64_t mask) const
+{
+	// Vertical lines.
+
+	std::uint64_t result = (tokens << 1) & (tokens << 2) & (tokens << 3);
+
+	// Horizontal lines and both diagonals.
+
+	const unsigned int shifts[3] = { this->nRows + 1, this->nRows, this->nRows + 2 };
+
+	for (auto shift : shifts)
+	{
+		std::uint64_t pair = (tokens << shift) & (tokens << (2 * shift));
+		result |= pair & (tokens << (3 * shift));
+		result |= pair & (tokens >> shift);
+
+		pair = (tokens >> shift) & (tokens >> (2 * shift));
+		result |= pair & (tokens << shift);
+		result |= pair & (tokens >> (3 * shift));
+	}
+
+	return result & (this->boardMask ^ mask);
+}
+
+/**
+ * Returns all cells of the given column.
+ *
+ * @param x The column.
+ * @return Bits of the cells of the column.
+ */
+std::uint64_t Solver::getColumnMask(unsigned int x) const
+{
+	return ((std::uint64_t(1) << this->nRows) - 1) << (x * (this->nRows + 1));
+}
+
+/**
+ * Returns the key of the given position, which is unique for boards of the same size.
+ *
+ * @param position The position.
+ * @return Key of the position.
+ */
+std::uint64_t Solver::getKey(const Solver::Position& position) const
+{
+	return position.current + position.mask;
+}
+
+/**
+ * Returns the encoded bound stored for the given key.
+ *
+ * @param key Key of the position.
+ * @return Encoded bound, 0 if there is none.
+ */
+std::uint8_t Solver::lookup(std::uint64_t key) const
+{
+	const Entry& entry = this->transpositionTable[(key * 0x9e3779b97f4a7c15ull) >> (64 - this->nIndexBits)];
+
+	return (entry.key == key) ? entry.value : 0;
+}
+
+/**
+ * Stores the encoded bound of the given key, replacing the previous entry.
+ *
+ * @param key Key of the position.
+ * @param value Encoded bound.
+ */
+void Solver::store(std::uint64_t key, std::uint8_t value)
+{
+	Entry& entry = this->transpositionTable[(key * 0x9e3779b97f4a7c15ull) >> (64 - this->nIndexBits)];
+
+	entry.key = key;
+	entry.value = value;
+}
+
+}
+}
@@ -0,0 +1,206 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_SOLVER_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_SOLVER_HPP
+
+#include "Board.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Exact solver for four in a line positions.
+ *
+ * Unlike the ArtificialIntelligence, which searches up to a search depth and evaluates the boards
+ * heuristically, the solver searches until the end of the game and proves whether the player who
+ * makes the next move wins, loses or plays a draw with perfect play of both players.
+ *
+ * The score of a position is 0 for a draw. When the player to move wins, the score is positive and
+ * the faster the player wins, the higher the score: it is the number of tokens the player has left
+ * after the winning token, plus one. When the player to move loses, the score is negative in the
+ * same way for the opponent. getOutcome() and getNumberOfPliesToEnd() interpret a score.
+ *
+ * The solver works on 64 bit boards with the same layout as BitBoard (nRows + 1 bits per column),
+ * so it supports boards with nColumns * (nRows + 1) <= 64, e.g. 7x6 and 8x7 (see isSupported()).
+ * It uses negamax with alpha-beta-pruning, only null-window searches narrowing the score interval
+ * until the exact score is known, a transposition table storing upper and lower bounds, moves which
+ * do not lose immediately only and a move ordering preferring moves which create many threats.
+ *
+ * The transposition table is kept between the computations on boards of the same size, so solving
+ * the positions of one game gets faster with every move. A stop function can be set with
+ * setStopFunction(), it is called periodically during a search and may throw an exception to stop
+ * the search.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class Solver
+{
+	public:
+		/**
+		 * Type used for a player id.
+		 */
+		using PlayerType = unsigned int;
+
+		/**
+		 * Type used for a score.
+		 */
+		using ScoreType = int;
+
+		/**
+		 * Function called periodically during a search.
+		 */
+		using StopFunctionType = std::function<void()>;
+
+		/**
+		 * Result of a game with perfect play.
+		 */
+		enum class Outcome
+		{
+			WIN,  ///< The player who makes the next move wins.
+			DRAW, ///< The game is a draw.
+			LOSS  ///< The player who makes the next move loses.
+		};
+
+		/**
+		 * Score of a move which is not possible.
+		 */
+		static const ScoreType INVALID_SCORE;
+
+		/**
+		 * Default number of entries of the transposition table.
+		 */
+		static const std::size_t DEFAULT_TRANSPOSITION_TABLE_SIZE;
+
+		static bool isSupported(unsigned int nColumns, unsigned int nRows);
+
+		Solver(std::size_t nTranspositionTableEntries = Solver::DEFAULT_TRANSPOSITION_TABLE_SIZE);
+		virtual ~Solver();
+
+		void setStopFunction(StopFunctionType stopFunction);
+		void clearTranspositionTable();
+		unsigned long long getNumberOfNodes() const;
+
+		ScoreType solve(const Board& board, PlayerType player);
+		std::vector<ScoreType> scoreMoves(const Board& board, PlayerType player);
+		unsigned int findBestMove(const Board& board, PlayerType player);
+
+		static Outcome getOutcome(ScoreType score);
+		static unsigned int getNumberOfPliesToEnd(const Board& board, ScoreType score);
+
+	private:
+		/**
+		 * Bit masks of a position.
+		 */
+		struct Position
+		{
+			/**
+			 * Tokens of the player who makes the next move.
+			 */
+			std::uint64_t current;
+
+			/**
+			 * All tokens.
+			 */
+			std::uint64_t mask;
+
+			/**
+			 * Number of tokens.
+			 */
+			unsigned int nMoves;
+		};
+
+		/**
+		 * Entry of the transposition table.
+		 */
+		struct Entry
+		{
+			/**
+			 * Key of the position.
+			 */
+			std::uint64_t key;
+
+			/**
+			 * Encoded bound of the score, 0 for an empty entry.
+			 */
+			std::uint8_t value;
+		};
+
+		void setUp(const Board& board, PlayerType player, Position& position);
+		ScoreType solve(const Position& position);
+		ScoreType negamax(const Position& position, ScoreType alpha, ScoreType beta);
+
+		void play(Position& position, std::uint64_t move) const;
+		std::uint64_t getPossibleMoves(const Position& position) const;
+		std::uint64_t getNonLosingMoves(const Position& position) const;
+		bool canWinNext(const Position& position) const;
+		std::uint64_t getWinningCells(std::uint64_t tokens, std::uint64_t mask) const;
+		std::uint64_t getColumnMask(unsigned int x) const;
+		std::uint64_t getKey(const Position& position) const;
+
+		std::uint8_t lookup(std::uint64_t key) const;
+		void store(std::uint64_t key, std::uint8_t value);
+
+		/**
+		 * Number of columns of the board.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows of the board.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * Bottom cell of every column.
+		 */
+		std::uint64_t bottomMask;
+
+		/**
+		 * All cells of the board (without the sentinel bits).
+		 */
+		std::uint64_t boardMask;
+
+		/**
+		 * Lowest possible score of a position which is searched (not won or lost immediately).
+		 */
+		ScoreType minimumScore;
+
+		/**
+		 * Highest possible score of a position which is searched.
+		 */
+		ScoreType maximumScore;
+
+		/**
+		 * Columns in the order in which they are searched, center first.
+		 */
+		std::vector<unsigned int> columnOrder;
+
+		/**
+		 * Bounds of the scores of already searched positions.
+		 */
+		std::vector<Entry> transpositionTable;
+
+		/**
+		 * Number of bits used for the index of a transposition table entry.
+		 */
+		unsigned int nIndexBits;
+
+		/**
+		 * Number of nodes visited since the solver was created.
+		 */
+		unsigned long long nNodes;
+
+		/**
+		 * Called periodically during a search.
+		 */
+		StopFunctionType stopFunction;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_SOLVER_HPP
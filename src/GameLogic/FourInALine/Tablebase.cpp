@@ -0,0 +1,442 @@
+#include "Tablebase.hpp"
+#include "Solver.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const std::uint32_t Tablebase::VERSION = 1;
+const std::uint64_t Tablebase::MAXIMUM_NUMBER_OF_ENTRIES = std::uint64_t(1) << 28;
+const Tablebase::EntryType Tablebase::INVALID_ENTRY = -128;
+
+/**
+ * Magic bytes at the beginning of a tablebase file.
+ */
+static const char MAGIC[8] = { 'F', 'I', 'A', 'L', 'T', 'B', 'A', 'S' };
+
+/**
+ * Header of a tablebase file.
+ */
+struct Header
+{
+	/**
+	 * The magic bytes.
+	 */
+	char magic[8];
+
+	/**
+	 * Version of the file format.
+	 */
+	std::uint32_t version;
+
+	/**
+	 * Number of columns of the board.
+	 */
+	std::uint32_t nColumns;
+
+	/**
+	 * Number of rows of the board.
+	 */
+	std::uint32_t nRows;
+
+	/**
+	 * Reserved, 0.
+	 */
+	std::uint32_t reserved;
+
+	/**
+	 * Number of entries.
+	 */
+	std::uint64_t nEntries;
+};
+
+static_assert(sizeof(Header) == 32, "The header of a tablebase file must have 32 bytes.");
+
+/**
+ * Returns whether tablebases of the given board size are supported.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @return When the tablebase has at most MAXIMUM_NUMBER_OF_ENTRIES entries true, otherwise false.
+ */
+bool Tablebase::isSupported(unsigned int nColumns, unsigned int nRows)
+{
+	return nColumns > 0 && nRows > 0 && nRows < 28 &&
+	       Tablebase::getNumberOfEntries(nColumns, nRows) <= Tablebase::MAXIMUM_NUMBER_OF_ENTRIES;
+}
+
+/**
+ * Returns the number of entries of a tablebase of the given board size.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board, less than 28.
+ * @return Number of entries, more than MAXIMUM_NUMBER_OF_ENTRIES when the board is too big.
+ */
+std::uint64_t Tablebase::getNumberOfEntries(unsigned int nColumns, unsigned int nRows)
+{
+	std::uint64_t base = (std::uint64_t(1) << (nRows + 1)) - 1;
+	std::uint64_t nEntries = 1;
+
+	for (unsigned int x = 0; x < nColumns && nEntries <= Tablebase::MAXIMUM_NUMBER_OF_ENTRIES; ++x)
+	{
+		nEntries *= base;
+	}
+
+	return nEntries;
+}
+
+/**
+ * Creates a new tablebase, no tablebase is loaded.
+ */
+Tablebase::Tablebase()
+    : entries(nullptr), nColumns(0), nRows(0)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+Tablebase::~Tablebase()
+{
+	this->close();
+}
+
+/**
+ * Loads the tablebase from the given file.
+ *
+ * The file is mapped into memory, only the header is read.
+ *
+ * @param fileName Name of the tablebase file.
+ */
+void Tablebase::load(const QString& fileName)
+{
+	this->close();
+	this->file.setFileName(fileName);
+
+	if (!this->file.open(QIODevice::ReadOnly))
+	{
+		throw std::runtime_error("Could not open the tablebase.");
+	}
+
+	Header header;
+	qint64 size = this->file.size();
+
+	if (size < static_cast<qint64>(sizeof(Header)))
+	{
+		this->file.close();
+		throw std::runtime_error("The tablebase is too small.");
+	}
+
+	const uchar* data = this->file.map(0, size);
+
+	if (data == nullptr)
+	{
+		this->file.close();
+		throw std::runtime_error("Could not map the tablebase into memory.");
+	}
+
+	std::memcpy(&header, data, sizeof(Header));
+
+	bool isValid = std::equal(MAGIC, MAGIC + sizeof(MAGIC), header.magic) &&
+	               header.version == Tablebase::VERSION &&
+	               Tablebase::isSupported(header.nColumns, header.nRows) &&
+	               header.nEntries == Tablebase::getNumberOfEntries(header.nColumns, header.nRows) &&
+	               static_cast<std::uint64_t>(size) == sizeof(Header) + header.nEntries;
+
+	if (!isValid)
+	{
+		this->file.unmap(const_cast<uchar*>(data));
+		this->file.close();
+		throw std::runtime_error("The tablebase is invalid.");
+	}
+
+	this->entries = reinterpret_cast<const EntryType*>(data + sizeof(Header));
+	this->nColumns = header.nColumns;
+	this->nRows = header.nRows;
+}
+
+/**
+ * Closes the tablebase file.
+ */
+void Tablebase::close()
+{
+	if (this->entries != nullptr)
+	{
+		const uchar* data = reinterpret_cast<const uchar*>(this->entries) - sizeof(Header);
+
+		this->file.unmap(const_cast<uchar*>(data));
+		this->entries = nullptr;
+	}
+
+	if (this->file.isOpen())
+	{
+		this->file.close();
+	}
+
+	this->nColumns = 0;
+	this->nRows = 0;
+}
+
+/**
+ * Returns whether a tablebase is loaded.
+ *
+ * @return When a tablebase is loaded true, otherwise false.
+ */
+bool Tablebase::isLoaded() const
+{
+	return this->entries != nullptr;
+}
+
+/**
+ * Returns the number of columns of the board of the tablebase.
+ *
+ * @return Number of columns.
+ */
+unsigned int Tablebase::getNumberOfColumns() const
+{
+	return this->nColumns;
+}
+
+/**
+ * Returns the number of rows of the board of the tablebase.
+ *
+ * @return Number of rows.
+ */
+unsigned int Tablebase::getNumberOfRows() const
+{
+	return this->nRows;
+}
+
+/**
+ * Looks up the exact score of the given board for the given player making the next move.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @param score The score is stored here when it was found.
+ * @return When the tablebase contains the position true, otherwise false (e.g. when the board has
+ *         another size or the game is over).
+ */
+bool Tablebase::probe(const Board& board, Tablebase::PlayerType player, Tablebase::ScoreType& score) const
+{
+	if (!this->isApplicable(board))
+	{
+		return false;
+	}
+
+	EntryType entry = this->entries[Tablebase::computeIndex(board, player)];
+
+	if (entry == Tablebase::INVALID_ENTRY)
+	{
+		return false;
+	}
+
+	score = entry;
+
+	return true;
+}
+
+/**
+ * Looks up the exact scores of all moves of the given player on the given board.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @param scores Set to the exact score of every column from the point of view of the player,
+ *        Solver::INVALID_SCORE for full columns, when the tablebase contains the position.
+ * @return When the tablebase contains the position true, otherwise false.
+ */
+bool Tablebase::scoreMoves(const Board& board, Tablebase::PlayerType player,
+                           std::vector<Tablebase::ScoreType>& scores) const
+{
+	if (!this->isApplicable(board))
+	{
+		return false;
+	}
+
+	std::uint64_t index = Tablebase::computeIndex(board, player);
+
+	if (this->entries[index] == Tablebase::INVALID_ENTRY)
+	{
+		return false;
+	}
+
+	// After a move the other player makes the next move, so the pattern of every column is
+	// inverted: digit' = 3 * (2^height - 1) - digit, where the sum of (2^height - 1) is the index of
+	// the board with the same heights but without tokens of the player. The new token belongs to
+	// the other player, so it only increases the height of its column.
+
+	std::uint64_t base = (std::uint64_t(1) << (this->nRows + 1)) - 1;
+	std::uint64_t power = 1;
+	std::uint64_t emptyIndex = 0;
+	std::vector<std::uint64_t> powers(this->nColumns);
+	ScoreType nMoves = 0;
+
+	for (unsigned int x = 0; x < this->nColumns; ++x)
+	{
+		unsigned int height = board.getColumnHeight(x);
+
+		powers[x] = power;
+		emptyIndex += ((std::uint64_t(1) << height) - 1) * power;
+		nMoves += height;
+		power *= base;
+	}
+
+	ScoreType nCells = this->nColumns * this->nRows;
+
+	scores.assign(this->nColumns, Solver::INVALID_SCORE);
+
+	for (unsigned int x = 0; x < this->nColumns; ++x)
+	{
+		unsigned int height = board.getColumnHeight(x);
+
+		if (height >= this->nRows)
+		{
+			continue;
+		}
+
+		std::uint64_t nextIndex = 3 * emptyIndex - index + (std::uint64_t(1) << height) * powers[x];
+		EntryType nextEntry = this->entries[nextIndex];
+
+		// The position after a valid move is only invalid when the move completed a line.
+
+		scores[x] = (nextEntry == Tablebase::INVALID_ENTRY) ? (nCells + 1 - nMoves) / 2 : -nextEntry;
+	}
+
+	return true;
+}
+
+/**
+ * Finds the best move of the given player on the given board.
+ *
+ * Of several moves with the best score, the move closest to the center is chosen.
+ *
+ * @param board The board.
+ * @param player The player who makes the next move.
+ * @param move The best move is stored here when the tablebase contains the position.
+ * @return When the tablebase contains the position true, otherwise false.
+ */
+bool Tablebase::findBestMove(const Board& board, Tablebase::PlayerType player, unsigned int& move) const
+{
+	std::vector<ScoreType> scores;
+
+	if (!this->scoreMoves(board, player, scores))
+	{
+		return false;
+	}
+
+	ScoreType bestScore = 0;
+	bool hasMove = false;
+
+	for (unsigned int i = 0; i < this->nColumns; ++i)
+	{
+		int offset = (i + 1) / 2;
+		unsigned int x = static_cast<int>(this->nColumns / 2) + ((i % 2 == 0) ? offset : -offset);
+
+		if (scores[x] == Solver::INVALID_SCORE)
+		{
+			continue;
+		}
+
+		if (!hasMove || scores[x] > bestScore)
+		{
+			bestScore = scores[x];
+			move = x;
+			hasMove = true;
+		}
+	}
+
+	return hasMove;
+}
+
+/**
+ * Computes the index of the given position in a tablebase of the size of the board.
+ *
+ * Every column is a digit: 2^height - 1 plus a bit per token of the column which is set when the
+ * token belongs to the given player, the bottom token is the lowest bit. The digit of the first
+ * column is the least significant one.
+ *
+ * @param board The board, its size must be supported.
+ * @param player The player who makes the next move.
+ * @return Index of the position.
+ */
+std::uint64_t Tablebase::computeIndex(const Board& board, Tablebase::PlayerType player)
+{
+	unsigned int nRows = board.getNumberOfRows();
+	std::uint64_t base = (std::uint64_t(1) << (nRows + 1)) - 1;
+	std::uint64_t index = 0;
+
+	for (unsigned int x = board.getNumberOfColumns(); x-- > 0; )
+	{
+		unsigned int height = board.getColumnHeight(x);
+		std::uint64_t digit = (std::uint64_t(1) << height) - 1;
+
+		for (unsigned int i = 0; i < height; ++i)
+		{
+			if (board.getCell(x, nRows - 1 - i) == player)
+			{
+				digit += std::uint64_t(1) << i;
+			}
+		}
+
+		index = index * base + digit;
+	}
+
+	return index;
+}
+
+/**
+ * Writes a tablebase file.
+ *
+ * @param fileName Name of the tablebase file.
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ * @param entries Score of every index, see computeIndex().
+ */
+void Tablebase::write(const QString& fileName, unsigned int nColumns, unsigned int nRows,
+                      const std::vector<Tablebase::EntryType>& entries)
+{
+	if (!Tablebase::isSupported(nColumns, nRows) ||
+	    entries.size() != Tablebase::getNumberOfEntries(nColumns, nRows))
+	{
+		throw std::invalid_argument("The entries do not match the board size.");
+	}
+
+	Header header;
+
+	std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = Tablebase::VERSION;
+	header.nColumns = nColumns;
+	header.nRows = nRows;
+	header.reserved = 0;
+	header.nEntries = entries.size();
+
+	QFile file(fileName);
+
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) ||
+	    file.write(reinterpret_cast<const char*>(&header), sizeof(Header)) != sizeof(Header) ||
+	    file.write(reinterpret_cast<const char*>(entries.data()), entries.size()) !=
+	    static_cast<qint64>(entries.size()))
+	{
+		throw std::runtime_error("Could not write the tablebase.");
+	}
+}
+
+/**
+ * Returns whether a tablebase is loaded and has the size of the given board.
+ *
+ * @param board The board.
+ * @return When the board can be probed true, otherwise false.
+ */
+bool Tablebase::isApplicable(const Board& board) const
+{
+	return this->entries != nullptr && board.getNumberOfColumns() == this->nColumns &&
+	       board.getNumberOfRows() == this->nRows;
+}
+
+}
+}
@@ -0,0 +1,130 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_TABLEBASE_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_TABLEBASE_HPP
+
+#include "Board.hpp"
+
+#include <QFile>
+#include <QString>
+
+#include <cstdint>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Exact scores of all positions of a small board, read from a memory mapped file.
+ *
+ * A tablebase is generated once for a board size (see TablebaseGenerator) and stores the exact
+ * score of every position, so the artificial intelligence can play perfectly on that board size
+ * without searching. The scores have the same meaning as the scores of the Solver: 0 for a draw,
+ * positive when the player who makes the next move wins and negative when the player loses, the
+ * faster the game ends, the higher the absolute value. Solver::getOutcome() and
+ * Solver::getNumberOfPliesToEnd() can be used to interpret them.
+ *
+ * Positions are stored at a dense index (see computeIndex()): every column is a digit which encodes
+ * the height of the column and which of its tokens belong to the player who makes the next move,
+ * the digits are combined with the base 2^(nRows + 1) - 1. Because of that, the number of entries
+ * grows quickly with the board size and only small boards are supported (see isSupported()), e.g.
+ * 5x4 has about 29 million entries. Indices which do not belong to a position that can occur in a
+ * game (wrong number of tokens, four in a line already) store INVALID_ENTRY.
+ *
+ * The file is not read when it is loaded with load(), it is only mapped into memory, probe() only
+ * reads the needed pages.
+ *
+ * File format (all numbers in the byte order of the machine that generated the file, a file with the
+ * wrong byte order is rejected because of its version):
+ *
+ * - Header (32 bytes): the magic "FIALTBAS" (8 bytes), version (32 bit), number of columns (32 bit),
+ *   number of rows (32 bit), reserved (32 bit) and number of entries (64 bit).
+ * - Scores: one signed byte per index.
+ *
+ * This class is reentrant, probe(), scoreMoves() and findBestMove() are thread-safe.
+ */
+class Tablebase
+{
+	public:
+		/**
+		 * Type used for a player id.
+		 */
+		using PlayerType = unsigned int;
+
+		/**
+		 * Type used for a score.
+		 */
+		using ScoreType = int;
+
+		/**
+		 * Type used for a stored score.
+		 */
+		using EntryType = std::int8_t;
+
+		/**
+		 * Version of the file format.
+		 */
+		static const std::uint32_t VERSION;
+
+		/**
+		 * Maximum number of entries of a tablebase.
+		 */
+		static const std::uint64_t MAXIMUM_NUMBER_OF_ENTRIES;
+
+		/**
+		 * Stored for indices which do not belong to a position that can occur in a game.
+		 */
+		static const EntryType INVALID_ENTRY;
+
+		static bool isSupported(unsigned int nColumns, unsigned int nRows);
+		static std::uint64_t getNumberOfEntries(unsigned int nColumns, unsigned int nRows);
+
+		Tablebase();
+		virtual ~Tablebase();
+
+		void load(const QString& fileName);
+		void close();
+		bool isLoaded() const;
+
+		unsigned int getNumberOfColumns() const;
+		unsigned int getNumberOfRows() const;
+
+		bool probe(const Board& board, PlayerType player, ScoreType& score) const;
+		bool scoreMoves(const Board& board, PlayerType player, std::vector<ScoreType>& scores) const;
+		bool findBestMove(const Board& board, PlayerType player, unsigned int& move) const;
+
+		static std::uint64_t computeIndex(const Board& board, PlayerType player);
+		static void write(const QString& fileName, unsigned int nColumns, unsigned int nRows,
+		                  const std::vector<EntryType>& entries);
+
+	private:
+		Tablebase(const Tablebase& tablebase) = delete;
+		Tablebase& operator=(const Tablebase& tablebase) = delete;
+
+		bool isApplicable(const Board& board) const;
+
+		/**
+		 * The tablebase file.
+		 */
+		QFile file;
+
+		/**
+		 * The memory mapped scores, nullptr when no tablebase is loaded.
+		 */
+		const EntryType* entries;
+
+		/**
+		 * Number of columns of the board.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows of the board.
+		 */
+		unsigned int nRows;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_TABLEBASE_HPP
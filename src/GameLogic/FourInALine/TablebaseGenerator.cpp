@@ -0,0 +1,244 @@
+#include "TablebaseGenerator.hpp"
+#include "BitBoard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Creates a new generator for a tablebase of the given board size.
+ *
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ */
+TablebaseGenerator::TablebaseGenerator(unsigned int nColumns, unsigned int nRows)
+    : nColumns(nColumns), nRows(nRows), nThreads(1)
+{
+
+}
+
+/**
+ * Frees all used resources.
+ */
+TablebaseGenerator::~TablebaseGenerator()
+{
+
+}
+
+/**
+ * Sets the number of threads computing the scores.
+ *
+ * @param nThreads Number of threads, 0 for one thread per processor core.
+ */
+void TablebaseGenerator::setNumberOfThreads(unsigned int nThreads)
+{
+	if (nThreads == 0)
+	{
+		nThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	this->nThreads = nThreads;
+}
+
+/**
+ * Sets the function which is called after the positions with a number of tokens were computed.
+ *
+ * @param progressCallback Function called with the number of tokens, from the number of cells down
+ *        to 0.
+ */
+void TablebaseGenerator::setProgressCallback(TablebaseGenerator::ProgressCallbackType progressCallback)
+{
+	this->progressCallback = progressCallback;
+}
+
+/**
+ * Computes the scores of all positions and writes the tablebase to the given file.
+ *
+ * @param fileName Name of the tablebase file.
+ * @return Number of positions in the tablebase (indices with a valid score).
+ */
+std::size_t TablebaseGenerator::generate(const QString& fileName)
+{
+	if (!Tablebase::isSupported(this->nColumns, this->nRows))
+	{
+		throw std::runtime_error("The board is too big for a tablebase.");
+	}
+
+	unsigned int nCells = this->nColumns * this->nRows;
+
+	this->entries.assign(Tablebase::getNumberOfEntries(this->nColumns, this->nRows),
+	                     Tablebase::INVALID_ENTRY);
+
+	// All combinations of column heights, grouped by their number of tokens.
+
+	std::vector<std::vector<std::vector<unsigned int> > > heightsByTokens(nCells + 1);
+	std::vector<unsigned int> heights(this->nColumns, 0);
+	unsigned int nTokens = 0;
+
+	while (true)
+	{
+		heightsByTokens[nTokens].push_back(heights);
+
+		unsigned int x = 0;
+
+		while (x < this->nColumns && heights[x] == this->nRows)
+		{
+			nTokens -= heights[x];
+			heights[x++] = 0;
+		}
+
+		if (x == this->nColumns)
+		{
+			break;
+		}
+
+		heights[x]++;
+		nTokens++;
+	}
+
+	std::size_t nPositions = 0;
+
+	for (nTokens = nCells + 1; nTokens-- > 0; )
+	{
+		const std::vector<std::vector<unsigned int> >& combinations = heightsByTokens[nTokens];
+		std::atomic<std::size_t> nextCombination(0);
+		std::vector<std::future<std::size_t> > results;
+
+		for (unsigned int i = 0; i < this->nThreads; ++i)
+		{
+			results.push_back(std::async(std::launch::async, [this, &combinations, &nextCombination]()
+			{
+				std::size_t nThreadPositions = 0;
+
+				for (std::size_t i = nextCombination++; i < combinations.size(); i = nextCombination++)
+				{
+					nThreadPositions += this->computeScores(combinations[i]);
+				}
+
+				return nThreadPositions;
+			}));
+		}
+
+		for (auto& result : results)
+		{
+			nPositions += result.get();
+		}
+
+		if (this->progressCallback)
+		{
+			this->progressCallback(nTokens);
+		}
+	}
+
+	Tablebase::write(fileName, this->nColumns, this->nRows, this->entries);
+
+	return nPositions;
+}
+
+/**
+ * Computes the scores of all positions with the given column heights.
+ *
+ * The scores of the positions with one more token must already be computed. Called by several
+ * threads at the same time, every position is only written by the thread which computes it.
+ *
+ * @param heights Height of every column.
+ * @return Number of positions with a valid score.
+ */
+std::size_t TablebaseGenerator::computeScores(const std::vector<unsigned int>& heights)
+{
+	int nCells = this->nColumns * this->nRows;
+	std::uint64_t base = (std::uint64_t(1) << (this->nRows + 1)) - 1;
+	std::uint64_t power = 1;
+	std::uint64_t emptyIndex = 0;
+	std::vector<std::uint64_t> powers(this->nColumns);
+	unsigned int nTokens = 0;
+
+	for (unsigned int x = 0; x < this->nColumns; ++x)
+	{
+		powers[x] = power;
+		emptyIndex += ((std::uint64_t(1) << heights[x]) - 1) * power;
+		nTokens += heights[x];
+		power *= base;
+	}
+
+	// The player who makes the next move (player 0 of the bit board) has nTokens / 2 tokens. The
+	// patterns with this number of bits are enumerated in increasing order (Gosper's hack), bit i of
+	// a pattern is the i-th token, counting the columns from the left and the tokens of a column
+	// from the bottom.
+
+	unsigned int nPlayerTokens = nTokens / 2;
+	std::uint64_t lastPattern = std::uint64_t(1) << nTokens;
+	std::uint64_t pattern = (std::uint64_t(1) << nPlayerTokens) - 1;
+	std::size_t nPositions = 0;
+	BitBoard board(this->nColumns, this->nRows);
+
+	for (; pattern < lastPattern; )
+	{
+		std::uint64_t index = emptyIndex;
+		unsigned int bit = 0;
+
+		board.clear();
+
+		for (unsigned int x = 0; x < this->nColumns; ++x)
+		{
+			std::uint64_t columnPattern = (pattern >> bit) & ((std::uint64_t(1) << heights[x]) - 1);
+
+			for (unsigned int i = 0; i < heights[x]; ++i)
+			{
+				board.dropToken(x, ((columnPattern >> i) & 1) ? 0 : 1);
+			}
+
+			index += columnPattern * powers[x];
+			bit += heights[x];
+		}
+
+		if (!board.hasWon(0) && !board.hasWon(1))
+		{
+			// See Tablebase::findBestMove() for the index after a move.
+
+			int bestScore = (static_cast<int>(nTokens) == nCells) ? 0 : -nCells;
+
+			for (unsigned int x = 0; x < this->nColumns; ++x)
+			{
+				if (heights[x] == this->nRows)
+				{
+					continue;
+				}
+
+				board.dropToken(x, 0);
+
+				int score = board.hasWon(0) ? (nCells + 1 - static_cast<int>(nTokens)) / 2 :
+				            -this->entries[3 * emptyIndex - index +
+				                           (std::uint64_t(1) << heights[x]) * powers[x]];
+
+				board.removeToken(x);
+				bestScore = std::max(bestScore, score);
+			}
+
+			this->entries[index] = static_cast<Tablebase::EntryType>(bestScore);
+			nPositions++;
+		}
+
+		if (pattern == 0)
+		{
+			break;
+		}
+
+		std::uint64_t lowestBit = pattern & (~pattern + 1);
+		std::uint64_t ripple = pattern + lowestBit;
+
+		pattern = (((ripple ^ pattern) >> 2) / lowestBit) | ripple;
+	}
+
+	return nPositions;
+}
+
+}
+}
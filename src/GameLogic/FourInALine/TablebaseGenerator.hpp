@@ -0,0 +1,80 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_TABLEBASEGENERATOR_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_TABLEBASEGENERATOR_HPP
+
+#include "Tablebase.hpp"
+
+#include <QString>
+
+#include <functional>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Generates tablebases.
+ *
+ * Every move adds a token, so the positions with n tokens only depend on the positions with n + 1
+ * tokens. The generator computes the scores backwards (retrograde), starting with the full boards
+ * and ending with the empty board, one number of tokens after another. The positions with the same
+ * number of tokens are independent of each other, so they are split among several threads: a thread
+ * takes the next combination of column heights and computes the scores of all positions with these
+ * heights, until all combinations are done.
+ *
+ * Only the positions which can occur in a game are computed, i.e. the player who makes the next move
+ * has as many tokens as the other player or one token less, and there are no four tokens in a line.
+ * The result is written with Tablebase::write().
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class TablebaseGenerator
+{
+	public:
+		/**
+		 * Function called after the positions with the given number of tokens were computed.
+		 */
+		using ProgressCallbackType = std::function<void(unsigned int nTokens)>;
+
+		TablebaseGenerator(unsigned int nColumns, unsigned int nRows);
+		virtual ~TablebaseGenerator();
+
+		void setNumberOfThreads(unsigned int nThreads);
+		void setProgressCallback(ProgressCallbackType progressCallback);
+
+		std::size_t generate(const QString& fileName);
+
+	private:
+		std::size_t computeScores(const std::vector<unsigned int>& heights);
+
+		/**
+		 * Number of columns of the board.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows of the board.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * Number of threads computing the scores.
+		 */
+		unsigned int nThreads;
+
+		/**
+		 * Called after the positions with a number of tokens were computed.
+		 */
+		ProgressCallbackType progressCallback;
+
+		/**
+		 * Score of every index, see Tablebase::computeIndex().
+		 */
+		std::vector<Tablebase::EntryType> entries;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_TABLEBASEGENERATOR_HPP
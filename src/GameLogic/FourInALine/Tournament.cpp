@@ -0,0 +1,407 @@
+#include "Tournament.hpp"
+#include "Game.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Returns the number of played games.
+ *
+ * @return Number of games.
+ */
+unsigned int Tournament::Result::getNumberOfGames() const
+{
+	return this->nWins + this->nDraws + this->nLosses;
+}
+
+/**
+ * Returns the score of the first engine, 1 for a win, 0.5 for a draw and 0 for a loss per game.
+ *
+ * @return Average score per game, from 0 to 1. 0.5 when no game was played.
+ */
+double Tournament::Result::getScore() const
+{
+	unsigned int nGames = this->getNumberOfGames();
+
+	if (nGames == 0)
+	{
+		return 0.5;
+	}
+
+	return (this->nWins + 0.5 * this->nDraws) / nGames;
+}
+
+/**
+ * Returns the Elo difference between the first and the second engine.
+ *
+ * @return Elo difference, positive when the first engine is stronger. Infinite when one engine won
+ *         all games.
+ */
+double Tournament::Result::getEloDifference() const
+{
+	return Tournament::computeEloDifference(this->getScore());
+}
+
+/**
+ * Returns the margin of the Elo difference for a confidence of 95%.
+ *
+ * The standard error of the score is computed from the results of the games, the margin is half of
+ * the Elo difference between the upper and the lower bound of the score.
+ *
+ * @return The Elo difference is in the range difference +/- margin with a probability of 95%.
+ *         Infinite when a bound of the score is 0 or 1.
+ */
+double Tournament::Result::getEloErrorMargin() const
+{
+	unsigned int nGames = this->getNumberOfGames();
+
+	if (nGames == 0)
+	{
+		return std::numeric_limits<double>::infinity();
+	}
+
+	double score = this->getScore();
+	double variance = (this->nWins * (1.0 - score) * (1.0 - score) +
+	                   this->nDraws * (0.5 - score) * (0.5 - score) +
+	                   this->nLosses * score * score) / nGames;
+	double standardError = std::sqrt(variance / nGames);
+	double lowerElo = Tournament::computeEloDifference(score - 1.96 * standardError);
+	double upperElo = Tournament::computeEloDifference(score + 1.96 * standardError);
+
+	if (std::isinf(lowerElo) || std::isinf(upperElo))
+	{
+		return std::numeric_limits<double>::infinity();
+	}
+
+	return (upperElo - lowerElo) / 2.0;
+}
+
+/**
+ * Returns the average time per move of the given engine.
+ *
+ * @param engine 0 for the first engine, 1 for the second engine.
+ * @return Average time per move, 0 when the engine made no move.
+ */
+std::chrono::microseconds Tournament::Result::getAverageMoveTime(unsigned int engine) const
+{
+	if (engine > 1)
+	{
+		throw std::invalid_argument("There are only two engines.");
+	}
+
+	if (this->nMoves[engine] == 0)
+	{
+		return std::chrono::microseconds(0);
+	}
+
+	return this->moveTime[engine] / this->nMoves[engine];
+}
+
+/**
+ * Returns the number of games played per second.
+ *
+ * @return Games per second, 0 when no time was measured.
+ */
+double Tournament::Result::getGamesPerSecond() const
+{
+	if (this->elapsedTime.count() <= 0)
+	{
+		return 0.0;
+	}
+
+	return this->getNumberOfGames() * 1000000.0 / this->elapsedTime.count();
+}
+
+/**
+ * Returns the default engine configuration: a search with a search depth of 4, no budgets and the
+ * default evaluation weights.
+ *
+ * @return The default configuration.
+ */
+Tournament::EngineConfiguration Tournament::getDefaultConfiguration()
+{
+	EngineConfiguration configuration;
+
+	configuration.type = EngineType::SEARCH;
+	configuration.searchDepth = 4;
+	configuration.timeBudget = std::chrono::milliseconds(0);
+	configuration.nodeBudget = 0;
+	configuration.evaluationWeights = ArtificialIntelligence::DEFAULT_EVALUATION_WEIGHTS;
+
+	return configuration;
+}
+
+/**
+ * Computes the Elo difference which corresponds to the given score.
+ *
+ * @param score Average score per game, from 0 to 1.
+ * @return Elo difference, -infinity for a score of 0 and +infinity for a score of 1.
+ */
+double Tournament::computeEloDifference(double score)
+{
+	if (score <= 0.0)
+	{
+		return -std::numeric_limits<double>::infinity();
+	}
+
+	if (score >= 1.0)
+	{
+		return std::numeric_limits<double>::infinity();
+	}
+
+	return -400.0 * std::log10(1.0 / score - 1.0);
+}
+
+/**
+ * Creates a new tournament between the given engines on boards of the given size.
+ *
+ * By default 100 games are played with one thread per processor core and 2 opening moves.
+ *
+ * @param first Configuration of the first engine.
+ * @param second Configuration of the second engine.
+ * @param nColumns Number of columns of the board.
+ * @param nRows Number of rows of the board.
+ */
+Tournament::Tournament(const Tournament::EngineConfiguration& first,
+                       const Tournament::EngineConfiguration& second,
+                       unsigned int nColumns, unsigned int nRows)
+    : configurations { first, second }, nColumns(nColumns), nRows(nRows), nGames(100), nThreads(1),
+      nOpeningMoves(2), seed(1)
+{
+	if (nColumns == 0 || nRows == 0)
+	{
+		throw std::invalid_argument("The board must have at least one column and one row.");
+	}
+
+	this->setNumberOfThreads(0);
+}
+
+/**
+ * Frees all used resources.
+ */
+Tournament::~Tournament()
+{
+
+}
+
+/**
+ * Sets the number of games.
+ *
+ * The games are played in pairs with swapped colors, so an odd number is rounded up.
+ *
+ * @param nGames Number of games.
+ */
+void Tournament::setNumberOfGames(unsigned int nGames)
+{
+	this->nGames = nGames + nGames % 2;
+}
+
+/**
+ * Returns the number of games.
+ *
+ * @return Number of games, always even.
+ */
+unsigned int Tournament::getNumberOfGames() const
+{
+	return this->nGames;
+}
+
+/**
+ * Sets the number of threads playing games.
+ *
+ * @param nThreads Number of threads, 0 for one thread per processor core.
+ */
+void Tournament::setNumberOfThreads(unsigned int nThreads)
+{
+	if (nThreads == 0)
+	{
+		nThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	this->nThreads = nThreads;
+}
+
+/**
+ * Sets the number of random moves at the beginning of every game.
+ *
+ * The random moves never end the game.
+ *
+ * @param nOpeningMoves Number of random moves.
+ */
+void Tournament::setNumberOfOpeningMoves(unsigned int nOpeningMoves)
+{
+	this->nOpeningMoves = nOpeningMoves;
+}
+
+/**
+ * Sets the seed of the random openings.
+ *
+ * @param seed The seed.
+ */
+void Tournament::setSeed(unsigned int seed)
+{
+	this->seed = seed;
+}
+
+/**
+ * Plays all games and returns the result.
+ *
+ * @return The result, from the point of view of the first engine.
+ */
+Tournament::Result Tournament::run() const
+{
+	auto startTime = std::chrono::steady_clock::now();
+	std::atomic<unsigned int> nextGame(0);
+	std::vector<std::future<Result> > results;
+	unsigned int nThreads = std::max(1u, std::min(this->nThreads, this->nGames));
+
+	for (unsigned int i = 0; i < nThreads; ++i)
+	{
+		results.push_back(std::async(std::launch::async, [this, &nextGame]()
+		{
+			Result threadResult = Result();
+			std::unique_ptr<ArtificialIntelligence> first = this->createEngine(this->configurations[0]);
+			std::unique_ptr<ArtificialIntelligence> second = this->createEngine(this->configurations[1]);
+			ArtificialIntelligence* const engines[2] = { first.get(), second.get() };
+
+			for (unsigned int gameNo = nextGame++; gameNo < this->nGames; gameNo = nextGame++)
+			{
+				this->playGame(gameNo, engines, threadResult);
+			}
+
+			return threadResult;
+		}));
+	}
+
+	Result result = Result();
+
+	for (auto& future : results)
+	{
+		Result threadResult = future.get();
+
+		result.nWins += threadResult.nWins;
+		result.nDraws += threadResult.nDraws;
+		result.nLosses += threadResult.nLosses;
+
+		for (unsigned int engine = 0; engine < 2; ++engine)
+		{
+			result.nMoves[engine] += threadResult.nMoves[engine];
+			result.moveTime[engine] += threadResult.moveTime[engine];
+		}
+	}
+
+	result.elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(
+	                         std::chrono::steady_clock::now() - startTime);
+
+	return result;
+}
+
+/**
+ * Creates an engine with the given configuration.
+ *
+ * @param configuration The configuration.
+ * @return The engine.
+ */
+std::unique_ptr<ArtificialIntelligence>
+Tournament::createEngine(const Tournament::EngineConfiguration& configuration) const
+{
+	std::unique_ptr<ArtificialIntelligence> engine(new ArtificialIntelligence(configuration.searchDepth));
+
+	engine->setTimeBudget(configuration.timeBudget);
+	engine->setNodeBudget(configuration.nodeBudget);
+	engine->setEvaluationWeights(configuration.evaluationWeights);
+	engine->setPerfectPlay(configuration.type == EngineType::PERFECT);
+
+	if (configuration.type == EngineType::MONTE_CARLO_TREE_SEARCH)
+	{
+		engine->setSearchAlgorithm(ArtificialIntelligence::SearchAlgorithm::MONTE_CARLO_TREE_SEARCH);
+	}
+
+	return engine;
+}
+
+/**
+ * Plays the game with the given number and adds its outcome to the given result.
+ *
+ * Games 2n and 2n + 1 start with the same random opening. In even games the first engine plays
+ * Game::PLAYER_ONE, in odd games Game::PLAYER_TWO.
+ *
+ * @param gameNo Number of the game.
+ * @param engines The first and the second engine.
+ * @param result The outcome, the number of moves and the time per move are added to this result.
+ */
+void Tournament::playGame(unsigned int gameNo, ArtificialIntelligence* const engines[2],
+                          Tournament::Result& result) const
+{
+	Game game(this->nRows, this->nColumns, Game::PLAYER_ONE);
+	std::mt19937 random(this->seed + gameNo / 2);
+
+	for (unsigned int i = 0; i < this->nOpeningMoves; ++i)
+	{
+		// Random moves which end the game are skipped, the opening ends when there is none left.
+
+		std::vector<unsigned int> moves = game.getBoard()->getAvailableColumns();
+		std::shuffle(moves.begin(), moves.end(), random);
+
+		auto move = std::find_if(moves.begin(), moves.end(), [&game](unsigned int column)
+		{
+			game.makeMove(column);
+			bool isOver = game.isOver();
+			game.undoLastMove();
+
+			return !isOver;
+		});
+
+		if (move == moves.end())
+		{
+			break;
+		}
+
+		game.makeMove(*move);
+	}
+
+	unsigned int firstEnginePlayer = (gameNo % 2 == 0) ? Game::PLAYER_ONE : Game::PLAYER_TWO;
+
+	while (!game.isOver())
+	{
+		unsigned int engine = (game.getCurrentPlayer() == firstEnginePlayer) ? 0 : 1;
+		auto startTime = std::chrono::steady_clock::now();
+		unsigned int move = engines[engine]->computeNextMove(game);
+
+		result.moveTime[engine] += std::chrono::duration_cast<std::chrono::microseconds>(
+		                               std::chrono::steady_clock::now() - startTime);
+		result.nMoves[engine]++;
+
+		// The game throws an exception when the move is not possible.
+
+		game.makeMove(move);
+	}
+
+	if (game.isDraw())
+	{
+		result.nDraws++;
+	}
+	else if (game.getWinner() == firstEnginePlayer)
+	{
+		result.nWins++;
+	}
+	else
+	{
+		result.nLosses++;
+	}
+}
+
+}
+}
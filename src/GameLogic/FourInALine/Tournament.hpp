@@ -0,0 +1,179 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_TOURNAMENT_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_TOURNAMENT_HPP
+
+#include "ArtificialIntelligence.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Plays games between two engine configurations to compare their strength and speed.
+ *
+ * The engines play against each other without a GUI, a Game is the referee. The games are played in
+ * pairs: both games of a pair start with the same random opening (see setNumberOfOpeningMoves()),
+ * the engines swap colors for the second game. Without openings, two deterministic engines would
+ * play the same two games over and over again. The openings only depend on the seed (see setSeed()),
+ * so a tournament can be repeated with other engine configurations.
+ *
+ * The games are split among several threads (see setNumberOfThreads()): a thread takes the next
+ * game that was not played yet, until all games are played. Every thread has its own engines, the
+ * engines themselves use one thread each.
+ *
+ * The result contains the wins, draws and losses of the first engine, the Elo difference between
+ * the engines with its 95% confidence interval, the average time per move of each engine and the
+ * number of games per second.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class Tournament
+{
+	public:
+		/**
+		 * Type of an engine.
+		 */
+		enum class EngineType
+		{
+			SEARCH = 1,                 ///< Heuristic alpha-beta search.
+			PERFECT = 2,                ///< The solver, with the search as fallback (see setPerfectPlay()).
+			MONTE_CARLO_TREE_SEARCH = 3 ///< Monte Carlo tree search, the node budget is the number of playouts.
+		};
+
+		/**
+		 * Configuration of an engine.
+		 */
+		struct EngineConfiguration
+		{
+			/**
+			 * Type of the engine.
+			 */
+			EngineType type;
+
+			/**
+			 * Search depth.
+			 */
+			unsigned int searchDepth;
+
+			/**
+			 * Time budget per move, 0 for none.
+			 */
+			std::chrono::milliseconds timeBudget;
+
+			/**
+			 * Node budget per move, 0 for none.
+			 */
+			unsigned long long nodeBudget;
+
+			/**
+			 * Weights of the evaluation.
+			 */
+			ArtificialIntelligence::EvaluationWeights evaluationWeights;
+		};
+
+		/**
+		 * Result of a tournament, from the point of view of the first engine.
+		 */
+		struct Result
+		{
+			/**
+			 * Number of games won by the first engine.
+			 */
+			unsigned int nWins;
+
+			/**
+			 * Number of drawn games.
+			 */
+			unsigned int nDraws;
+
+			/**
+			 * Number of games lost by the first engine.
+			 */
+			unsigned int nLosses;
+
+			/**
+			 * Number of moves made by each engine.
+			 */
+			unsigned long long nMoves[2];
+
+			/**
+			 * Time used by each engine for all of its moves.
+			 */
+			std::chrono::microseconds moveTime[2];
+
+			/**
+			 * Time used by the whole tournament.
+			 */
+			std::chrono::microseconds elapsedTime;
+
+			unsigned int getNumberOfGames() const;
+			double getScore() const;
+			double getEloDifference() const;
+			double getEloErrorMargin() const;
+			std::chrono::microseconds getAverageMoveTime(unsigned int engine) const;
+			double getGamesPerSecond() const;
+		};
+
+		static EngineConfiguration getDefaultConfiguration();
+		static double computeEloDifference(double score);
+
+		Tournament(const EngineConfiguration& first, const EngineConfiguration& second,
+		           unsigned int nColumns, unsigned int nRows);
+		virtual ~Tournament();
+
+		void setNumberOfGames(unsigned int nGames);
+		unsigned int getNumberOfGames() const;
+		void setNumberOfThreads(unsigned int nThreads);
+		void setNumberOfOpeningMoves(unsigned int nOpeningMoves);
+		void setSeed(unsigned int seed);
+
+		Result run() const;
+
+	protected:
+		virtual std::unique_ptr<ArtificialIntelligence> createEngine(const EngineConfiguration& configuration) const;
+		void playGame(unsigned int gameNo, ArtificialIntelligence* const engines[2], Result& result) const;
+
+	private:
+		/**
+		 * Configurations of the first and the second engine.
+		 */
+		EngineConfiguration configurations[2];
+
+		/**
+		 * Number of columns of the board.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows of the board.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * Number of games, always even.
+		 */
+		unsigned int nGames;
+
+		/**
+		 * Number of threads playing games.
+		 */
+		unsigned int nThreads;
+
+		/**
+		 * Number of random moves at the beginning of every game.
+		 */
+		unsigned int nOpeningMoves;
+
+		/**
+		 * Seed of the random openings.
+		 */
+		unsigned int seed;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_TOURNAMENT_HPP
@@ -0,0 +1,137 @@
+#include "TranspositionTable.hpp"
+
+#include <algorithm>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const std::uint8_t TranspositionTable::NO_MOVE = 0xff;
+
+/**
+ * Creates a new empty transposition table with the given number of entries.
+ *
+ * @param nEntries Number of entries, rounded down to a power of 2. 0 disables the table.
+ */
+TranspositionTable::TranspositionTable(std::size_t nEntries)
+{
+	this->resize(nEntries);
+}
+
+/**
+ * Changes the number of entries of the table and clears it.
+ *
+ * @param nEntries Number of entries, rounded down to a power of 2. 0 disables the table.
+ */
+void TranspositionTable::resize(std::size_t nEntries)
+{
+	std::size_t size = 0;
+
+	if (nEntries > 0)
+	{
+		size = 1;
+
+		while (size <= nEntries / 2)
+		{
+			size *= 2;
+		}
+	}
+
+	this->entries = std::vector<Entry>(size);
+	this->indexMask = (size > 0) ? size - 1 : 0;
+	this->generation = 0;
+	this->clear();
+}
+
+/**
+ * Returns the number of entries of the table.
+ *
+ * @return Number of entries.
+ */
+std::size_t TranspositionTable::getSize() const
+{
+	return this->entries.size();
+}
+
+/**
+ * Removes all entries from the table.
+ *
+ * Starts a new generation, only when the generation counter wraps around all entries are
+ * overwritten.
+ */
+void TranspositionTable::clear()
+{
+	this->generation++;
+
+	if (this->generation != 1)
+	{
+		return;
+	}
+
+	Entry emptyEntry;
+	emptyEntry.key = 0;
+	emptyEntry.score = 0;
+	emptyEntry.depth = 0;
+	emptyEntry.generation = 0;
+	emptyEntry.bound = Bound::EXACT;
+	emptyEntry.bestMove = TranspositionTable::NO_MOVE;
+
+	std::fill(this->entries.begin(), this->entries.end(), emptyEntry);
+}
+
+/**
+ * Looks up the entry of the position with the given key.
+ *
+ * @param key Key of the position.
+ * @param entry When an entry was found, it is stored here.
+ * @return When an entry was found true, otherwise false.
+ */
+bool TranspositionTable::lookup(std::uint64_t key, Entry& entry) const
+{
+	if (this->entries.empty() || key == 0)
+	{
+		return false;
+	}
+
+	const Entry& storedEntry = this->entries[key & this->indexMask];
+
+	if (storedEntry.key != key || storedEntry.generation != this->generation)
+	{
+		return false;
+	}
+
+	entry = storedEntry;
+
+	return true;
+}
+
+/**
+ * Stores the result of a search in the table, replacing the entry which used the same slot.
+ *
+ * @param key Key of the position.
+ * @param depth Remaining search depth used to compute the score, at most 255.
+ * @param bound Whether the score is exact or a bound.
+ * @param score Score of the position.
+ * @param bestMove Column of the best move or NO_MOVE.
+ */
+void TranspositionTable::store(std::uint64_t key, unsigned int depth, Bound bound, int score,
+                               unsigned int bestMove)
+{
+	if (this->entries.empty() || key == 0)
+	{
+		return;
+	}
+
+	Entry& entry = this->entries[key & this->indexMask];
+
+	entry.key = key;
+	entry.score = score;
+	entry.depth = static_cast<std::uint8_t>(depth);
+	entry.generation = this->generation;
+	entry.bound = bound;
+	entry.bestMove = static_cast<std::uint8_t>(std::min<unsigned int>(bestMove, TranspositionTable::NO_MOVE));
+}
+
+}
+}
@@ -0,0 +1,116 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_TRANSPOSITIONTABLE_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_TRANSPOSITIONTABLE_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Fixed-size table storing results of already searched positions.
+ *
+ * The same position can be reached through different sequences of moves (transpositions). The
+ * transposition table remembers the score of searched positions, so that the artificial
+ * intelligence does not have to search them again.
+ *
+ * Positions are identified by a 64 bit key (e.g. Board::getCanonicalHashKey() combined with the
+ * player to move). Every entry stores the full key, the remaining search depth, the score, whether
+ * the score is exact or only a lower/upper bound (because of alpha-beta-pruning) and the best move.
+ *
+ * The table has a fixed number of entries, which is rounded down to a power of 2. The entry used
+ * for a key is determined by the lower bits of the key, a new entry always replaces the old entry.
+ * A table with 0 entries is disabled, nothing is stored and lookup() never finds anything.
+ *
+ * Clearing the table usually takes constant time: every entry stores the generation of the table in
+ * which it was stored, clear() starts a new generation and entries of older generations are ignored.
+ *
+ * This class is reentrant but not thread-safe.
+ */
+class TranspositionTable
+{
+	public:
+		/**
+		 * Type of the score stored in an entry.
+		 */
+		enum class Bound : std::uint8_t
+		{
+			EXACT, ///< The score is the exact score of the position.
+			LOWER, ///< The score is a lower bound, the exact score may be higher.
+			UPPER  ///< The score is an upper bound, the exact score may be lower.
+		};
+
+		/**
+		 * Entry of the transposition table.
+		 */
+		struct Entry
+		{
+			/**
+			 * Key of the position.
+			 */
+			std::uint64_t key;
+
+			/**
+			 * Score of the position.
+			 */
+			std::int32_t score;
+
+			/**
+			 * Remaining search depth used to compute the score.
+			 */
+			std::uint8_t depth;
+
+			/**
+			 * Generation of the table in which the entry was stored.
+			 */
+			std::uint8_t generation;
+
+			/**
+			 * Whether the score is exact or a bound.
+			 */
+			Bound bound;
+
+			/**
+			 * Column of the best move.
+			 */
+			std::uint8_t bestMove;
+		};
+
+		/**
+		 * Value of Entry::bestMove when the best move is not known.
+		 */
+		static const std::uint8_t NO_MOVE;
+
+		explicit TranspositionTable(std::size_t nEntries);
+
+		void resize(std::size_t nEntries);
+		std::size_t getSize() const;
+
+		void clear();
+
+		bool lookup(std::uint64_t key, Entry& entry) const;
+		void store(std::uint64_t key, unsigned int depth, Bound bound, int score, unsigned int bestMove);
+
+	private:
+		/**
+		 * The entries, an entry with the key 0 is empty.
+		 */
+		std::vector<Entry> entries;
+
+		/**
+		 * Mask used to compute the index of the entry from the key.
+		 */
+		std::uint64_t indexMask;
+
+		/**
+		 * Current generation, only entries of this generation are valid.
+		 */
+		std::uint8_t generation;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_TRANSPOSITIONTABLE_HPP
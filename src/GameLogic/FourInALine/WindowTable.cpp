@@ -0,0 +1,241 @@
+#include "WindowTable.hpp"
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+const unsigned int WindowTable::WINDOW_SIZE = 4;
+
+/**
+ * Directions of the rows (delta x, delta y), in the order of ::GameLogic::Board::getAllRows().
+ */
+static const int DIRECTIONS[4][2] = { { 1, 0 }, { 0, 1 }, { -1, 1 }, { 1, 1 } };
+
+/**
+ * Returns the window table of the given board geometry.
+ *
+ * The table is created on the first call for a geometry, later calls return the same table. This
+ * method is thread-safe.
+ *
+ * @param nColumns Number of columns.
+ * @param nRows Number of rows.
+ * @return The window table.
+ */
+std::shared_ptr<const WindowTable> WindowTable::getInstance(unsigned int nColumns, unsigned int nRows)
+{
+	static std::mutex mutex;
+	static std::map<std::pair<unsigned int, unsigned int>, std::shared_ptr<const WindowTable> > tables;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto& table = tables[std::make_pair(nColumns, nRows)];
+
+	if (!table)
+	{
+		table = std::make_shared<const WindowTable>(nColumns, nRows);
+	}
+
+	return table;
+}
+
+/**
+ * Creates the window table for a board with the given dimensions.
+ *
+ * Use getInstance() instead to share the table with other boards.
+ *
+ * @param nColumns Number of columns.
+ * @param nRows Number of rows.
+ */
+WindowTable::WindowTable(unsigned int nColumns, unsigned int nRows)
+    : nColumns(nColumns), nRows(nRows)
+{
+	// Horizontal and vertical rows.
+
+	for (unsigned int y = 0; y < nRows; ++y)
+	{
+		this->addWindows(0, y, DIRECTIONS[0][0], DIRECTIONS[0][1], 0);
+	}
+
+	for (unsigned int x = 0; x < nColumns; ++x)
+	{
+		this->addWindows(x, 0, DIRECTIONS[1][0], DIRECTIONS[1][1], 1);
+	}
+
+	// Minor diagonal rows start in the top row or in the right column.
+
+	for (unsigned int x = 0; x < nColumns; ++x)
+	{
+		this->addWindows(x, 0, DIRECTIONS[2][0], DIRECTIONS[2][1], 2);
+	}
+
+	for (unsigned int y = 1; y < nRows; ++y)
+	{
+		this->addWindows(nColumns - 1, y, DIRECTIONS[2][0], DIRECTIONS[2][1], 2);
+	}
+
+	// Major diagonal rows start in the top row or in the left column.
+
+	for (unsigned int x = 0; x < nColumns; ++x)
+	{
+		this->addWindows(x, 0, DIRECTIONS[3][0], DIRECTIONS[3][1], 3);
+	}
+
+	for (unsigned int y = 1; y < nRows; ++y)
+	{
+		this->addWindows(0, y, DIRECTIONS[3][0], DIRECTIONS[3][1], 3);
+	}
+
+	// Build the reverse map from cells to windows, windows are added in ascending order.
+
+	unsigned int nCells = nColumns * nRows;
+	unsigned int nWindows = this->getNumberOfWindows();
+
+	this->cellWindowOffsets.assign(nCells + 1, 0);
+
+	for (unsigned int cell : this->windowCells)
+	{
+		this->cellWindowOffsets[cell + 1]++;
+	}
+
+	for (unsigned int cell = 0; cell < nCells; ++cell)
+	{
+		this->cellWindowOffsets[cell + 1] += this->cellWindowOffsets[cell];
+	}
+
+	std::vector<unsigned int> nextEntry(this->cellWindowOffsets.begin(), this->cellWindowOffsets.end() - 1);
+	this->cellWindows.resize(this->windowCells.size());
+
+	for (unsigned int window = 0; window < nWindows; ++window)
+	{
+		for (unsigned int i = 0; i < WindowTable::WINDOW_SIZE; ++i)
+		{
+			unsigned int cell = this->windowCells[window * WindowTable::WINDOW_SIZE + i];
+			this->cellWindows[nextEntry[cell]++] = window;
+		}
+	}
+}
+
+/**
+ * Returns the number of columns.
+ *
+ * @return Number of columns.
+ */
+unsigned int WindowTable::getNumberOfColumns() const
+{
+	return this->nColumns;
+}
+
+/**
+ * Returns the number of rows.
+ *
+ * @return Number of rows.
+ */
+unsigned int WindowTable::getNumberOfRows() const
+{
+	return this->nRows;
+}
+
+/**
+ * Returns the number of windows.
+ *
+ * @return Number of windows.
+ */
+unsigned int WindowTable::getNumberOfWindows() const
+{
+	return this->windowDirections.size();
+}
+
+/**
+ * Returns the indices of the cells of the given window.
+ *
+ * @param window Index of the window.
+ * @return Pointer to WINDOW_SIZE cell indices.
+ */
+const unsigned int* WindowTable::getWindowCells(unsigned int window) const
+{
+	return &this->windowCells[window * WindowTable::WINDOW_SIZE];
+}
+
+/**
+ * Returns the difference on the x axis between two consecutive cells of the given window.
+ *
+ * @param window Index of the window.
+ * @return Delta x of the window.
+ */
+int WindowTable::getWindowDeltaX(unsigned int window) const
+{
+	return DIRECTIONS[this->windowDirections[window]][0];
+}
+
+/**
+ * Returns the difference on the y axis between two consecutive cells of the given window.
+ *
+ * @param window Index of the window.
+ * @return Delta y of the window.
+ */
+int WindowTable::getWindowDeltaY(unsigned int window) const
+{
+	return DIRECTIONS[this->windowDirections[window]][1];
+}
+
+/**
+ * Returns the number of windows that contain the given cell.
+ *
+ * @param cell Index of the cell.
+ * @return Number of windows containing the cell.
+ */
+unsigned int WindowTable::getNumberOfWindowsContaining(unsigned int cell) const
+{
+	return this->cellWindowOffsets[cell + 1] - this->cellWindowOffsets[cell];
+}
+
+/**
+ * Returns the windows that contain the given cell, in ascending order.
+ *
+ * @param cell Index of the cell.
+ * @return Pointer to getNumberOfWindowsContaining(cell) window indices.
+ */
+const unsigned int* WindowTable::getWindowsContaining(unsigned int cell) const
+{
+	return this->cellWindows.data() + this->cellWindowOffsets[cell];
+}
+
+/**
+ * Adds all windows of the row starting at the given position.
+ *
+ * @param startX Position of the first cell of the row on the x axis.
+ * @param startY Position of the first cell of the row on the y axis.
+ * @param deltaX Difference on the x axis between two consecutive cells of the row.
+ * @param deltaY Difference on the y axis between two consecutive cells of the row.
+ * @param direction Index of the direction of the row.
+ */
+void WindowTable::addWindows(unsigned int startX, unsigned int startY, int deltaX, int deltaY,
+                             unsigned int direction)
+{
+	std::vector<unsigned int> row;
+	int x = static_cast<int>(startX);
+	int y = static_cast<int>(startY);
+
+	while (x >= 0 && x < static_cast<int>(this->nColumns) && y >= 0 && y < static_cast<int>(this->nRows))
+	{
+		row.push_back(y * this->nColumns + x);
+		x += deltaX;
+		y += deltaY;
+	}
+
+	for (unsigned int i = 0; i + WindowTable::WINDOW_SIZE <= row.size(); ++i)
+	{
+		this->windowCells.insert(this->windowCells.end(), row.begin() + i,
+		                         row.begin() + i + WindowTable::WINDOW_SIZE);
+		this->windowDirections.push_back(direction);
+	}
+}
+
+}
+}
@@ -0,0 +1,94 @@
+#ifndef GAMELOGIC_FOUR_IN_A_LINE_WINDOWTABLE_HPP
+#define GAMELOGIC_FOUR_IN_A_LINE_WINDOWTABLE_HPP
+
+#include <memory>
+#include <vector>
+
+namespace GameLogic
+{
+namespace FourInALine
+{
+
+/**
+ * Table of all windows of a board geometry.
+ *
+ * A window consists of 4 consecutive cells in a horizontal, vertical or diagonal row. Every four in
+ * a line is contained in exactly one window, so checking whether a player won or evaluating a
+ * board can be done by iterating over the windows instead of iterating over the rows of the board.
+ *
+ * Cells are identified by their index (y * number of columns + x), which is the index of the cell
+ * in the cell vector of the board. getWindowCells(window) returns the indices of the 4 cells of a
+ * window, getWindowsContaining(cell) returns the windows that contain the given cell.
+ *
+ * The windows are ordered like the rows returned by ::GameLogic::Board::getAllRows() (horizontal,
+ * vertical, minor diagonal and major diagonal rows) and within a row by their position in the row.
+ * The first cell of a window is the first cell in the direction of the row.
+ *
+ * The table only depends on the number of columns and rows. Use getInstance() to retrieve the table
+ * of a board geometry, the table is created once and then shared by all boards with this geometry.
+ *
+ * This class is immutable and therefore thread-safe.
+ */
+class WindowTable
+{
+	public:
+		/**
+		 * Number of cells in a window.
+		 */
+		static const unsigned int WINDOW_SIZE;
+
+		static std::shared_ptr<const WindowTable> getInstance(unsigned int nColumns, unsigned int nRows);
+
+		WindowTable(unsigned int nColumns, unsigned int nRows);
+
+		unsigned int getNumberOfColumns() const;
+		unsigned int getNumberOfRows() const;
+
+		unsigned int getNumberOfWindows() const;
+		const unsigned int* getWindowCells(unsigned int window) const;
+		int getWindowDeltaX(unsigned int window) const;
+		int getWindowDeltaY(unsigned int window) const;
+
+		unsigned int getNumberOfWindowsContaining(unsigned int cell) const;
+		const unsigned int* getWindowsContaining(unsigned int cell) const;
+
+	private:
+		void addWindows(unsigned int startX, unsigned int startY, int deltaX, int deltaY,
+		                unsigned int direction);
+
+		/**
+		 * Number of columns.
+		 */
+		unsigned int nColumns;
+
+		/**
+		 * Number of rows.
+		 */
+		unsigned int nRows;
+
+		/**
+		 * Cell indices of all windows, WINDOW_SIZE consecutive entries per window.
+		 */
+		std::vector<unsigned int> windowCells;
+
+		/**
+		 * Direction of every window, index into the directions table of the implementation.
+		 */
+		std::vector<unsigned int> windowDirections;
+
+		/**
+		 * Offset of the first entry of every cell in cellWindows, contains one additional entry
+		 * with the total number of entries.
+		 */
+		std::vector<unsigned int> cellWindowOffsets;
+
+		/**
+		 * Windows that contain a cell, grouped by cell (see cellWindowOffsets).
+		 */
+		std::vector<unsigned int> cellWindows;
+};
+
+}
+}
+
+#endif // GAMELOGIC_FOUR_IN_A_LINE_WINDOWTABLE_HPP
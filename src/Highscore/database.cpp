@@ -31,7 +31,8 @@ Database::Database()
 Database::~Database()
 {
     QString conName = db.connectionName();
-    delete &db;
+    db.close();
+    db = QSqlDatabase();
     QSqlDatabase::removeDatabase(conName);
 }
 
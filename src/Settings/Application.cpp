@@ -35,9 +35,55 @@ void Application::setLanguage(QString locale)
 	this->language = locale;
 }
 
+/**
+ * Returns whether computer players are limited by a node budget instead of a search depth.
+ *
+ * @return When the node budget is enabled true, otherwise false.
+ */
+bool Application::isNodeBudgetEnabled() const
+{
+	return this->nodeBudgetEnabled;
+}
+
+/**
+ * Sets whether computer players are limited by a node budget instead of a search depth.
+ *
+ * The setting is used by computer players created afterwards.
+ *
+ * @param nodeBudgetEnabled Whether the node budget should be enabled.
+ */
+void Application::setNodeBudgetEnabled(bool nodeBudgetEnabled)
+{
+	this->nodeBudgetEnabled = nodeBudgetEnabled;
+}
+
+/**
+ * Returns whether computer players log the statistics of every search.
+ *
+ * @return When the statistics are logged true, otherwise false.
+ */
+bool Application::isStatisticsLogged() const
+{
+	return this->statisticsLogged;
+}
+
+/**
+ * Sets whether computer players log the statistics of every search.
+ *
+ * The setting is used by computer players created afterwards.
+ *
+ * @param statisticsLogged Whether the statistics should be logged.
+ */
+void Application::setStatisticsLogged(bool statisticsLogged)
+{
+	this->statisticsLogged = statisticsLogged;
+}
+
 void Application::read()
 {
 	this->language = this->getSettings()->value("application/language", "en").toString();
+	this->nodeBudgetEnabled = this->getSettings()->value("application/nodeBudget", false).toBool();
+	this->statisticsLogged = this->getSettings()->value("application/logSearchStatistics", false).toBool();
 
 	emit this->changed();
 }
@@ -47,6 +93,8 @@ void Application::save()
 	emit this->changed();
 
 	this->getSettings()->setValue("application/language", this->language);
+	this->getSettings()->setValue("application/nodeBudget", this->nodeBudgetEnabled);
+	this->getSettings()->setValue("application/logSearchStatistics", this->statisticsLogged);
 
 	emit this->saved();
 }
@@ -8,6 +8,11 @@ namespace Settings
 
 /**
  * Application settings like the GUI language.
+ *
+ * Computer players search with a search depth depending on their level of difficulty. With
+ * setNodeBudgetEnabled() they use a node budget per move instead, so that their moves take about the
+ * same time on every board size. With setStatisticsLogged() they log the statistics of every search,
+ * e.g. to compare the latency of the difficulties, by default nothing is logged.
  */
 class Application : public AbstractSettings
 {
@@ -18,6 +23,12 @@ class Application : public AbstractSettings
 		QString getLanguage() const;
 		void setLanguage(QString locale);
 
+		bool isNodeBudgetEnabled() const;
+		void setNodeBudgetEnabled(bool nodeBudgetEnabled);
+
+		bool isStatisticsLogged() const;
+		void setStatisticsLogged(bool statisticsLogged);
+
 		virtual void read() override;
 		virtual void save() override;
 
@@ -28,6 +39,16 @@ class Application : public AbstractSettings
 		 * The application language (locale).
 		 */
 		QString language;
+
+		/**
+		 * Whether computer players are limited by a node budget instead of a search depth.
+		 */
+		bool nodeBudgetEnabled;
+
+		/**
+		 * Whether computer players log the statistics of every search.
+		 */
+		bool statisticsLogged;
 };
 
 }
@@ -1,8 +1,115 @@
 #include "ArtificialIntelligenceTest.hpp"
 #include "../../../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
 #include "../../../src/GameLogic/FourInALine/Game.hpp"
+#include "../../../src/GameLogic/FourInALine/Solver.hpp"
 
 #include <QDebug>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <random>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Number of memory allocations done with operator new.
+ */
+static std::atomic<unsigned long long> nAllocations(0);
+
+/**
+ * Allocates memory and counts the allocation.
+ *
+ * @param size Number of bytes.
+ * @return Allocated memory.
+ */
+void* operator new(std::size_t size)
+{
+	nAllocations++;
+
+	void* memory = std::malloc((size > 0) ? size : 1);
+
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+/**
+ * Frees memory allocated with operator new.
+ *
+ * @param memory The memory.
+ */
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Artificial intelligence which makes the methods computing the score of a player public.
+ */
+class EvaluatingArtificialIntelligence : public GameLogic::FourInALine::ArtificialIntelligence
+{
+	public:
+		EvaluatingArtificialIntelligence() : ArtificialIntelligence(1) {}
+
+		using ArtificialIntelligence::computePlayerScore;
+		using ArtificialIntelligence::computePlayerScoreFromWindowCounts;
+};
+
+/**
+ * Computes the exact score of the given game for the current player by searching all positions
+ * until the end of the game, see GameLogic::FourInALine::Solver for the meaning of the score.
+ *
+ * @param game The game, it must not be over.
+ * @param scores Already computed scores by hash key of the board.
+ * @return Exact score of the game.
+ */
+static int computeReferenceScore(const GameLogic::FourInALine::Game& game,
+                                 std::map<std::uint64_t, int>& scores)
+{
+	auto board = game.getBoard();
+	std::uint64_t key = board->getHashKey() ^ (game.getCurrentPlayer() * 0x9e3779b97f4a7c15ull);
+	auto score = scores.find(key);
+
+	if (score != scores.end())
+	{
+		return score->second;
+	}
+
+	int nCells = board->getNumberOfColumns() * board->getNumberOfRows();
+	int bestScore = -nCells;
+
+	for (unsigned int x = 0; x < board->getNumberOfColumns(); ++x)
+	{
+		if (!game.isMovePossible(x))
+		{
+			continue;
+		}
+
+		GameLogic::FourInALine::Game nextGame(game);
+		nextGame.makeMove(x);
+
+		if (nextGame.isOver())
+		{
+			// Won with the move, the winner has (nCells + 1 - nMoves) / 2 tokens left, or draw.
+
+			bestScore = std::max(bestScore, nextGame.isDraw() ? 0 :
+			                     (nCells + 2 - static_cast<int>(nextGame.getNumberOfMoves())) / 2);
+		}
+		else
+		{
+			bestScore = std::max(bestScore, -computeReferenceScore(nextGame, scores));
+		}
+	}
+
+	scores[key] = bestScore;
+
+	return bestScore;
+}
 
 /**
  * Checks whether the artificial intelligence is able to detect an obvious win.
@@ -66,6 +173,813 @@ void ArtificialIntelligenceTest::basicTest()
 	QCOMPARE(ai.getSearchDepth(), 4u);
 }
 
+/**
+ * Plays games in which both players make the moves computed with and without transposition table
+ * and checks whether the moves are always the same.
+ */
+void ArtificialIntelligenceTest::transpositionTable()
+{
+	unsigned int columns = 7;
+	unsigned int rows = 6;
+	GameLogic::FourInALine::Game game(columns, rows, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(5);
+	GameLogic::FourInALine::ArtificialIntelligence keepingAi(5);
+	GameLogic::FourInALine::ArtificialIntelligence aiWithoutTable(5);
+
+	keepingAi.setKeepTranspositionTable(true);
+	QVERIFY(keepingAi.isTranspositionTableKept() == true);
+
+	aiWithoutTable.setTranspositionTableSize(0);
+	QCOMPARE(aiWithoutTable.getTranspositionTableSize(), static_cast<std::size_t>(0));
+
+	while (!game.isOver())
+	{
+		unsigned int move = aiWithoutTable.computeNextMove(game);
+
+		QCOMPARE(ai.computeNextMove(game), move);
+		QCOMPARE(keepingAi.computeNextMove(game), move);
+
+		game.makeMove(move);
+	}
+}
+
+/**
+ * Checks whether the search with a time budget stops in time and returns the same move as the
+ * search without time budget when there is enough time.
+ */
+void ArtificialIntelligenceTest::timeBudget()
+{
+	GameLogic::FourInALine::Game bigGame(12, 10, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(40);
+
+	QCOMPARE(ai.hasTimeBudget(), false);
+
+	ai.setTimeBudget(std::chrono::milliseconds(200));
+
+	QCOMPARE(ai.hasTimeBudget(), true);
+	QVERIFY(ai.getTimeBudget() == std::chrono::milliseconds(200));
+
+	auto start = std::chrono::steady_clock::now();
+	unsigned int move = ai.computeNextMove(bigGame);
+	auto duration = std::chrono::steady_clock::now() - start;
+
+	QVERIFY(move < 12);
+	QVERIFY(ai.getCompletedSearchDepth() >= 1);
+	QVERIFY(ai.getCompletedSearchDepth() < 40);
+	QVERIFY(duration < std::chrono::seconds(2));
+
+	// With enough time the full search depth is completed and the result is the same.
+
+	GameLogic::FourInALine::Game game(7, 6, 1);
+	GameLogic::FourInALine::ArtificialIntelligence fixedDepthAi(5);
+
+	game.makeMove(3);
+	game.makeMove(2);
+
+	ai.setSearchDepth(5);
+	ai.setTimeBudget(std::chrono::milliseconds(60000));
+
+	QCOMPARE(ai.computeNextMove(game), fixedDepthAi.computeNextMove(game));
+	QCOMPARE(ai.getCompletedSearchDepth(), 5u);
+
+	// The search does not go deeper than the number of empty cells.
+
+	GameLogic::FourInALine::Game smallGame(4, 4, 1);
+
+	ai.setSearchDepth(40);
+	ai.computeNextMove(smallGame);
+
+	QCOMPARE(ai.getCompletedSearchDepth(), 16u);
+}
+
+/**
+ * Checks whether the search stops when the node budget is used up.
+ */
+void ArtificialIntelligenceTest::nodeBudget()
+{
+	GameLogic::FourInALine::Game bigGame(12, 10, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(40);
+
+	QCOMPARE(ai.hasNodeBudget(), false);
+
+	ai.setNodeBudget(20000);
+
+	QCOMPARE(ai.hasNodeBudget(), true);
+	QCOMPARE(ai.getNodeBudget(), 20000ull);
+
+	unsigned int move = ai.computeNextMove(bigGame);
+
+	QVERIFY(move < 12);
+	QVERIFY(ai.getCompletedSearchDepth() >= 1);
+	QVERIFY(ai.getCompletedSearchDepth() < 40);
+	QVERIFY(ai.getNumberOfNodes() <= 20000);
+
+	// The number of nodes does not depend on the time, so the result is always the same.
+
+	unsigned int completedSearchDepth = ai.getCompletedSearchDepth();
+
+	QCOMPARE(ai.computeNextMove(bigGame), move);
+	QCOMPARE(ai.getCompletedSearchDepth(), completedSearchDepth);
+
+	// With a node budget the search uses one thread, so the number of threads does not change the
+	// result.
+
+	unsigned long long nNodes = ai.getNumberOfNodes();
+
+	ai.setNumberOfThreads(4);
+
+	QCOMPARE(ai.computeNextMove(bigGame), move);
+	QCOMPARE(ai.getCompletedSearchDepth(), completedSearchDepth);
+	QCOMPARE(ai.getNumberOfNodes(), nNodes);
+
+	// With enough nodes the full search depth is completed and the result is the same.
+
+	GameLogic::FourInALine::Game game(7, 6, 1);
+	GameLogic::FourInALine::ArtificialIntelligence fixedDepthAi(5);
+
+	game.makeMove(3);
+	game.makeMove(2);
+
+	ai.setNumberOfThreads(1);
+	ai.setSearchDepth(5);
+	ai.setNodeBudget(100000000);
+
+	QCOMPARE(ai.computeNextMove(game), fixedDepthAi.computeNextMove(game));
+	QCOMPARE(ai.getCompletedSearchDepth(), 5u);
+
+	// The solver gets half of the budget.
+
+	ai.setPerfectPlay(true);
+	ai.setNodeBudget(1000);
+
+	QVERIFY(ai.computeNextMove(game) < 7);
+	QVERIFY(ai.getNumberOfNodes() <= 1000 + 4096);
+
+}
+
+/**
+ * Checks whether the search statistics are filled in by every computation.
+ */
+void ArtificialIntelligenceTest::searchStatistics()
+{
+	GameLogic::FourInALine::Game game(7, 6, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(6);
+
+	game.makeMove(3);
+	game.makeMove(2);
+
+	ai.computeNextMove(game);
+
+	auto statistics = ai.getSearchStatistics();
+
+	QCOMPARE(statistics.nNodes, ai.getNumberOfNodes());
+	QCOMPARE(statistics.depth, 6u);
+	QVERIFY(statistics.nBetaCutoffs > 0);
+	QVERIFY(statistics.nBetaCutoffs < statistics.nNodes);
+	QVERIFY(statistics.nEvaluations > 0);
+	QVERIFY(statistics.nTranspositionTableHits > 0);
+	QVERIFY(statistics.nTranspositionTableHits <= statistics.nTranspositionTableProbes);
+
+	// Every node except the root node is probed first.
+
+	QCOMPARE(statistics.nTranspositionTableProbes, statistics.nNodes - 1 + statistics.nTranspositionTableHits);
+	QVERIFY(statistics.elapsedTime.count() >= 0);
+
+	std::string line = statistics.toString();
+
+	QVERIFY(line.find("depth=6 ") == 0);
+	QVERIFY(line.find(" nodes=" + std::to_string(statistics.nNodes) + " ") != std::string::npos);
+	QVERIFY(line.find(" nps=") != std::string::npos);
+	QVERIFY(line.find(" scratchBytes=" + std::to_string(statistics.scratchSize) + " ") != std::string::npos);
+
+	// At least one move buffer per ply, with room for the 6 columns.
+
+	QVERIFY(statistics.scratchSize >= 6 * 6 * sizeof(unsigned int));
+
+	// The counters of the helpers are added, the counters are reset by every computation.
+
+	ai.setNumberOfThreads(4);
+	ai.computeNextMove(game);
+
+	QCOMPARE(ai.getSearchStatistics().nNodes, ai.getNumberOfNodes());
+	QCOMPARE(ai.getSearchStatistics().depth, 6u);
+	QVERIFY(ai.getSearchStatistics().nEvaluations > 0);
+	QVERIFY(ai.getSearchStatistics().nTranspositionTableProbes > 0);
+
+	// The helpers have their own scratch memory, it is bounded by the arenas and the move buffers.
+
+	QVERIFY(ai.getSearchStatistics().scratchSize > statistics.scratchSize);
+	QVERIFY(ai.getSearchStatistics().scratchSize <=
+	        4 * (GameLogic::FourInALine::SearchArena::DEFAULT_CAPACITY + 6 * 6 * sizeof(unsigned int)));
+
+	ai.setNumberOfThreads(1);
+	ai.setSearchDepth(1);
+	ai.computeNextMove(game);
+
+	// One evaluation per column of the 6x7 board.
+
+	QCOMPARE(ai.getSearchStatistics().depth, 1u);
+	QCOMPARE(ai.getSearchStatistics().nEvaluations, 6ull);
+	QCOMPARE(ai.getSearchStatistics().nBetaCutoffs, 0ull);
+}
+
+/**
+ * Checks whether the move ordering reduces the number of visited nodes without changing the
+ * computed move.
+ */
+void ArtificialIntelligenceTest::moveOrdering()
+{
+	GameLogic::FourInALine::Game game(7, 6, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(7);
+	GameLogic::FourInALine::ArtificialIntelligence staticAi(7);
+	GameLogic::FourInALine::ArtificialIntelligence unorderedAi(7);
+
+	staticAi.getMoveOrdering()->setHashMoveFirst(false);
+	staticAi.getMoveOrdering()->setKillerMoves(false);
+	staticAi.getMoveOrdering()->setHistoryHeuristic(false);
+
+	auto unordered = std::make_shared<GameLogic::FourInALine::MoveOrdering>();
+	unordered->setCenterFirst(false);
+	unordered->setHashMoveFirst(false);
+	unordered->setKillerMoves(false);
+	unordered->setHistoryHeuristic(false);
+	unorderedAi.setMoveOrdering(unordered);
+
+	game.makeMove(3);
+	game.makeMove(3);
+	game.makeMove(2);
+
+	unsigned int move = ai.computeNextMove(game);
+
+	QCOMPARE(staticAi.computeNextMove(game), move);
+	QVERIFY(ai.getNumberOfNodes() > 0);
+	QVERIFY(ai.getNumberOfNodes() < staticAi.getNumberOfNodes());
+
+	unorderedAi.computeNextMove(game);
+	QVERIFY(staticAi.getNumberOfNodes() < unorderedAi.getNumberOfNodes());
+}
+
+/**
+ * Plays games in which both players make the moves computed with one and with several threads and
+ * checks whether the moves are always the same.
+ */
+void ArtificialIntelligenceTest::multipleThreads()
+{
+	GameLogic::FourInALine::Game game(7, 6, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(6);
+	GameLogic::FourInALine::ArtificialIntelligence parallelAi(6);
+	GameLogic::FourInALine::ArtificialIntelligence parallelIterativeAi(6);
+
+	QCOMPARE(ai.getNumberOfThreads(), 1u);
+
+	parallelAi.setNumberOfThreads(4);
+	QCOMPARE(parallelAi.getNumberOfThreads(), 4u);
+
+	parallelAi.setNumberOfThreads(0);
+	QVERIFY(parallelAi.getNumberOfThreads() >= 1);
+
+	parallelAi.setNumberOfThreads(4);
+	parallelIterativeAi.setNumberOfThreads(3);
+	parallelIterativeAi.setTimeBudget(std::chrono::milliseconds(60000));
+
+	while (!game.isOver())
+	{
+		unsigned int move = ai.computeNextMove(game);
+
+		QCOMPARE(parallelAi.computeNextMove(game), move);
+		QCOMPARE(parallelIterativeAi.computeNextMove(game), move);
+		QVERIFY(parallelAi.getNumberOfNodes() > 0);
+
+		game.makeMove(move);
+	}
+}
+
+/**
+ * Fills boards of different sizes with random moves and checks whether the scores computed from the
+ * window counts are always the same as the scores computed by scanning all windows.
+ */
+void ArtificialIntelligenceTest::incrementalEvaluation()
+{
+	EvaluatingArtificialIntelligence ai;
+	std::mt19937 generator(42);
+
+	for (unsigned int size = 4; size <= 10; ++size)
+	{
+		GameLogic::FourInALine::Board board(size, size - 1 + size % 3);
+
+		for (unsigned int i = 0; i < 200; ++i)
+		{
+			auto columns = board.getAvailableColumns();
+			unsigned int action = generator() % 10;
+
+			if (action == 0 && !board.isEmpty())
+			{
+				// Remove a random token, the tokens above it fall down.
+
+				unsigned int x = generator() % board.getNumberOfColumns();
+
+				while (board.isColumnEmpty(x))
+				{
+					x = (x + 1) % board.getNumberOfColumns();
+				}
+
+				board.removeToken(x, board.getNumberOfRows() - 1 - generator() % board.getColumnHeight(x));
+			}
+			else if (action < 3 && !board.isEmpty())
+			{
+				unsigned int x = generator() % board.getNumberOfColumns();
+
+				while (board.isColumnEmpty(x))
+				{
+					x = (x + 1) % board.getNumberOfColumns();
+				}
+
+				board.removeToken(x);
+			}
+			else if (!columns.empty())
+			{
+				board.dropToken(columns[generator() % columns.size()], 1 + generator() % 2);
+			}
+			else
+			{
+				board.clear();
+			}
+
+			QVERIFY(board.isWindowCountingUsed());
+
+			for (unsigned int player = 1; player <= 2; ++player)
+			{
+				QCOMPARE(ai.computePlayerScoreFromWindowCounts(board, player),
+				         ai.computePlayerScore(board, player));
+			}
+		}
+	}
+}
+
+/**
+ * Checks whether the search does not allocate memory per node, i.e. computing a move with a higher
+ * search depth does not allocate more memory once the buffers of the search were allocated.
+ */
+void ArtificialIntelligenceTest::allocations()
+{
+	GameLogic::FourInALine::Game game(7, 6, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(8);
+
+	game.makeMove(3);
+	game.makeMove(3);
+
+	// Warm-up, allocates the buffers for the highest search depth.
+
+	ai.computeNextMove(game);
+
+	ai.setSearchDepth(4);
+
+	unsigned long long nAllocationsBefore = nAllocations;
+	ai.computeNextMove(game);
+	unsigned long long nShallowAllocations = nAllocations - nAllocationsBefore;
+	unsigned long long nShallowNodes = ai.getNumberOfNodes();
+
+	ai.setSearchDepth(8);
+
+	nAllocationsBefore = nAllocations;
+	ai.computeNextMove(game);
+	unsigned long long nDeepAllocations = nAllocations - nAllocationsBefore;
+
+	QVERIFY(ai.getNumberOfNodes() > 10 * nShallowNodes);
+	QCOMPARE(nDeepAllocations, nShallowAllocations);
+
+	// The helpers keep their boards and buffers, so the search threads do not allocate memory per
+	// node either.
+
+	ai.setNumberOfThreads(2);
+	ai.computeNextMove(game);
+
+	ai.setSearchDepth(4);
+
+	nAllocationsBefore = nAllocations;
+	ai.computeNextMove(game);
+	nShallowAllocations = nAllocations - nAllocationsBefore;
+
+	ai.setSearchDepth(8);
+
+	nAllocationsBefore = nAllocations;
+	ai.computeNextMove(game);
+	nDeepAllocations = nAllocations - nAllocationsBefore;
+
+	QCOMPARE(nDeepAllocations, nShallowAllocations);
+}
+
+/**
+ * Checks whether the predicted moves of the opponent contain all possible moves, sorted statically
+ * when nothing was searched and with the move expected by the last computation first.
+ */
+void ArtificialIntelligenceTest::predictMoves()
+{
+	GameLogic::FourInALine::Game game(6, 7, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(4);
+
+	ai.setKeepTranspositionTable(true);
+
+	std::vector<unsigned int> expectedMoves = { 3, 2, 4, 1, 5, 0, 6 };
+	QVERIFY(ai.predictMoves(game) == expectedMoves);
+
+	game.makeMove(0);
+	game.makeMove(0);
+	game.makeMove(1);
+	game.makeMove(1);
+
+	// The artificial intelligence threatens to complete the bottom row, the opponent has exactly
+	// one move which prevents that.
+
+	game.makeMove(ai.computeNextMove(game));
+
+	std::vector<unsigned int> blockingMoves;
+
+	for (unsigned int reply = 0; reply < 7; ++reply)
+	{
+		GameLogic::FourInALine::Game replyGame(game);
+		bool isLost = false;
+
+		replyGame.makeMove(reply);
+
+		for (unsigned int move = 0; move < 7 && !isLost; ++move)
+		{
+			GameLogic::FourInALine::Game moveGame(replyGame);
+
+			moveGame.makeMove(move);
+			isLost = moveGame.isOver() && moveGame.getWinner() == 1;
+		}
+
+		if (!isLost)
+		{
+			blockingMoves.push_back(reply);
+		}
+	}
+
+	std::vector<unsigned int> predictedMoves = ai.predictMoves(game);
+
+	QCOMPARE(blockingMoves.size(), static_cast<std::size_t>(1));
+	QCOMPARE(predictedMoves.size(), static_cast<std::size_t>(7));
+	QCOMPARE(predictedMoves[0], blockingMoves[0]);
+
+	// There are no moves when the game is over.
+
+	game.makeMove(predictedMoves[1]);
+	game.makeMove(blockingMoves[0]);
+
+	QCOMPARE(game.isOver(), true);
+	QVERIFY(ai.predictMoves(game).empty());
+}
+
+/**
+ * Plays a game in which every move is computed with all moves scored (multi-PV) and checks the
+ * scores against the scores of separate searches after every move.
+ */
+void ArtificialIntelligenceTest::moveScores()
+{
+	using MoveScore = GameLogic::FourInALine::ArtificialIntelligence::MoveScore;
+	using Bound = GameLogic::FourInALine::TranspositionTable::Bound;
+
+	const int maxScore = std::numeric_limits<int>::max();
+	const int minScore = std::numeric_limits<int>::min();
+	GameLogic::FourInALine::Game game(6, 7, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(5);
+	GameLogic::FourInALine::ArtificialIntelligence scoringAi(5);
+	GameLogic::FourInALine::ArtificialIntelligence parallelScoringAi(5);
+	GameLogic::FourInALine::ArtificialIntelligence exactAi(5);
+	GameLogic::FourInALine::ArtificialIntelligence childAi(4);
+
+	QCOMPARE(scoringAi.isScoringAllMoves(), false);
+	QCOMPARE(scoringAi.getMoveScoreWindow(),
+	         GameLogic::FourInALine::ArtificialIntelligence::DEFAULT_MOVE_SCORE_WINDOW);
+
+	try
+	{
+		scoringAi.setMoveScoreWindow(-1);
+		QFAIL("A negative move score window should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	scoringAi.setScoreAllMoves(true);
+	QCOMPARE(scoringAi.isScoringAllMoves(), true);
+
+	parallelScoringAi.setScoreAllMoves(true);
+	parallelScoringAi.setNumberOfThreads(3);
+	parallelScoringAi.setMoveScoreWindow(0);
+	exactAi.setMoveScoreWindow(maxScore);
+
+	while (!game.isOver())
+	{
+		unsigned int move = ai.computeNextMove(game);
+
+		QVERIFY(ai.getMoveScores().empty());
+		QCOMPARE(scoringAi.computeNextMove(game), move);
+		QCOMPARE(parallelScoringAi.computeNextMove(game), move);
+
+		std::vector<MoveScore> scores = scoringAi.getMoveScores();
+		std::vector<MoveScore> exactScores = exactAi.computeMoveScores(game);
+
+		QCOMPARE(scores.size(), game.getBoard()->getAvailableColumns().size());
+		QCOMPARE(exactScores.size(), scores.size());
+		QCOMPARE(parallelScoringAi.getMoveScores().size(), scores.size());
+		QCOMPARE(scores.front().column, move);
+		QCOMPARE(exactScores.front().column, move);
+
+		for (const MoveScore& exactScore : exactScores)
+		{
+			QVERIFY(exactScore.bound == Bound::EXACT);
+			QVERIFY(exactScore.score <= exactScores.front().score);
+
+			// The score of a move is the negated score of the best move of the opponent.
+
+			GameLogic::FourInALine::Game childGame(game);
+			childGame.makeMove(exactScore.column);
+
+			int childScore = maxScore;
+
+			if (!childGame.isOver())
+			{
+				childScore = childAi.computeMoveScores(childGame).front().score;
+				childScore = (childScore == maxScore) ? minScore :
+				             ((childScore == minScore) ? maxScore : -childScore);
+			}
+			else if (childGame.isDraw())
+			{
+				childScore = exactScore.score;
+			}
+
+			QCOMPARE(exactScore.score, childScore);
+
+			// Exact scores of the other searches are the same, bounds are not lower.
+
+			for (const auto& otherScores : { scores, parallelScoringAi.getMoveScores() })
+			{
+				auto otherScore = std::find_if(otherScores.begin(), otherScores.end(),
+				                               [&exactScore](const MoveScore& score)
+				{
+					return score.column == exactScore.column;
+				});
+
+				QVERIFY(otherScore != otherScores.end());
+				QVERIFY(otherScore->bound == Bound::EXACT || otherScore->bound == Bound::UPPER);
+				QVERIFY(otherScore->bound != Bound::EXACT || otherScore->score == exactScore.score);
+				QVERIFY(otherScore->score >= exactScore.score);
+			}
+		}
+
+		game.makeMove(move);
+	}
+
+	// With perfect play, the scores are exact wins, draws and losses.
+
+	GameLogic::FourInALine::Game smallGame(4, 5, 1);
+
+	scoringAi.setPerfectPlay(true);
+
+	std::vector<int> solvedScores = scoringAi.computeExactMoveScores(smallGame);
+	unsigned int move = scoringAi.computeNextMove(smallGame);
+
+	QCOMPARE(scoringAi.getMoveScores().size(), static_cast<std::size_t>(5));
+	QCOMPARE(scoringAi.getMoveScores().front().column, move);
+
+	for (const MoveScore& moveScore : scoringAi.getMoveScores())
+	{
+		int solvedScore = solvedScores[moveScore.column];
+
+		QVERIFY(moveScore.bound == Bound::EXACT);
+		QCOMPARE(moveScore.score, (solvedScore > 0) ? maxScore : ((solvedScore < 0) ? minScore : 0));
+	}
+}
+
+/**
+ * Checks whether the iteration callback is called after every completed search depth with the move
+ * scores and a principal variation of valid moves.
+ */
+void ArtificialIntelligenceTest::iterationCallback()
+{
+	using IterationResult = GameLogic::FourInALine::ArtificialIntelligence::IterationResult;
+
+	GameLogic::FourInALine::Game game(6, 7, 1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(7);
+	GameLogic::FourInALine::ArtificialIntelligence analysingAi(7);
+	std::vector<IterationResult> results;
+
+	analysingAi.setScoreAllMoves(true);
+	analysingAi.setIterationCallback([&results](const IterationResult& result)
+	{
+		results.push_back(result);
+	});
+
+	game.makeMove(3);
+	game.makeMove(3);
+	game.makeMove(2);
+
+	// Without a time budget the search is deepened up to the search depth, the result is the same.
+
+	unsigned int move = analysingAi.computeNextMove(game);
+
+	QCOMPARE(move, ai.computeNextMove(game));
+	QCOMPARE(analysingAi.getCompletedSearchDepth(), 7u);
+	QCOMPARE(results.size(), static_cast<std::size_t>(7));
+
+	for (std::size_t i = 0; i < results.size(); ++i)
+	{
+		const IterationResult& result = results[i];
+		GameLogic::FourInALine::Game variationGame(game);
+
+		QCOMPARE(result.depth, static_cast<unsigned int>(i + 1));
+		QCOMPARE(result.moveScores.size(), static_cast<std::size_t>(7));
+		QVERIFY(!result.principalVariation.empty());
+		QVERIFY(result.principalVariation.size() <= result.depth);
+		QCOMPARE(result.principalVariation.front(), result.moveScores.front().column);
+
+		for (unsigned int variationMove : result.principalVariation)
+		{
+			QVERIFY(!variationGame.isOver());
+			QVERIFY(variationGame.isMovePossible(variationMove));
+
+			variationGame.makeMove(variationMove);
+		}
+	}
+
+	QCOMPARE(results.back().principalVariation.front(), move);
+	QVERIFY(results.back().principalVariation.size() > 1);
+
+	// Without a callback there is no iterative deepening.
+
+	results.clear();
+	analysingAi.setIterationCallback(GameLogic::FourInALine::ArtificialIntelligence::IterationCallbackType());
+
+	QCOMPARE(analysingAi.computeNextMove(game), move);
+	QVERIFY(results.empty());
+}
+
+/**
+ * Checks the scores computed by the solver against an exhaustive search on small boards and
+ * against known results.
+ */
+void ArtificialIntelligenceTest::solver()
+{
+	using Solver = GameLogic::FourInALine::Solver;
+
+	Solver solver;
+	std::mt19937 generator(16);
+
+	QCOMPARE(Solver::isSupported(7, 6), true);
+	QCOMPARE(Solver::isSupported(8, 7), true);
+	QCOMPARE(Solver::isSupported(9, 7), false);
+
+	// Random positions of a 5x4 board, every move is checked.
+
+	for (unsigned int i = 0; i < 20; ++i)
+	{
+		GameLogic::FourInALine::Game game(4, 5, 1);
+
+		for (unsigned int nMoves = 0; nMoves < 6 && !game.isOver(); ++nMoves)
+		{
+			std::vector<unsigned int> columns = game.getBoard()->getAvailableColumns();
+			game.makeMove(columns[generator() % columns.size()]);
+		}
+
+		if (game.isOver())
+		{
+			continue;
+		}
+
+		std::map<std::uint64_t, int> scores;
+		std::vector<int> moveScores = solver.scoreMoves(*game.getBoard(), game.getCurrentPlayer());
+		int score = solver.solve(*game.getBoard(), game.getCurrentPlayer());
+
+		QCOMPARE(score, computeReferenceScore(game, scores));
+		QCOMPARE(*std::max_element(moveScores.begin(), moveScores.end()), score);
+		QCOMPARE(moveScores[solver.findBestMove(*game.getBoard(), game.getCurrentPlayer())], score);
+
+		for (unsigned int x = 0; x < 5; ++x)
+		{
+			GameLogic::FourInALine::Game nextGame(game);
+
+			if (!game.isMovePossible(x))
+			{
+				QCOMPARE(moveScores[x], Solver::INVALID_SCORE);
+				continue;
+			}
+
+			nextGame.makeMove(x);
+
+			if (!nextGame.isOver())
+			{
+				QCOMPARE(moveScores[x], -computeReferenceScore(nextGame, scores));
+			}
+		}
+	}
+
+	// The empty 4x4 board is a draw.
+
+	GameLogic::FourInALine::Game smallGame(4, 4, 1);
+	int smallScore = solver.solve(*smallGame.getBoard(), 1);
+
+	QCOMPARE(smallScore, 0);
+	QVERIFY(Solver::getOutcome(smallScore) == Solver::Outcome::DRAW);
+	QCOMPARE(Solver::getNumberOfPliesToEnd(*smallGame.getBoard(), smallScore), 16u);
+
+	// 7x6 positions, the first one is lost in 4 moves and the second one won in 7 moves.
+
+	const char* sequences[] = { "2252576253462244111563365343671351441",
+	                            "7422341735647741166133573473242566" };
+	const int expectedScores[] = { -1, 1 };
+	const unsigned int expectedPlies[] = { 4, 7 };
+
+	for (unsigned int i = 0; i < 2; ++i)
+	{
+		GameLogic::FourInALine::Game game(6, 7, 1);
+
+		for (const char* move = sequences[i]; *move != '\0'; ++move)
+		{
+			game.makeMove(*move - '1');
+		}
+
+		int score = solver.solve(*game.getBoard(), game.getCurrentPlayer());
+
+		QCOMPARE(score, expectedScores[i]);
+		QCOMPARE(Solver::getNumberOfPliesToEnd(*game.getBoard(), score), expectedPlies[i]);
+	}
+
+	// A finished game cannot be solved.
+
+	GameLogic::FourInALine::Game wonGame(6, 7, 1);
+
+	for (unsigned int move : { 0, 1, 0, 1, 0, 1, 0 })
+	{
+		wonGame.makeMove(move);
+	}
+
+	try
+	{
+		solver.solve(*wonGame.getBoard(), wonGame.getCurrentPlayer());
+		QFAIL("Solved a finished game.");
+	}
+	catch (std::exception&)
+	{
+	}
+}
+
+/**
+ * Checks whether the artificial intelligence with perfect play never loses a game which can be
+ * drawn, and falls back to the search when the solver runs out of time.
+ */
+void ArtificialIntelligenceTest::perfectPlay()
+{
+	GameLogic::FourInALine::ArtificialIntelligence perfectAi(4);
+	GameLogic::FourInALine::ArtificialIntelligence ai(4);
+
+	perfectAi.setPerfectPlay(true);
+	QCOMPARE(perfectAi.isPerfectPlay(), true);
+
+	// The empty 5x4 board is a draw, so the perfect artificial intelligence never loses.
+
+	for (unsigned int firstPlayer = 1; firstPlayer <= 2; ++firstPlayer)
+	{
+		GameLogic::FourInALine::Game game(4, 5, firstPlayer);
+
+		QCOMPARE(perfectAi.computeExactScore(game), 0);
+
+		while (!game.isOver())
+		{
+			if (game.getCurrentPlayer() == 1)
+			{
+				std::vector<int> scores = perfectAi.computeExactMoveScores(game);
+				unsigned int move = perfectAi.computeNextMove(game);
+
+				QCOMPARE(scores[move], *std::max_element(scores.begin(), scores.end()));
+				QCOMPARE(perfectAi.getCompletedSearchDepth(),
+				         20 - game.getNumberOfMoves());
+
+				game.makeMove(move);
+			}
+			else
+			{
+				game.makeMove(ai.computeNextMove(game));
+			}
+		}
+
+		QVERIFY(game.isDraw() || game.getWinner() == 1);
+	}
+
+	// Solving the empty 7x6 board takes much longer than the time budget.
+
+	GameLogic::FourInALine::Game bigGame(6, 7, 1);
+
+	perfectAi.setTimeBudget(std::chrono::milliseconds(200));
+
+	auto startTime = std::chrono::steady_clock::now();
+	unsigned int move = perfectAi.computeNextMove(bigGame);
+	auto duration = std::chrono::steady_clock::now() - startTime;
+
+	QVERIFY(bigGame.isMovePossible(move));
+	QVERIFY(perfectAi.getCompletedSearchDepth() <= 4u);
+	QVERIFY(duration < std::chrono::milliseconds(1000));
+}
+
 /**
  * Creates a big board and benchmarks how long it takes the AI to find a next move.
  */
@@ -82,4 +996,27 @@ void ArtificialIntelligenceTest::benchmark()
 	}
 }
 
+/**
+ * Benchmarks how long it takes the solver to solve the empty 6x5 board and a 7x6 board after 8
+ * moves.
+ */
+void ArtificialIntelligenceTest::solverBenchmark()
+{
+	GameLogic::FourInALine::Game smallGame(5, 6, 1);
+	GameLogic::FourInALine::Game game(6, 7, 1);
+
+	for (unsigned int move : { 3, 3, 3, 2, 2, 2, 4, 4 })
+	{
+		game.makeMove(move);
+	}
+
+	QBENCHMARK
+	{
+		GameLogic::FourInALine::Solver solver;
+
+		QCOMPARE(solver.solve(*smallGame.getBoard(), smallGame.getCurrentPlayer()), 0);
+		QCOMPARE(solver.solve(*game.getBoard(), game.getCurrentPlayer()), 3);
+	}
+}
+
 QTEST_MAIN(ArtificialIntelligenceTest)
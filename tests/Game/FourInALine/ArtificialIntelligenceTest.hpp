@@ -14,7 +14,21 @@ class ArtificialIntelligenceTest : public QObject
 			void obviousWin();
 			void preventOpponentWin();
 			void basicTest();
+			void transpositionTable();
+			void timeBudget();
+			void nodeBudget();
+			void searchStatistics();
+			void moveOrdering();
+			void multipleThreads();
+			void incrementalEvaluation();
+			void allocations();
+			void predictMoves();
+			void moveScores();
+			void iterationCallback();
+			void solver();
+			void perfectPlay();
 			void benchmark();
+			void solverBenchmark();
 };
 
 #endif // TESTS_GAME_FOUR_IN_A_LINE_ARTIFICIALINTELLIGENCETEST_HPP
@@ -2,8 +2,19 @@
 #include "../../../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
 #include "../../../src/GameLogic/FourInALine/AAI.hpp"
 #include "../../../src/GameLogic/FourInALine/Game.hpp"
+#include "../../../src/GameLogic/FourInALine/Tablebase.hpp"
+#include "../../../src/GameLogic/FourInALine/TablebaseGenerator.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <QFile>
 #include <QThread>
 
 /**
@@ -106,6 +117,340 @@ void AsynchronousArtificialIntelligenceTest::testCancel()
 	QCOMPARE(ai.isNextMoveValid(), false);
 	QCOMPARE(ai.isComputing(), false);
 	QCOMPARE(ai.getNextMove(), GameLogic::FourInALine::AsynchronousArtificialIntelligence::INVALID_RESULT);
+
+	// Cancelling also stops the searches in the other threads.
+
+	ai.setNumberOfThreads(4);
+	ai.computeNextMoveAsynchronously(game);
+
+	QCOMPARE(ai.isComputing(), true);
+
+	ai.cancelComputation();
+
+	QThread::msleep(1000);
+
+	QCOMPARE(ai.isNextMoveReady(), false);
+	QCOMPARE(ai.isComputing(), false);
+	QCOMPARE(ai.getNextMove(), GameLogic::FourInALine::AsynchronousArtificialIntelligence::INVALID_RESULT);
+}
+
+/**
+ * Checks that a job cancelled while it waits in the queue of the worker does not store a result,
+ * even when the move is taken from the tablebase without searching.
+ */
+void AsynchronousArtificialIntelligenceTest::cancelQueuedJob()
+{
+	QString fileName("AsynchronousArtificialIntelligenceTest.tablebase");
+	GameLogic::FourInALine::TablebaseGenerator generator(4, 4);
+
+	generator.generate(fileName);
+
+	auto tablebase = std::make_shared<GameLogic::FourInALine::Tablebase>();
+	tablebase->load(fileName);
+
+	auto worker = std::make_shared<GameLogic::FourInALine::SearchWorker>();
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence ai(1, worker);
+	GameLogic::FourInALine::Game game(4, 4, 1);
+	std::promise<void> release;
+	std::shared_future<void> released(release.get_future());
+	std::atomic<unsigned int> nFinished(0);
+
+	ai.setTablebase(tablebase);
+	ai.setFinishedCallback([&nFinished]()
+	{
+		nFinished++;
+	});
+
+	// Block the worker, so the job of the artificial intelligence waits in the queue.
+
+	worker->addJob([released]()
+	{
+		released.wait();
+	});
+
+	ai.computeNextMoveAsynchronously(game);
+	ai.cancelComputation();
+	release.set_value();
+
+	for (unsigned int i = 0; i < 1000 && ai.isComputing(); ++i)
+	{
+		QThread::msleep(10);
+	}
+
+	QCOMPARE(ai.isComputing(), false);
+	QCOMPARE(nFinished.load(), 1u);
+	QCOMPARE(ai.isNextMoveReady(), false);
+	QCOMPARE(ai.getNextMove(), GameLogic::FourInALine::AsynchronousArtificialIntelligence::INVALID_RESULT);
+
+	// A job which was not cancelled takes the move from the tablebase.
+
+	ai.computeNextMoveAsynchronously(game);
+
+	QVERIFY(ai.getNextMove(std::chrono::milliseconds(10000)) < 4u);
+	QCOMPARE(ai.getNumberOfNodes(), 0ull);
+
+	QFile::remove(fileName);
+}
+
+/**
+ * Stops computations with a time budget, a node budget and an iteration callback and checks whether
+ * the result of the completed search is kept.
+ */
+void AsynchronousArtificialIntelligenceTest::testStop()
+{
+	unsigned int columns = 9;
+	unsigned int rows = 9;
+	GameLogic::FourInALine::Game game(columns, rows, 1);
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence ai(40);
+
+	ai.setTimeBudget(std::chrono::milliseconds(60000));
+	ai.computeNextMoveAsynchronously(game);
+
+	QThread::msleep(200);
+
+	QCOMPARE(ai.isComputing(), true);
+
+	ai.stopComputation();
+
+	QVERIFY(ai.getNextMove(std::chrono::milliseconds(5000)) < columns);
+	QCOMPARE(ai.isComputing(), false);
+	QCOMPARE(ai.isNextMoveReady(), true);
+	QVERIFY(ai.getCompletedSearchDepth() >= 1);
+
+	// Stopping a search with a node budget does not lose the result either.
+
+	ai.setTimeBudget(std::chrono::milliseconds(0));
+	ai.setNodeBudget(1000000000000ull);
+	ai.computeNextMoveAsynchronously(game);
+
+	QThread::msleep(200);
+
+	QCOMPARE(ai.isComputing(), true);
+
+	ai.stopComputation();
+
+	QVERIFY(ai.getNextMove(std::chrono::milliseconds(5000)) < columns);
+	QCOMPARE(ai.isNextMoveReady(), true);
+	QVERIFY(ai.getCompletedSearchDepth() >= 1);
+
+	// Neither does stopping a search which reports its iterations, e.g. an analysis.
+
+	unsigned int nIterations = 0;
+
+	ai.setNodeBudget(0);
+	ai.setIterationCallback([&nIterations](const GameLogic::FourInALine::ArtificialIntelligence::IterationResult&)
+	{
+		nIterations++;
+	});
+	ai.computeNextMoveAsynchronously(game);
+
+	QThread::msleep(200);
+
+	QCOMPARE(ai.isComputing(), true);
+
+	ai.stopComputation();
+
+	QVERIFY(ai.getNextMove(std::chrono::milliseconds(5000)) < columns);
+	QCOMPARE(ai.isNextMoveReady(), true);
+	QCOMPARE(ai.getCompletedSearchDepth(), nIterations);
+}
+
+/**
+ * Lets two artificial intelligences share a worker and checks whether both compute the right moves,
+ * also when a computation is restarted right after it was cancelled.
+ */
+void AsynchronousArtificialIntelligenceTest::sharedWorker()
+{
+	auto worker = std::make_shared<GameLogic::FourInALine::SearchWorker>();
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence ai(5, worker);
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence otherAi(5, ai.getWorker());
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence defaultAi(5);
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence otherDefaultAi(5);
+
+	QVERIFY(ai.getWorker() == worker);
+	QVERIFY(otherAi.getWorker() == worker);
+	QVERIFY(defaultAi.getWorker() == otherDefaultAi.getWorker());
+
+	GameLogic::FourInALine::Game game(4, 4, 1);
+
+	game.makeMove(0);
+	game.makeMove(0);
+
+	game.makeMove(1);
+	game.makeMove(1);
+
+	game.makeMove(2);
+	game.makeMove(2);
+
+	ai.computeNextMoveAsynchronously(game);
+	otherAi.computeNextMoveAsynchronously(game);
+
+	QCOMPARE(otherAi.getNextMove(std::chrono::milliseconds(10000)), 3u);
+	QCOMPARE(ai.getNextMove(std::chrono::milliseconds(10000)), 3u);
+
+	// The cancelled computation does not affect the new one.
+
+	GameLogic::FourInALine::Game bigGame(9, 9, 1);
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence deepAi(12, worker);
+
+	deepAi.computeNextMoveAsynchronously(bigGame);
+	deepAi.cancelComputation();
+	deepAi.computeNextMoveAsynchronously(game);
+
+	QCOMPARE(deepAi.getNextMove(std::chrono::milliseconds(10000)), 3u);
+	QCOMPARE(deepAi.isComputing(), false);
+
+	// Destroying an artificial intelligence whose job waits behind a long computation of another
+	// one does not wait for that computation.
+
+	deepAi.setTimeBudget(std::chrono::milliseconds(60000));
+	deepAi.computeNextMoveAsynchronously(bigGame);
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	{
+		GameLogic::FourInALine::AsynchronousArtificialIntelligence waitingAi(5, worker);
+		waitingAi.computeNextMoveAsynchronously(game);
+	}
+
+	QVERIFY(std::chrono::steady_clock::now() - startTime < std::chrono::seconds(10));
+	QCOMPARE(deepAi.isComputing(), true);
+
+	deepAi.cancelComputation();
+}
+
+/**
+ * Checks whether the finished callback is called when the computation has finished, so that the
+ * result can be retrieved without polling.
+ */
+void AsynchronousArtificialIntelligenceTest::finishedCallback()
+{
+	GameLogic::FourInALine::Game game(4, 4, 1);
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence ai(5);
+	std::promise<void> finished;
+
+	ai.setFinishedCallback([&finished]() { finished.set_value(); });
+
+	game.makeMove(0);
+	game.makeMove(0);
+
+	game.makeMove(1);
+	game.makeMove(1);
+
+	game.makeMove(2);
+	game.makeMove(2);
+
+	ai.computeNextMoveAsynchronously(game);
+
+	QVERIFY(finished.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+	QCOMPARE(ai.isComputing(), false);
+	QCOMPARE(ai.getNextMove(), 3u);
+}
+
+/**
+ * Analyses positions with an unlimited search depth, restarts the analysis after every move and
+ * checks that no results of cancelled analyses are reported and that a restart is fast.
+ */
+void AsynchronousArtificialIntelligenceTest::analysis()
+{
+	using IterationResult = GameLogic::FourInALine::ArtificialIntelligence::IterationResult;
+
+	GameLogic::FourInALine::Game game(6, 7, 1);
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool isAnalysing = false;
+	unsigned int nStaleResults = 0;
+	unsigned int nBoundScores = 0;
+	unsigned int deepestDepth = 0;
+	std::chrono::steady_clock::time_point firstResultTime;
+
+	// Destroyed before the variables used by the callback.
+
+	GameLogic::FourInALine::AsynchronousArtificialIntelligence ai(42, std::make_shared<GameLogic::FourInALine::SearchWorker>());
+
+	// Like the analysis of the game controller, all moves are searched with a full window, so every
+	// score is exact.
+
+	ai.setScoreAllMoves(true);
+	ai.setKeepTranspositionTable(true);
+	ai.setMoveScoreWindow(std::numeric_limits<GameLogic::FourInALine::ArtificialIntelligence::ScoreType>::max());
+	ai.setIterationCallback([&](const IterationResult& result)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		for (const auto& moveScore : result.moveScores)
+		{
+			if (moveScore.bound != GameLogic::FourInALine::TranspositionTable::Bound::EXACT)
+			{
+				nBoundScores++;
+			}
+		}
+
+		// The depths of one analysis are reported in order, a result of a cancelled analysis would
+		// break the order.
+
+		if (!isAnalysing || result.depth != deepestDepth + 1)
+		{
+			nStaleResults++;
+		}
+
+		if (result.depth == 1)
+		{
+			firstResultTime = std::chrono::steady_clock::now();
+		}
+
+		deepestDepth = result.depth;
+		condition.notify_all();
+	});
+
+	std::chrono::steady_clock::duration slowestRestart(0);
+
+	for (unsigned int move : { 3u, 3u, 2u, 4u, 2u, 2u })
+	{
+		ai.cancelComputation();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			isAnalysing = false;
+		}
+
+		// No results of the cancelled analysis are reported anymore.
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			isAnalysing = true;
+			deepestDepth = 0;
+		}
+
+		auto startTime = std::chrono::steady_clock::now();
+		ai.computeNextMoveAsynchronously(game);
+
+		// Waits until the analysis of the new position has completed some search depths.
+
+		std::unique_lock<std::mutex> lock(mutex);
+
+		QVERIFY(condition.wait_for(lock, std::chrono::seconds(10), [&deepestDepth]() { return deepestDepth >= 6; }));
+
+		slowestRestart = std::max(slowestRestart, firstResultTime - startTime);
+		lock.unlock();
+
+		QCOMPARE(ai.isComputing(), true);
+
+		game.makeMove(move);
+	}
+
+	ai.cancelComputation();
+
+	QCOMPARE(nStaleResults, 0u);
+	QCOMPARE(nBoundScores, 0u);
+
+	// Usually well below a millisecond, the limit leaves room for slow machines.
+
+	QVERIFY(slowestRestart < std::chrono::milliseconds(50));
 }
 
 QTEST_MAIN(AsynchronousArtificialIntelligenceTest)
@@ -18,6 +18,11 @@ class AsynchronousArtificialIntelligenceTest : public QObject
 		void preventOpponentWin();
 		void basicTest();
 		void testCancel();
+		void cancelQueuedJob();
+		void testStop();
+		void sharedWorker();
+		void finishedCallback();
+		void analysis();
 };
 
 #endif // TESTS_GAME_FOUR_IN_A_LINE_ARTIFICIALINTELLIGENCETEST_HPP
@@ -0,0 +1,234 @@
+#include "BitBoardTest.hpp"
+#include "../../../src/GameLogic/FourInALine/BitBoard.hpp"
+#include "../../../src/GameLogic/FourInALine/Board.hpp"
+#include "../../../src/GameLogic/CellSet.hpp"
+
+#include <QDebug>
+#include <random>
+
+/**
+ * Checks whether all board sizes selectable in the user interface fit into a bit board and that
+ * boards which are too big are rejected.
+ */
+void BitBoardTest::supportedSizes()
+{
+	QVERIFY(GameLogic::FourInALine::BitBoard::isSupported(7, 6) == true);
+	QVERIFY(GameLogic::FourInALine::BitBoard::isSupported(8, 7) == true);
+	QVERIFY(GameLogic::FourInALine::BitBoard::isSupported(0, 6) == false);
+	QVERIFY(GameLogic::FourInALine::BitBoard::isSupported(7, 0) == false);
+	QVERIFY(GameLogic::FourInALine::BitBoard::isSupported(20, 20) == false);
+
+	if (GameLogic::FourInALine::BitBoard::MAXIMUM_NUMBER_OF_BITS >= 128)
+	{
+		QVERIFY(GameLogic::FourInALine::BitBoard::isSupported(9, 9) == true);
+	}
+
+	try
+	{
+		GameLogic::FourInALine::BitBoard invalidBoard(20, 20);
+		QFAIL("Attempting to create a bit board which is too big should throw an exception.");
+	}
+	catch(std::exception)
+	{
+
+	}
+}
+
+/**
+ * Fills the bit board column by column and empties it again.
+ */
+void BitBoardTest::fillAndEmpty()
+{
+	unsigned int rows = 6u;
+	unsigned int columns = 7u;
+	GameLogic::FourInALine::BitBoard testBoard(columns, rows);
+
+	QVERIFY(testBoard.isEmpty() == true);
+
+	for (unsigned int i = 0; i < columns; ++i)
+	{
+		QVERIFY(testBoard.isColumnEmpty(i) == true);
+
+		for (unsigned int j = 0; j < rows; ++j)
+		{
+			QVERIFY(testBoard.canDropToken(i) == true);
+			QCOMPARE(testBoard.dropToken(i, j % 2), rows - j - 1);
+			QCOMPARE(testBoard.getColumnHeight(i), j + 1);
+		}
+
+		QVERIFY(testBoard.canDropToken(i) == false);
+		QVERIFY(testBoard.isColumnFull(i) == true);
+	}
+
+	QVERIFY(testBoard.isFull() == true);
+
+	try
+	{
+		testBoard.dropToken(0, 0);
+		QFAIL("Attempting to drop a token in a full column should throw an exception.");
+	}
+	catch(std::exception) {}
+
+	for (unsigned int i = 0; i < columns; ++i)
+	{
+		for (unsigned int j = 0; j < rows; ++j)
+		{
+			QCOMPARE(testBoard.removeToken(i), j);
+		}
+
+		QVERIFY(testBoard.isColumnEmpty(i) == true);
+	}
+
+	QVERIFY(testBoard.isEmpty() == true);
+
+	try
+	{
+		testBoard.removeToken(0);
+		QFAIL("Attempting to remove a token from an empty column should throw an exception.");
+	}
+	catch(std::exception) {}
+}
+
+/**
+ * Creates four in a row in all orientations and checks whether they are found.
+ */
+void BitBoardTest::findWinningCells()
+{
+	unsigned int rows = 6u;
+	unsigned int columns = 7u;
+	unsigned int startX;
+	unsigned int startY;
+	int deltaX;
+	int deltaY;
+
+	// Horizontal.
+
+	GameLogic::FourInALine::BitBoard horizontal(columns, rows);
+
+	for (unsigned int i = 3; i < 7; ++i)
+	{
+		QVERIFY(horizontal.hasWon(0) == false);
+		horizontal.dropToken(i, 0);
+	}
+
+	QVERIFY(horizontal.hasWon(0) == true);
+	QVERIFY(horizontal.hasWon(1) == false);
+	QVERIFY(horizontal.findWinningCells(0, startX, startY, deltaX, deltaY) == true);
+	QCOMPARE(startX, 3u);
+	QCOMPARE(startY, 5u);
+	QCOMPARE(deltaX, 1);
+	QCOMPARE(deltaY, 0);
+
+	// Vertical, the tokens must not wrap around into the next column.
+
+	GameLogic::FourInALine::BitBoard vertical(columns, rows);
+
+	vertical.dropToken(0, 1);
+	vertical.dropToken(0, 1);
+	vertical.dropToken(0, 1);
+	vertical.dropToken(1, 1);
+
+	QVERIFY(vertical.hasWon(1) == false);
+
+	vertical.dropToken(0, 1);
+
+	QVERIFY(vertical.findWinningCells(1, startX, startY, deltaX, deltaY) == true);
+	QCOMPARE(startX, 0u);
+	QCOMPARE(startY, 2u);
+	QCOMPARE(deltaX, 0);
+	QCOMPARE(deltaY, 1);
+
+	// Minor diagonal (bottom left to top right).
+
+	GameLogic::FourInALine::BitBoard minor(columns, rows);
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		for (unsigned int j = 0; j < i; ++j)
+		{
+			minor.dropToken(i, 1);
+		}
+
+		minor.dropToken(i, 0);
+	}
+
+	QVERIFY(minor.findWinningCells(0, startX, startY, deltaX, deltaY) == true);
+	QCOMPARE(startX, 3u);
+	QCOMPARE(startY, 2u);
+	QCOMPARE(deltaX, -1);
+	QCOMPARE(deltaY, 1);
+
+	// Major diagonal (top left to bottom right).
+
+	GameLogic::FourInALine::BitBoard major(columns, rows);
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		for (unsigned int j = 0; j < 3 - i; ++j)
+		{
+			major.dropToken(i, 1);
+		}
+
+		major.dropToken(i, 0);
+	}
+
+	QVERIFY(major.findWinningCells(0, startX, startY, deltaX, deltaY) == true);
+	QCOMPARE(startX, 0u);
+	QCOMPARE(startY, 2u);
+	QCOMPARE(deltaX, 1);
+	QCOMPARE(deltaY, 1);
+}
+
+/**
+ * Plays random games on a bit board and a board and checks whether both find the same winner.
+ */
+void BitBoardTest::compareWithBoard()
+{
+	unsigned int rows = 6u;
+	unsigned int columns = 7u;
+	std::mt19937 randomNumberGenerator(42);
+	unsigned int startX;
+	unsigned int startY;
+	int deltaX;
+	int deltaY;
+
+	for (unsigned int game = 0; game < 200; ++game)
+	{
+		GameLogic::FourInALine::Board board(columns, rows);
+		GameLogic::FourInALine::BitBoard bitBoard(columns, rows);
+		unsigned int player = 0;
+
+		while (!board.isFull() && board.findWinningCells().isEmpty())
+		{
+			auto columnsAvailable = board.getAvailableColumns();
+			std::uniform_int_distribution<unsigned int> distribution(0, columnsAvailable.size() - 1);
+			unsigned int column = columnsAvailable.at(distribution(randomNumberGenerator));
+
+			board.dropToken(column, player + 1);
+			bitBoard.dropToken(column, player);
+
+			QCOMPARE(bitBoard.findWinningCells(player, startX, startY, deltaX, deltaY),
+			         !board.findWinningCells().isEmpty());
+			QCOMPARE(bitBoard.isFull(), board.isFull());
+
+			player = 1 - player;
+		}
+
+		if (!board.findWinningCells().isEmpty())
+		{
+			// The bit board finds a line of the winner, all of its cells contain the winning token.
+
+			auto winningCells = board.findWinningCells();
+			::GameLogic::Board::TokenType token = winningCells.getContent(0);
+
+			QVERIFY(bitBoard.findWinningCells(token - 1, startX, startY, deltaX, deltaY));
+
+			for (int i = 0; i < 4; ++i)
+			{
+				QCOMPARE(board.getCell(startX + i * deltaX, startY + i * deltaY), token);
+			}
+		}
+	}
+}
+
+QTEST_MAIN(BitBoardTest)
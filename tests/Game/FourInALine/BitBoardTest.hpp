@@ -0,0 +1,20 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_BITBOARDTEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_BITBOARDTEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::BitBoard class.
+ */
+class BitBoardTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void supportedSizes();
+		void fillAndEmpty();
+		void findWinningCells();
+		void compareWithBoard();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_BITBOARDTEST_HPP
@@ -5,6 +5,7 @@
 
 #include <QDebug>
 #include <memory>
+#include <random>
 
 /**
  * Creates a game board and copies it, checks whether everything is initialized correctly and the
@@ -54,6 +55,55 @@ void BoardTest::createAndCopy()
 
 }
 
+/**
+ * Assigns a board to a board of another size and checks whether the assigned board is an
+ * independent copy, including its move stack, hash keys and window counts.
+ */
+void BoardTest::assign()
+{
+	GameLogic::FourInALine::Board board(7, 6);
+	GameLogic::FourInALine::Board assigned(4, 5);
+
+	assigned.makeMove(1, 2u);
+
+	for (unsigned int column : { 3, 3, 2, 4, 1 })
+	{
+		board.makeMove(column, 1u + board.getColumnHeight(column) % 2);
+	}
+
+	assigned = board;
+
+	QCOMPARE(assigned.getNumberOfColumns(), 7u);
+	QCOMPARE(assigned.getNumberOfRows(), 6u);
+	QCOMPARE(assigned.getHashKey(), board.getHashKey());
+	QCOMPARE(assigned.getMirroredHashKey(), board.getMirroredHashKey());
+	QCOMPARE(assigned.getNumberOfOpenWindows(1u, 2), board.getNumberOfOpenWindows(1u, 2));
+
+	for (unsigned int x = 0; x < 7; ++x)
+	{
+		QCOMPARE(assigned.getColumnHeight(x), board.getColumnHeight(x));
+
+		for (unsigned int y = 0; y < 6; ++y)
+		{
+			QCOMPARE(assigned.getCell(x, y), board.getCell(x, y));
+		}
+	}
+
+	// The moves of the board can be unmade on the assigned board, the board is not changed.
+
+	assigned.unmakeMove();
+
+	QCOMPARE(assigned.getColumnHeight(1), 0u);
+	QCOMPARE(board.getColumnHeight(1), 1u);
+
+	// Assigning the board again restores the position.
+
+	assigned = board;
+
+	QCOMPARE(assigned.getHashKey(), board.getHashKey());
+	QCOMPARE(assigned.findWinningCells().isEmpty(), board.findWinningCells().isEmpty());
+}
+
 /**
  * Fills the board by dropping tokens and then empties it again with removeToken().
  */
@@ -316,6 +366,400 @@ void BoardTest::getAvailableColumns()
 	QVERIFY(availableColumns.size() == 2);
 	QVERIFY(availableColumns[0] == 1 || availableColumns[0] == 3);
 	QVERIFY(availableColumns[1] == 1 || availableColumns[1] == 3);
+
+	// The range must contain the same columns and reflect changes of the board.
+
+	GameLogic::FourInALine::AvailableColumns range = testBoard.getAvailableColumnsRange();
+	std::vector<unsigned int> rangeColumns(range.begin(), range.end());
+
+	QVERIFY(rangeColumns == availableColumns);
+	QCOMPARE(range.getNumberOfColumns(), 2u);
+	QCOMPARE(testBoard.getColumnHeight(0), 1u);
+	QCOMPARE(testBoard.getColumnHeight(1), 0u);
+
+	testBoard.dropToken(1, 1u);
+	testBoard.dropToken(3, 2u);
+
+	QCOMPARE(range.getNumberOfColumns(), 0u);
+	QVERIFY(range.isEmpty() == true);
+	QVERIFY(testBoard.isFull() == true);
+
+	testBoard.removeToken(0);
+
+	QCOMPARE(*range.begin(), 0u);
+	QCOMPARE(testBoard.getColumnHeight(0), 0u);
+}
+
+/**
+ * Makes moves with makeMove() and undoes them with unmakeMove(), checks whether the board is
+ * restored correctly.
+ */
+void BoardTest::makeAndUnmakeMove()
+{
+	unsigned int rows = 4u;
+	unsigned int columns = 4u;
+	GameLogic::FourInALine::Board testBoard(columns, rows);
+
+	try
+	{
+		testBoard.unmakeMove();
+		QFAIL("Attempting to unmake a move when no move was made should throw an exception.");
+	}
+	catch(std::exception) {}
+
+	testBoard.makeMove(0, 1u);
+	testBoard.makeMove(1, 2u);
+	testBoard.makeMove(0, 1u);
+
+	QCOMPARE(testBoard.getCell(0, rows - 1), 1u);
+	QCOMPARE(testBoard.getCell(1, rows - 1), 2u);
+	QCOMPARE(testBoard.getCell(0, rows - 2), 1u);
+
+	// A copy has its own move stack.
+
+	GameLogic::FourInALine::Board copy(testBoard);
+
+	testBoard.unmakeMove();
+
+	QCOMPARE(testBoard.getCell(0, rows - 2), GameLogic::FourInALine::Board::CELL_EMPTY);
+	QCOMPARE(copy.getCell(0, rows - 2), 1u);
+
+	testBoard.unmakeMove();
+
+	QCOMPARE(testBoard.getCell(1, rows - 1), GameLogic::FourInALine::Board::CELL_EMPTY);
+
+	testBoard.unmakeMove();
+
+	QVERIFY(testBoard.isEmpty() == true);
+
+	copy.unmakeMove();
+	copy.unmakeMove();
+	copy.unmakeMove();
+
+	QVERIFY(copy.isEmpty() == true);
+}
+
+/**
+ * Makes and unmakes random moves on a small and a big board and checks whether the cached winning
+ * cells always match the result of a scan of the whole board.
+ */
+void BoardTest::cachedWinningCells()
+{
+	std::mt19937 randomNumberGenerator(23);
+	unsigned int sizes[2][2] = { { 7, 6 }, { 20, 20 } };
+
+	for (auto size : sizes)
+	{
+		GameLogic::FourInALine::Board testBoard(size[0], size[1]);
+		std::vector<unsigned int> moves;
+
+		for (unsigned int i = 0; i < 2000; ++i)
+		{
+			auto columns = testBoard.getAvailableColumns();
+			std::uniform_int_distribution<unsigned int> action(0, 9);
+			unsigned int nextAction = action(randomNumberGenerator);
+
+			if (nextAction < 3 && !moves.empty() && !testBoard.isColumnEmpty(moves.back()))
+			{
+				testBoard.unmakeMove();
+				moves.pop_back();
+			}
+			else if (nextAction == 3 && !testBoard.findWinningCells().isEmpty())
+			{
+				// Remove a winning token, tokens above it fall down.
+
+				auto winningCells = testBoard.findWinningCells();
+				testBoard.removeToken(winningCells.getCellXPosition(1), winningCells.getCellYPosition(1));
+			}
+			else if (nextAction == 4 || columns.empty() || nextAction < 3)
+			{
+				testBoard.clear();
+				moves.clear();
+			}
+			else
+			{
+				std::uniform_int_distribution<unsigned int> column(0, columns.size() - 1);
+				moves.push_back(columns.at(column(randomNumberGenerator)));
+				testBoard.makeMove(moves.back(), 1u + (i % 2));
+			}
+
+			auto cached = testBoard.findWinningCells();
+			auto scanned = testBoard.scanForWinningCells();
+
+			QCOMPARE(cached.isEmpty(), scanned.isEmpty());
+
+			if (!cached.isEmpty())
+			{
+				QCOMPARE(cached.getLength(), 4u);
+				QVERIFY(cached.getContent(0) != GameLogic::FourInALine::Board::CELL_EMPTY);
+
+				for (unsigned int j = 1; j < 4; ++j)
+				{
+					QCOMPARE(cached.getContent(j), cached.getContent(0));
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Checks whether the hash keys are updated correctly and whether mirrored boards have the same
+ * canonical hash key.
+ */
+void BoardTest::hashKeys()
+{
+	GameLogic::FourInALine::Board testBoard(7, 6);
+	GameLogic::FourInALine::Board mirroredBoard(7, 6);
+	GameLogic::FourInALine::Board otherSizeBoard(6, 7);
+
+	auto emptyKey = testBoard.getHashKey();
+
+	QCOMPARE(testBoard.getMirroredHashKey(), emptyKey);
+	QVERIFY(otherSizeBoard.getHashKey() != emptyKey);
+
+	testBoard.makeMove(0, 1u);
+	testBoard.makeMove(1, 2u);
+	testBoard.makeMove(1, 1u);
+
+	mirroredBoard.makeMove(6, 1u);
+	mirroredBoard.makeMove(5, 2u);
+	mirroredBoard.makeMove(5, 1u);
+
+	QVERIFY(testBoard.getHashKey() != emptyKey);
+	QVERIFY(testBoard.getHashKey() != mirroredBoard.getHashKey());
+	QCOMPARE(testBoard.getHashKey(), mirroredBoard.getMirroredHashKey());
+	QCOMPARE(testBoard.getMirroredHashKey(), mirroredBoard.getHashKey());
+	QCOMPARE(testBoard.getCanonicalHashKey(), mirroredBoard.getCanonicalHashKey());
+	QVERIFY(testBoard.isCanonicalHashKeyMirrored() != mirroredBoard.isCanonicalHashKeyMirrored());
+
+	// The same position reached through another sequence of moves has the same key.
+
+	GameLogic::FourInALine::Board transposedBoard(7, 6);
+
+	transposedBoard.makeMove(1, 2u);
+	transposedBoard.makeMove(0, 1u);
+	transposedBoard.makeMove(1, 1u);
+
+	QCOMPARE(transposedBoard.getHashKey(), testBoard.getHashKey());
+
+	// Removing a token with falling tokens above it.
+
+	GameLogic::FourInALine::Board expectedBoard(7, 6);
+
+	expectedBoard.dropToken(0, 1u);
+	expectedBoard.dropToken(1, 1u);
+
+	testBoard.removeToken(1, 5);
+
+	QCOMPARE(testBoard.getHashKey(), expectedBoard.getHashKey());
+	QCOMPARE(testBoard.getMirroredHashKey(), expectedBoard.getMirroredHashKey());
+
+	testBoard.removeToken(1);
+	testBoard.removeToken(0);
+
+	QCOMPARE(testBoard.getHashKey(), emptyKey);
+
+	testBoard.dropToken(3, 2u);
+	testBoard.clear();
+
+	QCOMPARE(testBoard.getHashKey(), emptyKey);
+}
+
+/**
+ * Checks whether the number of open windows is updated when tokens are dropped and removed.
+ */
+void BoardTest::windowCounts()
+{
+	GameLogic::FourInALine::Board testBoard(4, 4);
+
+	QVERIFY(testBoard.isWindowCountingUsed() == true);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 1), 0u);
+
+	// The bottom left cell is part of a row, a column and a diagonal.
+
+	testBoard.makeMove(0, 1u);
+
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 1), 3u);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(2u, 1), 0u);
+
+	testBoard.makeMove(1, 2u);
+
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 1), 2u);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(2u, 1), 1u);
+
+	testBoard.makeMove(0, 1u);
+	testBoard.makeMove(0, 1u);
+
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 3), 1u);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 4), 0u);
+
+	testBoard.makeMove(0, 1u);
+
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 4), 1u);
+
+	testBoard.unmakeMove();
+	testBoard.unmakeMove();
+
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 4), 0u);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 2), 1u);
+
+	// Removing the bottom token lets the tokens above fall down.
+
+	testBoard.removeToken(0, 3);
+
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 2), 0u);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 1), 2u);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(2u, 1), 1u);
+
+	try
+	{
+		testBoard.getNumberOfOpenWindows(1u, 5);
+		QFAIL("Attempting to count windows with more tokens than cells should throw an exception.");
+	}
+	catch(std::exception) {}
+
+	// A third token disables the window counts until the board is cleared.
+
+	testBoard.dropToken(3, 3u);
+
+	QVERIFY(testBoard.isWindowCountingUsed() == false);
+
+	try
+	{
+		testBoard.getNumberOfOpenWindows(1u, 1);
+		QFAIL("Attempting to count windows of a board with three different tokens should throw an exception.");
+	}
+	catch(std::exception) {}
+
+	testBoard.clear();
+
+	QVERIFY(testBoard.isWindowCountingUsed() == true);
+	QCOMPARE(testBoard.getNumberOfOpenWindows(1u, 1), 0u);
+}
+
+/**
+ * Checks that boards which fit into a bit board store their cells in it, and that they behave like
+ * boards which store their cells in the cell vector.
+ */
+void BoardTest::bitBoardStorage()
+{
+	QVERIFY(GameLogic::FourInALine::Board(7, 6).isBitBoardUsed() == true);
+	QVERIFY(GameLogic::FourInALine::Board(20, 20).isBitBoardUsed() == false);
+
+	// A third kind of token moves the cells into the cell vector until the board is cleared.
+
+	GameLogic::FourInALine::Board testBoard(7, 6);
+	testBoard.dropToken(3, 1);
+	testBoard.dropToken(3, 2);
+	testBoard.dropToken(4, 3);
+
+	QVERIFY(testBoard.isBitBoardUsed() == false);
+	QCOMPARE(testBoard.getCell(3, 5), 1u);
+	QCOMPARE(testBoard.getCell(3, 4), 2u);
+	QCOMPARE(testBoard.getCell(4, 5), 3u);
+
+	testBoard.clear();
+	QVERIFY(testBoard.isBitBoardUsed() == true);
+	QVERIFY(testBoard.isEmpty() == true);
+
+	// Play the same random games on a board using the bit board and on a board using the cell
+	// vector.
+
+	std::mt19937 randomNumberGenerator(7);
+	GameLogic::FourInALine::Board bitBoard(7, 6);
+	GameLogic::FourInALine::Board cellBoard(7, 6);
+
+	cellBoard.dropToken(0, 1);
+	cellBoard.dropToken(0, 2);
+	cellBoard.dropToken(0, 3);
+	cellBoard.removeToken(0);
+	cellBoard.removeToken(0);
+	cellBoard.removeToken(0);
+
+	QVERIFY(cellBoard.isBitBoardUsed() == false);
+
+	for (unsigned int i = 0; i < 3000; ++i)
+	{
+		auto columns = bitBoard.getAvailableColumns();
+		std::uniform_int_distribution<unsigned int> action(0, 9);
+		unsigned int nextAction = action(randomNumberGenerator);
+
+		if (nextAction < 3 && !bitBoard.isEmpty())
+		{
+			std::uniform_int_distribution<unsigned int> column(0, 6);
+			unsigned int x = column(randomNumberGenerator);
+
+			if (!bitBoard.isColumnEmpty(x))
+			{
+				bitBoard.removeToken(x);
+				cellBoard.removeToken(x);
+			}
+		}
+		else if (nextAction == 3 && !bitBoard.findWinningCells().isEmpty())
+		{
+			auto winningCells = bitBoard.findWinningCells();
+			unsigned int x = winningCells.getCellXPosition(1);
+			unsigned int y = winningCells.getCellYPosition(1);
+
+			bitBoard.removeToken(x, y);
+			cellBoard.removeToken(x, y);
+		}
+		else if (columns.empty() || !bitBoard.findWinningCells().isEmpty())
+		{
+			// Clearing the board that uses the cell vector would move it into a bit board.
+
+			while (!bitBoard.isEmpty())
+			{
+				unsigned int x = 0;
+
+				while (bitBoard.isColumnEmpty(x))
+				{
+					x++;
+				}
+
+				bitBoard.removeToken(x);
+				cellBoard.removeToken(x);
+			}
+		}
+		else
+		{
+			std::uniform_int_distribution<unsigned int> column(0, columns.size() - 1);
+			unsigned int x = columns.at(column(randomNumberGenerator));
+
+			QVERIFY(cellBoard.canDropToken(x) == true);
+
+			bitBoard.dropToken(x, 1u + (i % 2));
+			cellBoard.dropToken(x, 1u + (i % 2));
+		}
+
+		QVERIFY(bitBoard.isBitBoardUsed() == true);
+		QCOMPARE(bitBoard.isFull(), cellBoard.isFull());
+		QCOMPARE(bitBoard.getHashKey(), cellBoard.getHashKey());
+
+		for (unsigned int x = 0; x < 7; ++x)
+		{
+			QCOMPARE(bitBoard.canDropToken(x), cellBoard.canDropToken(x));
+
+			for (unsigned int y = 0; y < 6; ++y)
+			{
+				QCOMPARE(bitBoard.getCell(x, y), cellBoard.getCell(x, y));
+			}
+		}
+
+		auto bitBoardCells = bitBoard.findWinningCells();
+		auto cellBoardCells = cellBoard.findWinningCells();
+
+		QCOMPARE(bitBoardCells.isEmpty(), cellBoardCells.isEmpty());
+		QCOMPARE(bitBoard.scanForWinningCells().isEmpty(), bitBoardCells.isEmpty());
+
+		if (!bitBoardCells.isEmpty())
+		{
+			QCOMPARE(bitBoardCells.getCellXPosition(0), cellBoardCells.getCellXPosition(0));
+			QCOMPARE(bitBoardCells.getCellYPosition(0), cellBoardCells.getCellYPosition(0));
+			QCOMPARE(bitBoardCells.getDeltaX(), cellBoardCells.getDeltaX());
+			QCOMPARE(bitBoardCells.getDeltaY(), cellBoardCells.getDeltaY());
+		}
+	}
 }
 
 QTEST_MAIN(BoardTest)
@@ -12,11 +12,17 @@ class BoardTest : public QObject
 
 	private slots:
 		void createAndCopy();
+		void assign();
 		void fillAndEmpty();
 		void accessOutOfRange();
 		void doTokensFallDownOnRemove();
 		void findWinningCells();
 		void getAvailableColumns();
+		void makeAndUnmakeMove();
+		void cachedWinningCells();
+		void hashKeys();
+		void windowCounts();
+		void bitBoardStorage();
 };
 
 #endif // TESTS_GAME_FOUR_IN_A_LINE_BOARDTEST_HPP
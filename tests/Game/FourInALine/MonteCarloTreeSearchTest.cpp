@@ -0,0 +1,264 @@
+#include "MonteCarloTreeSearchTest.hpp"
+#include "../../../src/GameLogic/FourInALine/MonteCarloTreeSearch.hpp"
+#include "../../../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
+#include "../../../src/GameLogic/FourInALine/Game.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+using GameLogic::FourInALine::ArtificialIntelligence;
+using GameLogic::FourInALine::Game;
+using GameLogic::FourInALine::MonteCarloTreeSearch;
+
+/**
+ * Checks whether the tree search finds a move which wins immediately.
+ */
+void MonteCarloTreeSearchTest::obviousWin()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	MonteCarloTreeSearch search;
+
+	for (unsigned int column : { 3, 0, 3, 0, 3, 0 })
+	{
+		game.makeMove(column);
+	}
+
+	// A fourth token in column 3 wins the game.
+
+	QCOMPARE(search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 100), 3u);
+}
+
+/**
+ * Checks whether the tree search blocks a move of the opponent which wins immediately.
+ */
+void MonteCarloTreeSearchTest::preventOpponentWin()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	MonteCarloTreeSearch search;
+
+	for (unsigned int column : { 3, 0, 3, 0, 3 })
+	{
+		game.makeMove(column);
+	}
+
+	QCOMPARE(search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 2000), 3u);
+}
+
+/**
+ * Checks that the search does the given number of playouts and at least one.
+ */
+void MonteCarloTreeSearchTest::numberOfPlayouts()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	MonteCarloTreeSearch search;
+
+	search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 1000);
+
+	QCOMPARE(search.getNumberOfPlayouts(), 1000ull);
+	QVERIFY(search.getNumberOfNodes() > 7);
+
+	// Leaves are only expanded when they are visited again, so the tree has fewer nodes than
+	// 7 per playout.
+
+	QVERIFY(search.getNumberOfNodes() < 7 * 1000);
+
+	search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 0);
+
+	QCOMPARE(search.getNumberOfPlayouts(), 1ull);
+
+	// A full board can not be searched.
+
+	Game fullGame(1, 1, Game::PLAYER_ONE);
+	fullGame.makeMove(0);
+
+	try
+	{
+		search.findBestMove(*fullGame.getBoard(), Game::PLAYER_TWO, 10);
+		QFAIL("Searching a full board should throw an exception.");
+	}
+	catch (std::runtime_error&) {}
+}
+
+/**
+ * Checks that a search with one thread only depends on the seed.
+ */
+void MonteCarloTreeSearchTest::sameSeedSameMove()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	MonteCarloTreeSearch first;
+	MonteCarloTreeSearch second;
+
+	game.makeMove(3);
+	game.makeMove(2);
+
+	first.setSeed(5);
+	second.setSeed(5);
+
+	unsigned int firstMove = first.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 3000);
+	unsigned int secondMove = second.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 3000);
+
+	QCOMPARE(firstMove, secondMove);
+	QCOMPARE(first.getNumberOfNodes(), second.getNumberOfNodes());
+	QVERIFY(first.getPrincipalVariation() == second.getPrincipalVariation());
+
+	auto firstStatistics = first.getMoveStatistics();
+	auto secondStatistics = second.getMoveStatistics();
+
+	QCOMPARE(firstStatistics.size(), secondStatistics.size());
+
+	for (std::size_t i = 0; i < firstStatistics.size(); ++i)
+	{
+		QCOMPARE(firstStatistics[i].column, secondStatistics[i].column);
+		QCOMPARE(firstStatistics[i].nVisits, secondStatistics[i].nVisits);
+		QCOMPARE(firstStatistics[i].winRate, secondStatistics[i].winRate);
+	}
+}
+
+/**
+ * Checks the statistics of the moves of the root and the principal variation.
+ */
+void MonteCarloTreeSearchTest::moveStatistics()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	MonteCarloTreeSearch search;
+
+	unsigned int move = search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 5000);
+	auto moveStatistics = search.getMoveStatistics();
+	auto principalVariation = search.getPrincipalVariation();
+	unsigned long long nVisits = 0;
+
+	QCOMPARE(moveStatistics.size(), std::size_t(7));
+	QCOMPARE(moveStatistics.front().column, move);
+	QVERIFY(!principalVariation.empty());
+	QCOMPARE(principalVariation.front(), move);
+
+	for (std::size_t i = 0; i < moveStatistics.size(); ++i)
+	{
+		QVERIFY(moveStatistics[i].winRate >= 0.0 && moveStatistics[i].winRate <= 1.0);
+		QVERIFY(i == 0 || moveStatistics[i - 1].nVisits >= moveStatistics[i].nVisits);
+		nVisits += moveStatistics[i].nVisits;
+	}
+
+	QCOMPARE(nVisits, 5000ull);
+
+	// The first player has the advantage on an empty board, the center column is the best move.
+
+	QCOMPARE(move, 3u);
+	QVERIFY(moveStatistics.front().winRate > 0.5);
+}
+
+/**
+ * Searches a 15x15 board with several threads and a full arena.
+ */
+void MonteCarloTreeSearchTest::bigBoard()
+{
+	Game game(15, 15, Game::PLAYER_ONE);
+	MonteCarloTreeSearch search(0);
+
+	game.makeMove(7);
+	game.makeMove(7);
+
+	search.setNumberOfThreads(4);
+	search.setPlayoutPolicy(MonteCarloTreeSearch::PlayoutPolicy::RANDOM);
+
+	QCOMPARE(search.getNumberOfThreads(), 4u);
+	QVERIFY(search.getPlayoutPolicy() == MonteCarloTreeSearch::PlayoutPolicy::RANDOM);
+
+	unsigned int move = search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 30000);
+
+	QVERIFY(move < 15);
+	QCOMPARE(search.getNumberOfPlayouts(), 30000ull);
+
+	// The arena has the minimum size, the tree stops growing when it is full.
+
+	QVERIFY(search.getNumberOfNodes() <= std::size_t(1 << 16));
+	QCOMPARE(search.getMoveStatistics().size(), std::size_t(15));
+}
+
+/**
+ * Checks that the stop function ends the search early and that its exceptions are rethrown.
+ */
+void MonteCarloTreeSearchTest::stopFunction()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	MonteCarloTreeSearch search;
+	unsigned int nCalls = 0;
+
+	search.setNumberOfThreads(2);
+	search.setStopFunction([&nCalls]()
+	{
+		return ++nCalls >= 3;
+	});
+
+	unsigned int move = search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 1000000);
+
+	QVERIFY(move < 7);
+	QCOMPARE(nCalls, 3u);
+	QVERIFY(search.getNumberOfPlayouts() < 1000000ull);
+
+	search.setStopFunction([]() -> bool
+	{
+		throw std::logic_error("Cancelled.");
+	});
+
+	try
+	{
+		search.findBestMove(*game.getBoard(), game.getCurrentPlayer(), 1000000);
+		QFAIL("The exception of the stop function should be rethrown.");
+	}
+	catch (std::logic_error&) {}
+}
+
+/**
+ * Checks the tree search as search algorithm of the artificial intelligence.
+ */
+void MonteCarloTreeSearchTest::artificialIntelligence()
+{
+	Game game(6, 7, Game::PLAYER_ONE);
+	ArtificialIntelligence ai(1);
+	std::vector<ArtificialIntelligence::IterationResult> results;
+
+	for (unsigned int column : { 3, 0, 3, 0, 3 })
+	{
+		game.makeMove(column);
+	}
+
+	QVERIFY(ai.getSearchAlgorithm() == ArtificialIntelligence::SearchAlgorithm::ALPHA_BETA);
+
+	ai.setSearchAlgorithm(ArtificialIntelligence::SearchAlgorithm::MONTE_CARLO_TREE_SEARCH);
+	ai.setNodeBudget(3000);
+	ai.setScoreAllMoves(true);
+	ai.setIterationCallback([&results](const ArtificialIntelligence::IterationResult& result)
+	{
+		results.push_back(result);
+	});
+
+	// The node budget is the number of playouts.
+
+	QCOMPARE(ai.computeNextMove(game), 3u);
+	QCOMPARE(ai.getSearchStatistics().nNodes, 3000ull);
+	QVERIFY(ai.getCompletedSearchDepth() > 0);
+
+	const auto& moveScores = ai.getMoveScores();
+
+	QCOMPARE(moveScores.size(), std::size_t(7));
+	QCOMPARE(moveScores.front().column, 3u);
+
+	for (const auto& moveScore : moveScores)
+	{
+		QVERIFY(moveScore.score >= -1000 && moveScore.score <= 1000);
+	}
+
+	QCOMPARE(results.size(), std::size_t(1));
+	QCOMPARE(results.front().depth, ai.getCompletedSearchDepth());
+	QCOMPARE(results.front().principalVariation.front(), 3u);
+
+	// Without a budget the default number of playouts is done.
+
+	ai.setNodeBudget(0);
+	ai.computeNextMove(game);
+
+	QCOMPARE(ai.getSearchStatistics().nNodes, ArtificialIntelligence::DEFAULT_NUMBER_OF_PLAYOUTS);
+}
+
+QTEST_MAIN(MonteCarloTreeSearchTest)
@@ -0,0 +1,24 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_MONTECARLOTREESEARCHTEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_MONTECARLOTREESEARCHTEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::MonteCarloTreeSearch class.
+ */
+class MonteCarloTreeSearchTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void obviousWin();
+		void preventOpponentWin();
+		void numberOfPlayouts();
+		void sameSeedSameMove();
+		void moveStatistics();
+		void bigBoard();
+		void stopFunction();
+		void artificialIntelligence();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_MONTECARLOTREESEARCHTEST_HPP
@@ -0,0 +1,9 @@
+include(../../Defines.pri)
+
+QT      += testlib
+CONFIG  += testcase
+TEMPLATE = app
+
+SOURCES += MonteCarloTreeSearchTest.cpp
+
+HEADERS += MonteCarloTreeSearchTest.hpp
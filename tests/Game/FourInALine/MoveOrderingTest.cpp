@@ -0,0 +1,109 @@
+#include "MoveOrderingTest.hpp"
+#include "../../../src/GameLogic/FourInALine/MoveOrdering.hpp"
+#include "../../../src/GameLogic/FourInALine/Board.hpp"
+
+#include <QDebug>
+#include <vector>
+
+using GameLogic::FourInALine::MoveOrdering;
+
+/**
+ * Checks the center first and the left to right ordering.
+ */
+void MoveOrderingTest::staticOrdering()
+{
+	GameLogic::FourInALine::Board oddBoard(7, 6);
+	GameLogic::FourInALine::Board evenBoard(8, 6);
+	MoveOrdering ordering;
+
+	std::vector<unsigned int> moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderStatically(oddBoard, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 3, 2, 4, 1, 5, 0, 6 }));
+
+	moves = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	ordering.orderStatically(evenBoard, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 3, 4, 2, 5, 1, 6, 0, 7 }));
+
+	ordering.setCenterFirst(false);
+	QCOMPARE(ordering.isCenterFirst(), false);
+
+	moves = { 6, 3, 0, 4 };
+	ordering.orderStatically(oddBoard, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 0, 3, 4, 6 }));
+}
+
+/**
+ * Checks whether the hash move is searched first and killer moves are searched next.
+ */
+void MoveOrderingTest::hashAndKillerMoves()
+{
+	GameLogic::FourInALine::Board board(7, 6);
+	MoveOrdering ordering;
+
+	ordering.setHistoryHeuristic(false);
+	ordering.prepare(board, 4);
+
+	// Without hash move and killer moves the moves are sorted statically.
+
+	std::vector<unsigned int> moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 1, MoveOrdering::NO_MOVE, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 3, 2, 4, 1, 5, 0, 6 }));
+
+	ordering.addCutoff(board, 1, 3, 6);
+	ordering.addCutoff(board, 1, 3, 0);
+
+	moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 1, 5, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 5, 0, 6, 3, 2, 4, 1 }));
+
+	// Killer moves are stored per ply.
+
+	moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 2, MoveOrdering::NO_MOVE, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 3, 2, 4, 1, 5, 0, 6 }));
+
+	ordering.setKillerMoves(false);
+	ordering.setHashMoveFirst(false);
+
+	moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 1, 5, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 3, 2, 4, 1, 5, 0, 6 }));
+
+	// prepare() removes the killer moves.
+
+	ordering.setKillerMoves(true);
+	ordering.prepare(board, 4);
+
+	moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 1, MoveOrdering::NO_MOVE, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 3, 2, 4, 1, 5, 0, 6 }));
+}
+
+/**
+ * Checks whether moves into cells with a high history score are searched first.
+ */
+void MoveOrderingTest::historyHeuristic()
+{
+	GameLogic::FourInALine::Board board(7, 6);
+	MoveOrdering ordering;
+
+	ordering.setKillerMoves(false);
+	ordering.prepare(board, 4);
+
+	ordering.addCutoff(board, 0, 1, 1);
+	ordering.addCutoff(board, 2, 3, 5);
+
+	std::vector<unsigned int> moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 1, MoveOrdering::NO_MOVE, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 5, 1, 3, 2, 4, 0, 6 }));
+
+	// The history score belongs to the cell, not to the column.
+
+	board.dropToken(5, 1);
+
+	moves = { 0, 1, 2, 3, 4, 5, 6 };
+	ordering.orderMoves(board, 1, MoveOrdering::NO_MOVE, moves);
+	QVERIFY(moves == std::vector<unsigned int>({ 1, 3, 2, 4, 5, 0, 6 }));
+}
+
+QTEST_MAIN(MoveOrderingTest)
@@ -0,0 +1,19 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_MOVEORDERINGTEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_MOVEORDERINGTEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::MoveOrdering class.
+ */
+class MoveOrderingTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void staticOrdering();
+		void hashAndKillerMoves();
+		void historyHeuristic();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_MOVEORDERINGTEST_HPP
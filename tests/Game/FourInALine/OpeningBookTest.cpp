@@ -0,0 +1,182 @@
+#include "OpeningBookTest.hpp"
+#include "../../../src/GameLogic/FourInALine/OpeningBook.hpp"
+#include "../../../src/GameLogic/FourInALine/OpeningBookGenerator.hpp"
+#include "../../../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
+#include "../../../src/GameLogic/FourInALine/Game.hpp"
+
+#include <QFile>
+#include <memory>
+#include <vector>
+
+using GameLogic::FourInALine::OpeningBook;
+
+/**
+ * Writes a book with a few positions, loads it and looks up the positions.
+ */
+void OpeningBookTest::writeAndLookup()
+{
+	QString fileName("OpeningBookTest.book");
+	GameLogic::FourInALine::Board board(7, 6);
+	std::vector<OpeningBook::EntryType> entries;
+
+	// Empty board, player 1 plays in the center.
+
+	entries.push_back(std::make_pair(OpeningBook::computeKey(board, 1), 3u));
+
+	// Token of player 1 in column 1, player 2 plays in column 2 (for the canonical board).
+
+	board.dropToken(1, 1);
+
+	unsigned int canonicalMove = board.isCanonicalHashKeyMirrored() ? 4 : 2;
+	entries.push_back(std::make_pair(OpeningBook::computeKey(board, 2), canonicalMove));
+
+	OpeningBook::write(fileName, 7, 6, 2, 10, entries);
+
+	OpeningBook book;
+	QCOMPARE(book.isLoaded(), false);
+
+	book.load(fileName);
+
+	QCOMPARE(book.isLoaded(), true);
+	QCOMPARE(book.getNumberOfColumns(), 7u);
+	QCOMPARE(book.getNumberOfRows(), 6u);
+	QCOMPARE(book.getNumberOfPlies(), 2u);
+	QCOMPARE(book.getSearchDepth(), 10u);
+	QCOMPARE(book.getNumberOfEntries(), static_cast<std::size_t>(2));
+
+	unsigned int move = 0;
+
+	QCOMPARE(book.lookup(board, 2, move), true);
+	QCOMPARE(move, 2u);
+	QCOMPARE(book.lookup(board, 1, move), false);
+
+	// The mirrored board has the mirrored move.
+
+	GameLogic::FourInALine::Board mirroredBoard(7, 6);
+	mirroredBoard.dropToken(5, 1);
+
+	QCOMPARE(book.lookup(mirroredBoard, 2, move), true);
+	QCOMPARE(move, 4u);
+
+	GameLogic::FourInALine::Board emptyBoard(7, 6);
+
+	QCOMPARE(book.lookup(emptyBoard, 1, move), true);
+	QCOMPARE(move, 3u);
+
+	// Boards of another size are not in the book.
+
+	GameLogic::FourInALine::Board otherBoard(8, 7);
+
+	QCOMPARE(book.lookup(otherBoard, 1, move), false);
+
+	book.close();
+
+	QCOMPARE(book.isLoaded(), false);
+	QCOMPARE(book.lookup(emptyBoard, 1, move), false);
+
+	QFile::remove(fileName);
+}
+
+/**
+ * Tries to load files which are not opening books.
+ */
+void OpeningBookTest::invalidFiles()
+{
+	OpeningBook book;
+
+	try
+	{
+		book.load("OpeningBookTestMissing.book");
+		QFAIL("Loading a missing file should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	QString fileName("OpeningBookTest.book");
+	QFile file(fileName);
+	QByteArray bytes;
+
+	bytes.append("This is not an opening book, but it is long enough for a header.", 64);
+
+	QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+	QCOMPARE(file.write(bytes), static_cast<qint64>(bytes.size()));
+	file.close();
+
+	try
+	{
+		book.load(fileName);
+		QFAIL("Loading an invalid file should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	QCOMPARE(book.isLoaded(), false);
+
+	QFile::remove(fileName);
+}
+
+/**
+ * Generates a book for a small board and checks whether it contains the moves computed by the
+ * artificial intelligence and whether the artificial intelligence uses it.
+ */
+void OpeningBookTest::generate()
+{
+	QString fileName("OpeningBookTest.book");
+	GameLogic::FourInALine::OpeningBookGenerator generator(5, 4, 3, 4);
+	std::size_t nProgressCalls = 0;
+
+	generator.setProgressCallback([&nProgressCalls](std::size_t) { nProgressCalls++; });
+
+	std::size_t nPositions = generator.generate(fileName);
+
+	// Positions with 0, 1 and 2 tokens, for both players making the first move, without mirrored
+	// positions: 1 + 3 + 13 (of 25 two-token positions, only one is symmetric) per player.
+
+	QCOMPARE(nPositions, static_cast<std::size_t>(2 * (1 + 3 + 13)));
+	QCOMPARE(nProgressCalls, nPositions);
+
+	auto book = std::make_shared<OpeningBook>();
+	book->load(fileName);
+
+	QCOMPARE(book->getNumberOfEntries(), nPositions);
+
+	GameLogic::FourInALine::ArtificialIntelligence ai(4);
+	GameLogic::FourInALine::ArtificialIntelligence bookAi(4);
+	GameLogic::FourInALine::ArtificialIntelligence deepBookAi(5);
+
+	bookAi.setOpeningBook(book);
+	deepBookAi.setOpeningBook(book);
+
+	QVERIFY(bookAi.getOpeningBook() == book);
+
+	for (unsigned int x1 = 0; x1 < 5; ++x1)
+	{
+		for (unsigned int x2 = 0; x2 < 5; ++x2)
+		{
+			GameLogic::FourInALine::Game game(4, 5, 2);
+			unsigned int move = 0;
+
+			game.makeMove(x1);
+			game.makeMove(x2);
+
+			QCOMPARE(book->lookup(*game.getBoard(), game.getCurrentPlayer(), move), true);
+			QCOMPARE(move, ai.computeNextMove(game));
+
+			// The book is only used when it was computed with at least the search depth.
+
+			QCOMPARE(bookAi.computeNextMove(game), move);
+			QCOMPARE(bookAi.getNumberOfNodes(), 0ull);
+
+			deepBookAi.computeNextMove(game);
+			QVERIFY(deepBookAi.getNumberOfNodes() > 0);
+
+			// Positions with more tokens are not in the book.
+
+			game.makeMove(move);
+			QCOMPARE(book->lookup(*game.getBoard(), game.getCurrentPlayer(), move), false);
+		}
+	}
+
+	book->close();
+	QFile::remove(fileName);
+}
+
+QTEST_MAIN(OpeningBookTest)
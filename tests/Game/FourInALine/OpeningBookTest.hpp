@@ -0,0 +1,19 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_OPENINGBOOKTEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_OPENINGBOOKTEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::OpeningBook and OpeningBookGenerator classes.
+ */
+class OpeningBookTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void writeAndLookup();
+		void invalidFiles();
+		void generate();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_OPENINGBOOKTEST_HPP
@@ -0,0 +1,124 @@
+#include "SearchArenaTest.hpp"
+#include "../../../src/GameLogic/FourInALine/SearchArena.hpp"
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+using GameLogic::FourInALine::SearchArena;
+
+/**
+ * Checks that allocations are aligned, do not overlap and count towards the used size.
+ */
+void SearchArenaTest::allocate()
+{
+	SearchArena arena(1024);
+
+	QCOMPARE(arena.getCapacity(), std::size_t(1024));
+	QCOMPARE(arena.getUsedSize(), std::size_t(0));
+
+	char* bytes = static_cast<char*>(arena.allocate(3, 1));
+	std::uint64_t* numbers = arena.allocateArray<std::uint64_t>(4);
+
+	QVERIFY(reinterpret_cast<std::uintptr_t>(numbers) % alignof(std::uint64_t) == 0);
+	QVERIFY(reinterpret_cast<char*>(numbers) >= bytes + 3);
+
+	// The padding for the alignment is part of the used size.
+
+	QCOMPARE(arena.getUsedSize(), std::size_t(8 + 4 * sizeof(std::uint64_t)));
+
+	// The objects are value-initialized.
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		QCOMPARE(numbers[i], std::uint64_t(0));
+		numbers[i] = i;
+	}
+
+	unsigned int* more = arena.allocateArray<unsigned int>(2);
+	more[0] = 7;
+	more[1] = 8;
+
+	QCOMPARE(numbers[3], std::uint64_t(3));
+
+	try
+	{
+		arena.allocate(8, 3);
+		QFAIL("An alignment which is not a power of 2 should throw an exception.");
+	}
+	catch (std::invalid_argument&) {}
+}
+
+/**
+ * Checks that reset() frees everything in one step and that rewind() only frees the newest
+ * allocations.
+ */
+void SearchArenaTest::resetAndRewind()
+{
+	SearchArena arena(1024);
+
+	arena.allocateArray<unsigned int>(10);
+
+	std::size_t usedSize = arena.getUsedSize();
+	unsigned int* first = arena.allocateArray<unsigned int>(20);
+
+	QCOMPARE(arena.getPeakSize(), usedSize + 20 * sizeof(unsigned int));
+
+	// The memory after the rewound size is used again, the peak size is kept.
+
+	arena.rewind(usedSize);
+
+	QCOMPARE(arena.getUsedSize(), usedSize);
+	QCOMPARE(arena.allocateArray<unsigned int>(5), first);
+	QCOMPARE(arena.getPeakSize(), usedSize + 20 * sizeof(unsigned int));
+
+	try
+	{
+		arena.rewind(arena.getUsedSize() + 1);
+		QFAIL("Rewinding to a bigger used size should throw an exception.");
+	}
+	catch (std::invalid_argument&) {}
+
+	// The block is kept, the first allocation after a reset starts at its beginning again.
+
+	unsigned int* beginning = static_cast<unsigned int*>(first) - 10;
+
+	arena.reset();
+
+	QCOMPARE(arena.getUsedSize(), std::size_t(0));
+	QCOMPARE(arena.getPeakSize(), std::size_t(0));
+	QCOMPARE(arena.allocateArray<unsigned int>(1), beginning);
+}
+
+/**
+ * Checks that the arena never grows beyond its capacity.
+ */
+void SearchArenaTest::capacity()
+{
+	SearchArena arena(64);
+
+	arena.allocateArray<std::uint32_t>(16);
+
+	QCOMPARE(arena.getUsedSize(), std::size_t(64));
+
+	try
+	{
+		arena.allocate(1, 1);
+		QFAIL("Allocating more than the capacity should throw an exception.");
+	}
+	catch (std::bad_alloc&) {}
+
+	arena.reset();
+
+	try
+	{
+		arena.allocateArray<std::uint64_t>(static_cast<std::size_t>(-1) / 4);
+		QFAIL("An array bigger than the capacity should throw an exception.");
+	}
+	catch (std::bad_alloc&) {}
+
+	QCOMPARE(arena.getUsedSize(), std::size_t(0));
+	QCOMPARE(arena.allocateArray<std::uint64_t>(8)[7], std::uint64_t(0));
+}
+
+QTEST_MAIN(SearchArenaTest)
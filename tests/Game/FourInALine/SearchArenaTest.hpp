@@ -0,0 +1,19 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_SEARCHARENATEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_SEARCHARENATEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::SearchArena class.
+ */
+class SearchArenaTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void allocate();
+		void resetAndRewind();
+		void capacity();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_SEARCHARENATEST_HPP
@@ -0,0 +1,174 @@
+#include "SearchWorkerTest.hpp"
+#include "../../../src/GameLogic/FourInALine/SearchWorker.hpp"
+
+#include <QDebug>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using GameLogic::FourInALine::SearchWorker;
+
+/**
+ * Adds jobs to a worker and checks whether they are executed in order by the same thread.
+ */
+void SearchWorkerTest::executeJobs()
+{
+	SearchWorker worker;
+	std::mutex mutex;
+	std::vector<unsigned int> executedJobs;
+	std::vector<std::thread::id> threads;
+	std::promise<void> lastJobDone;
+
+	QCOMPARE(worker.isWorkerThread(), false);
+
+	for (unsigned int i = 0; i < 10; ++i)
+	{
+		worker.addJob([&, i]()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			executedJobs.push_back(i);
+			threads.push_back(std::this_thread::get_id());
+		});
+	}
+
+	bool isWorkerThread = false;
+
+	worker.addJob([&]()
+	{
+		isWorkerThread = worker.isWorkerThread();
+		lastJobDone.set_value();
+	});
+
+	lastJobDone.get_future().wait();
+
+	QCOMPARE(executedJobs.size(), static_cast<std::size_t>(10));
+	QCOMPARE(worker.getNumberOfPendingJobs(), static_cast<std::size_t>(0));
+	QCOMPARE(isWorkerThread, true);
+
+	for (unsigned int i = 0; i < 10; ++i)
+	{
+		QCOMPARE(executedJobs[i], i);
+		QVERIFY(threads[i] == threads[0]);
+	}
+
+	QVERIFY(threads[0] != std::this_thread::get_id());
+
+	// A job throwing an exception does not stop the worker.
+
+	std::promise<void> jobAfterExceptionDone;
+
+	worker.addJob([]() { throw std::runtime_error("Job failed."); });
+	worker.addJob([&]() { jobAfterExceptionDone.set_value(); });
+
+	jobAfterExceptionDone.get_future().wait();
+}
+
+/**
+ * Destroys a worker with pending jobs and checks whether only the running job was finished.
+ */
+void SearchWorkerTest::dropJobsOnDestruction()
+{
+	std::atomic<unsigned int> nExecutedJobs(0);
+	std::promise<void> firstJobStarted;
+
+	{
+		SearchWorker worker;
+
+		worker.addJob([&]()
+		{
+			firstJobStarted.set_value();
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			nExecutedJobs++;
+		});
+
+		for (unsigned int i = 0; i < 5; ++i)
+		{
+			worker.addJob([&nExecutedJobs]()
+			{
+				nExecutedJobs++;
+			});
+		}
+
+		firstJobStarted.get_future().wait();
+	}
+
+	QCOMPARE(nExecutedJobs.load(), 1u);
+}
+
+/**
+ * Removes the jobs of one owner and checks whether the jobs of the other owners are neither removed
+ * nor waited for.
+ */
+void SearchWorkerTest::removeJobs()
+{
+	SearchWorker worker;
+	int owner = 0;
+	int otherOwner = 0;
+	std::atomic<unsigned int> nOwnerJobs(0);
+	std::atomic<unsigned int> nOtherOwnerJobs(0);
+	std::promise<void> otherJobStarted;
+	std::promise<void> releaseOtherJob;
+	std::shared_future<void> otherJobReleased = releaseOtherJob.get_future().share();
+	std::promise<void> lastJobDone;
+
+	worker.addJob([&]()
+	{
+		otherJobStarted.set_value();
+		otherJobReleased.wait();
+		nOtherOwnerJobs++;
+	}, &otherOwner);
+
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		worker.addJob([&nOwnerJobs]() { nOwnerJobs++; }, &owner);
+	}
+
+	worker.addJob([&nOtherOwnerJobs]() { nOtherOwnerJobs++; }, &otherOwner);
+
+	// The running job of the other owner is not waited for.
+
+	otherJobStarted.get_future().wait();
+	worker.removeJobs(&owner);
+
+	QCOMPARE(worker.getNumberOfPendingJobs(), static_cast<std::size_t>(1));
+
+	releaseOtherJob.set_value();
+	worker.addJob([&]() { lastJobDone.set_value(); });
+	lastJobDone.get_future().wait();
+
+	QCOMPARE(nOwnerJobs.load(), 0u);
+	QCOMPARE(nOtherOwnerJobs.load(), 2u);
+
+	// The running job of the owner is waited for.
+
+	worker.addJob([&nOwnerJobs]()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		nOwnerJobs++;
+	}, &owner);
+
+	while (worker.getNumberOfPendingJobs() > 0)
+	{
+		std::this_thread::yield();
+	}
+
+	worker.removeJobs(&owner);
+
+	QCOMPARE(nOwnerJobs.load(), 1u);
+}
+
+/**
+ * Checks whether the shared instance is shared as long as it is used.
+ */
+void SearchWorkerTest::sharedInstance()
+{
+	auto worker = SearchWorker::getSharedInstance();
+
+	QVERIFY(worker != nullptr);
+	QVERIFY(SearchWorker::getSharedInstance() == worker);
+}
+
+QTEST_MAIN(SearchWorkerTest)
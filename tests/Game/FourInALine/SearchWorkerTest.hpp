@@ -0,0 +1,20 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_SEARCHWORKERTEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_SEARCHWORKERTEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::SearchWorker class.
+ */
+class SearchWorkerTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void executeJobs();
+		void dropJobsOnDestruction();
+		void removeJobs();
+		void sharedInstance();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_SEARCHWORKERTEST_HPP
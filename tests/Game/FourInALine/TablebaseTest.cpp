@@ -0,0 +1,223 @@
+#include "TablebaseTest.hpp"
+#include "../../../src/GameLogic/FourInALine/Tablebase.hpp"
+#include "../../../src/GameLogic/FourInALine/TablebaseGenerator.hpp"
+#include "../../../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
+#include "../../../src/GameLogic/FourInALine/Solver.hpp"
+#include "../../../src/GameLogic/FourInALine/Game.hpp"
+
+#include <QFile>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using GameLogic::FourInALine::Tablebase;
+
+/**
+ * Generates the tablebase of a 4x4 board with two threads and compares its scores, move scores and
+ * moves with the scores computed by the solver.
+ */
+void TablebaseTest::generateAndProbe()
+{
+	QString fileName("TablebaseTest.tablebase");
+	GameLogic::FourInALine::TablebaseGenerator generator(4, 4);
+	std::vector<unsigned int> progress;
+
+	QCOMPARE(Tablebase::isSupported(4, 4), true);
+	QCOMPARE(Tablebase::isSupported(5, 4), true);
+	QCOMPARE(Tablebase::isSupported(6, 5), false);
+	QCOMPARE(Tablebase::getNumberOfEntries(4, 4), 31ull * 31 * 31 * 31);
+
+	generator.setNumberOfThreads(2);
+	generator.setProgressCallback([&progress](unsigned int nTokens) { progress.push_back(nTokens); });
+
+	std::size_t nPositions = generator.generate(fileName);
+
+	// The positions are computed from the full boards down to the empty board.
+
+	QCOMPARE(progress.size(), static_cast<std::size_t>(17));
+	QCOMPARE(progress.front(), 16u);
+	QCOMPARE(progress.back(), 0u);
+	QVERIFY(nPositions > 0);
+	QVERIFY(nPositions < Tablebase::getNumberOfEntries(4, 4));
+
+	Tablebase tablebase;
+	QCOMPARE(tablebase.isLoaded(), false);
+
+	tablebase.load(fileName);
+
+	QCOMPARE(tablebase.isLoaded(), true);
+	QCOMPARE(tablebase.getNumberOfColumns(), 4u);
+	QCOMPARE(tablebase.getNumberOfRows(), 4u);
+
+	GameLogic::FourInALine::Solver solver;
+	std::mt19937 randomGenerator(17);
+	int score = 1;
+	unsigned int move = 0;
+	std::vector<int> tablebaseScores;
+
+	// The empty 4x4 board is a draw.
+
+	GameLogic::FourInALine::Board emptyBoard(4, 4);
+
+	QCOMPARE(tablebase.probe(emptyBoard, 1, score), true);
+	QCOMPARE(score, 0);
+
+	for (unsigned int i = 0; i < 200; ++i)
+	{
+		GameLogic::FourInALine::Game game(4, 4, 1 + i % 2);
+		unsigned int nMoves = randomGenerator() % 16;
+
+		for (unsigned int j = 0; j < nMoves && !game.isOver(); ++j)
+		{
+			std::vector<unsigned int> columns = game.getBoard()->getAvailableColumns();
+			game.makeMove(columns[randomGenerator() % columns.size()]);
+		}
+
+		const GameLogic::FourInALine::Board& board = *game.getBoard();
+
+		if (game.isOver())
+		{
+			// Finished games are not in the tablebase.
+
+			QCOMPARE(tablebase.probe(board, game.getCurrentPlayer(), score), false);
+			QCOMPARE(tablebase.findBestMove(board, game.getCurrentPlayer(), move), false);
+			QCOMPARE(tablebase.scoreMoves(board, game.getCurrentPlayer(), tablebaseScores), false);
+			continue;
+		}
+
+		std::vector<int> moveScores = solver.scoreMoves(board, game.getCurrentPlayer());
+		int bestScore = *std::max_element(moveScores.begin(), moveScores.end());
+
+		QCOMPARE(tablebase.probe(board, game.getCurrentPlayer(), score), true);
+		QCOMPARE(score, solver.solve(board, game.getCurrentPlayer()));
+		QCOMPARE(score, bestScore);
+
+		QCOMPARE(tablebase.findBestMove(board, game.getCurrentPlayer(), move), true);
+		QCOMPARE(moveScores[move], bestScore);
+
+		QCOMPARE(tablebase.scoreMoves(board, game.getCurrentPlayer(), tablebaseScores), true);
+		QVERIFY(tablebaseScores == moveScores);
+	}
+
+	// Boards of another size are not in the tablebase.
+
+	GameLogic::FourInALine::Board otherBoard(5, 4);
+
+	QCOMPARE(tablebase.probe(otherBoard, 1, score), false);
+
+	tablebase.close();
+
+	QCOMPARE(tablebase.isLoaded(), false);
+	QCOMPARE(tablebase.probe(emptyBoard, 1, score), false);
+
+	QFile::remove(fileName);
+}
+
+/**
+ * Tries to load files which are not tablebases and to write a tablebase with the wrong size.
+ */
+void TablebaseTest::invalidFiles()
+{
+	Tablebase tablebase;
+
+	try
+	{
+		tablebase.load("TablebaseTestMissing.tablebase");
+		QFAIL("Loading a missing file should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	QString fileName("TablebaseTest.tablebase");
+	QFile file(fileName);
+	QByteArray bytes;
+
+	bytes.append("This is not a tablebase, but it is long enough for a header.", 60);
+
+	QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+	QCOMPARE(file.write(bytes), static_cast<qint64>(bytes.size()));
+	file.close();
+
+	try
+	{
+		tablebase.load(fileName);
+		QFAIL("Loading an invalid file should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	QCOMPARE(tablebase.isLoaded(), false);
+
+	try
+	{
+		Tablebase::write(fileName, 4, 4, std::vector<Tablebase::EntryType>(10, 0));
+		QFAIL("Writing entries of the wrong size should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	try
+	{
+		GameLogic::FourInALine::TablebaseGenerator generator(7, 6);
+		generator.generate(fileName);
+		QFAIL("Generating a tablebase of a big board should throw an exception.");
+	}
+	catch (std::exception&) {}
+
+	QFile::remove(fileName);
+}
+
+/**
+ * Checks whether an artificial intelligence with a tablebase takes its moves from the tablebase and
+ * never loses against a deeper search.
+ */
+void TablebaseTest::artificialIntelligence()
+{
+	QString fileName("TablebaseTest.tablebase");
+	GameLogic::FourInALine::TablebaseGenerator generator(4, 4);
+
+	generator.generate(fileName);
+
+	auto tablebase = std::make_shared<Tablebase>();
+	tablebase->load(fileName);
+
+	GameLogic::FourInALine::ArtificialIntelligence tablebaseAi(1);
+	GameLogic::FourInALine::ArtificialIntelligence ai(6);
+
+	tablebaseAi.setTablebase(tablebase);
+	QVERIFY(tablebaseAi.getTablebase() == tablebase);
+
+	for (unsigned int firstPlayer = 1; firstPlayer <= 2; ++firstPlayer)
+	{
+		GameLogic::FourInALine::Game game(4, 4, firstPlayer);
+
+		while (!game.isOver())
+		{
+			if (game.getCurrentPlayer() == 1)
+			{
+				unsigned int move = tablebaseAi.computeNextMove(game);
+
+				QCOMPARE(tablebaseAi.getNumberOfNodes(), 0ull);
+				QCOMPARE(tablebaseAi.getCompletedSearchDepth(), 16 - game.getNumberOfMoves());
+
+				game.makeMove(move);
+			}
+			else
+			{
+				game.makeMove(ai.computeNextMove(game));
+			}
+		}
+
+		QVERIFY(game.isDraw() || game.getWinner() == 1);
+	}
+
+	// Boards of another size are searched.
+
+	GameLogic::FourInALine::Game otherGame(4, 5, 1);
+
+	tablebaseAi.computeNextMove(otherGame);
+	QVERIFY(tablebaseAi.getNumberOfNodes() > 0);
+
+	tablebase->close();
+	QFile::remove(fileName);
+}
+
+QTEST_MAIN(TablebaseTest)
@@ -0,0 +1,19 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_TABLEBASETEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_TABLEBASETEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::Tablebase and TablebaseGenerator classes.
+ */
+class TablebaseTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void generateAndProbe();
+		void invalidFiles();
+		void artificialIntelligence();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_TABLEBASETEST_HPP
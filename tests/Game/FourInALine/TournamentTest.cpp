@@ -0,0 +1,100 @@
+#include "TournamentTest.hpp"
+#include "../../../src/GameLogic/FourInALine/Tournament.hpp"
+
+#include <cmath>
+
+using GameLogic::FourInALine::Tournament;
+
+/**
+ * Checks the conversion of scores into Elo differences and the error margin.
+ */
+void TournamentTest::eloDifference()
+{
+	QCOMPARE(Tournament::computeEloDifference(0.5), 0.0);
+	QVERIFY(std::fabs(Tournament::computeEloDifference(0.75) - 190.85) < 0.01);
+	QVERIFY(std::fabs(Tournament::computeEloDifference(0.25) + 190.85) < 0.01);
+	QVERIFY(std::isinf(Tournament::computeEloDifference(0.0)));
+	QVERIFY(std::isinf(Tournament::computeEloDifference(1.0)));
+
+	Tournament::Result result = Tournament::Result();
+	result.nWins = 30;
+	result.nDraws = 40;
+	result.nLosses = 30;
+
+	QCOMPARE(result.getNumberOfGames(), 100u);
+	QCOMPARE(result.getScore(), 0.5);
+	QCOMPARE(result.getEloDifference(), 0.0);
+	QVERIFY(result.getEloErrorMargin() > 0.0);
+
+	// The margin shrinks with more games.
+
+	Tournament::Result moreGames = result;
+	moreGames.nWins *= 4;
+	moreGames.nDraws *= 4;
+	moreGames.nLosses *= 4;
+
+	QVERIFY(moreGames.getEloErrorMargin() < result.getEloErrorMargin());
+}
+
+/**
+ * Lets a search of depth 1 play against a search of depth 5, the deeper search must win more games.
+ */
+void TournamentTest::strongerEngineWins()
+{
+	Tournament::EngineConfiguration weak = Tournament::getDefaultConfiguration();
+	Tournament::EngineConfiguration strong = Tournament::getDefaultConfiguration();
+
+	weak.searchDepth = 1;
+	strong.searchDepth = 5;
+
+	Tournament tournament(weak, strong, 7, 6);
+	tournament.setNumberOfGames(7);
+	tournament.setNumberOfThreads(2);
+
+	// The number of games is rounded up to an even number.
+
+	QCOMPARE(tournament.getNumberOfGames(), 8u);
+
+	Tournament::Result result = tournament.run();
+
+	QCOMPARE(result.getNumberOfGames(), 8u);
+	QVERIFY(result.nLosses > result.nWins);
+	QVERIFY(result.getEloDifference() < 0.0);
+	QVERIFY(result.nMoves[0] > 0);
+	QVERIFY(result.nMoves[1] > 0);
+	QVERIFY(result.getAverageMoveTime(1) >= result.getAverageMoveTime(0));
+	QVERIFY(result.getGamesPerSecond() > 0.0);
+}
+
+/**
+ * Checks that the games do not depend on the number of threads playing them.
+ */
+void TournamentTest::threadsDoNotChangeResult()
+{
+	Tournament::EngineConfiguration first = Tournament::getDefaultConfiguration();
+	Tournament::EngineConfiguration second = Tournament::getDefaultConfiguration();
+
+	first.searchDepth = 2;
+	second.searchDepth = 3;
+	second.evaluationWeights.threeTokens = 50;
+
+	Tournament tournament(first, second, 7, 6);
+	tournament.setNumberOfGames(12);
+	tournament.setNumberOfOpeningMoves(4);
+	tournament.setSeed(5);
+	tournament.setNumberOfThreads(1);
+
+	Tournament::Result singleThreaded = tournament.run();
+
+	tournament.setNumberOfThreads(4);
+
+	Tournament::Result multiThreaded = tournament.run();
+
+	QCOMPARE(multiThreaded.nWins, singleThreaded.nWins);
+	QCOMPARE(multiThreaded.nDraws, singleThreaded.nDraws);
+	QCOMPARE(multiThreaded.nLosses, singleThreaded.nLosses);
+	QCOMPARE(multiThreaded.nMoves[0], singleThreaded.nMoves[0]);
+	QCOMPARE(multiThreaded.nMoves[1], singleThreaded.nMoves[1]);
+}
+
+QTEST_MAIN(TournamentTest)
@@ -0,0 +1,19 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_TOURNAMENTTEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_TOURNAMENTTEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::Tournament class.
+ */
+class TournamentTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void eloDifference();
+		void strongerEngineWins();
+		void threadsDoNotChangeResult();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_TOURNAMENTTEST_HPP
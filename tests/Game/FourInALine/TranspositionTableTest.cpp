@@ -0,0 +1,86 @@
+#include "TranspositionTableTest.hpp"
+#include "../../../src/GameLogic/FourInALine/TranspositionTable.hpp"
+
+#include <QDebug>
+
+using GameLogic::FourInALine::TranspositionTable;
+
+/**
+ * Stores entries and looks them up again, checks that colliding entries replace each other.
+ */
+void TranspositionTableTest::storeAndLookup()
+{
+	TranspositionTable table(16);
+	TranspositionTable::Entry entry;
+
+	QCOMPARE(table.getSize(), static_cast<std::size_t>(16));
+	QVERIFY(table.lookup(0x1234, entry) == false);
+
+	table.store(0x1234, 5, TranspositionTable::Bound::LOWER, -42, 3);
+
+	QVERIFY(table.lookup(0x1234, entry) == true);
+	QCOMPARE(entry.key, static_cast<std::uint64_t>(0x1234));
+	QCOMPARE(static_cast<int>(entry.depth), 5);
+	QVERIFY(entry.bound == TranspositionTable::Bound::LOWER);
+	QCOMPARE(entry.score, -42);
+	QCOMPARE(static_cast<int>(entry.bestMove), 3);
+
+	// 0x1244 uses the same entry as 0x1234.
+
+	QVERIFY(table.lookup(0x1244, entry) == false);
+
+	table.store(0x1244, 2, TranspositionTable::Bound::EXACT, 7, TranspositionTable::NO_MOVE);
+
+	QVERIFY(table.lookup(0x1234, entry) == false);
+	QVERIFY(table.lookup(0x1244, entry) == true);
+	QCOMPARE(entry.score, 7);
+	QCOMPARE(entry.bestMove, TranspositionTable::NO_MOVE);
+}
+
+/**
+ * Checks that clearing and resizing removes all entries and that the size is rounded down to a
+ * power of 2.
+ */
+void TranspositionTableTest::clearAndResize()
+{
+	TranspositionTable table(100);
+	TranspositionTable::Entry entry;
+
+	QCOMPARE(table.getSize(), static_cast<std::size_t>(64));
+
+	// Clear often enough to let the generation counter wrap around.
+
+	for (unsigned int i = 0; i < 600; ++i)
+	{
+		table.store(i + 1, 1, TranspositionTable::Bound::EXACT, i, 0);
+		QVERIFY(table.lookup(i + 1, entry) == true);
+
+		table.clear();
+		QVERIFY(table.lookup(i + 1, entry) == false);
+	}
+
+	table.store(1, 1, TranspositionTable::Bound::EXACT, 1, 0);
+	table.resize(1);
+
+	QCOMPARE(table.getSize(), static_cast<std::size_t>(1));
+	QVERIFY(table.lookup(1, entry) == false);
+}
+
+/**
+ * A table without entries never stores anything.
+ */
+void TranspositionTableTest::disabledTable()
+{
+	TranspositionTable table(0);
+	TranspositionTable::Entry entry;
+
+	QCOMPARE(table.getSize(), static_cast<std::size_t>(0));
+
+	table.store(1, 1, TranspositionTable::Bound::EXACT, 1, 0);
+	QVERIFY(table.lookup(1, entry) == false);
+
+	table.clear();
+	QVERIFY(table.lookup(1, entry) == false);
+}
+
+QTEST_MAIN(TranspositionTableTest)
@@ -0,0 +1,19 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_TRANSPOSITIONTABLETEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_TRANSPOSITIONTABLETEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::TranspositionTable class.
+ */
+class TranspositionTableTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void storeAndLookup();
+		void clearAndResize();
+		void disabledTable();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_TRANSPOSITIONTABLETEST_HPP
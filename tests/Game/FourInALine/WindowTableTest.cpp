@@ -0,0 +1,125 @@
+#include "WindowTableTest.hpp"
+#include "../../../src/GameLogic/FourInALine/WindowTable.hpp"
+#include "../../../src/GameLogic/FourInALine/Board.hpp"
+
+#include <QDebug>
+#include <algorithm>
+
+/**
+ * Checks the number of windows for several board sizes.
+ */
+void WindowTableTest::numberOfWindows()
+{
+	// 7 columns/6 rows: 24 horizontal, 21 vertical and 2 * 12 diagonal windows.
+
+	GameLogic::FourInALine::WindowTable standardTable(7, 6);
+	QCOMPARE(standardTable.getNumberOfWindows(), 69u);
+
+	// 4 columns/4 rows: 4 horizontal, 4 vertical and 2 diagonal windows.
+
+	GameLogic::FourInALine::WindowTable smallTable(4, 4);
+	QCOMPARE(smallTable.getNumberOfWindows(), 10u);
+
+	// No window fits into a board with less than 4 columns and rows.
+
+	GameLogic::FourInALine::WindowTable tinyTable(3, 3);
+	QCOMPARE(tinyTable.getNumberOfWindows(), 0u);
+
+	// Only vertical windows.
+
+	GameLogic::FourInALine::WindowTable narrowTable(1, 6);
+	QCOMPARE(narrowTable.getNumberOfWindows(), 3u);
+	QCOMPARE(narrowTable.getWindowDeltaX(0), 0);
+	QCOMPARE(narrowTable.getWindowDeltaY(0), 1);
+}
+
+/**
+ * Checks whether the cells of every window are consecutive cells in the direction of the window
+ * and whether the windows are in the order of the rows returned by Board::getAllRows().
+ */
+void WindowTableTest::windowCells()
+{
+	unsigned int columns = 8u;
+	unsigned int rows = 7u;
+	GameLogic::FourInALine::WindowTable table(columns, rows);
+	GameLogic::FourInALine::Board board(columns, rows);
+
+	unsigned int window = 0;
+
+	for (auto row : board.getAllRows())
+	{
+		for (unsigned int i = 0; i + 4 <= row.getLength(); ++i, ++window)
+		{
+			QVERIFY(window < table.getNumberOfWindows());
+			QCOMPARE(table.getWindowDeltaX(window), row.getDeltaX());
+			QCOMPARE(table.getWindowDeltaY(window), row.getDeltaY());
+
+			const unsigned int* cells = table.getWindowCells(window);
+
+			for (unsigned int j = 0; j < 4; ++j)
+			{
+				QCOMPARE(cells[j] % columns, row.getCellXPosition(i + j));
+				QCOMPARE(cells[j] / columns, row.getCellYPosition(i + j));
+			}
+		}
+	}
+
+	QCOMPARE(window, table.getNumberOfWindows());
+}
+
+/**
+ * Checks whether the windows containing a cell are exactly the windows which contain the cell.
+ */
+void WindowTableTest::windowsContainingCell()
+{
+	unsigned int columns = 9u;
+	unsigned int rows = 6u;
+	GameLogic::FourInALine::WindowTable table(columns, rows);
+
+	for (unsigned int cell = 0; cell < columns * rows; ++cell)
+	{
+		const unsigned int* windows = table.getWindowsContaining(cell);
+		unsigned int nWindows = table.getNumberOfWindowsContaining(cell);
+		unsigned int nExpectedWindows = 0;
+
+		QVERIFY(std::is_sorted(windows, windows + nWindows) == true);
+
+		for (unsigned int window = 0; window < table.getNumberOfWindows(); ++window)
+		{
+			const unsigned int* cells = table.getWindowCells(window);
+
+			if (std::find(cells, cells + 4, cell) != cells + 4)
+			{
+				QVERIFY(std::find(windows, windows + nWindows, window) != windows + nWindows);
+				nExpectedWindows++;
+			}
+		}
+
+		QCOMPARE(nWindows, nExpectedWindows);
+	}
+
+	// The top left cell is contained in one horizontal, one vertical and one diagonal window.
+
+	QCOMPARE(table.getNumberOfWindowsContaining(0), 3u);
+}
+
+/**
+ * Checks whether boards with the same geometry share the same window table.
+ */
+void WindowTableTest::shareInstances()
+{
+	auto table = GameLogic::FourInALine::WindowTable::getInstance(7, 6);
+
+	QVERIFY(table == GameLogic::FourInALine::WindowTable::getInstance(7, 6));
+	QVERIFY(table != GameLogic::FourInALine::WindowTable::getInstance(6, 7));
+	QCOMPARE(table->getNumberOfColumns(), 7u);
+	QCOMPARE(table->getNumberOfRows(), 6u);
+
+	GameLogic::FourInALine::Board board(7, 6);
+	GameLogic::FourInALine::Board copy(board);
+
+	QVERIFY(&board.getWindowTable() == table.get());
+	QVERIFY(&copy.getWindowTable() == table.get());
+}
+
+QTEST_MAIN(WindowTableTest)
@@ -0,0 +1,20 @@
+#ifndef TESTS_GAME_FOUR_IN_A_LINE_WINDOWTABLETEST_HPP
+#define TESTS_GAME_FOUR_IN_A_LINE_WINDOWTABLETEST_HPP
+
+#include <QtTest/QTest>
+
+/**
+ * Unit tests for the Game::FourInALine::WindowTable class.
+ */
+class WindowTableTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void numberOfWindows();
+		void windowCells();
+		void windowsContainingCell();
+		void shareInstances();
+};
+
+#endif // TESTS_GAME_FOUR_IN_A_LINE_WINDOWTABLETEST_HPP
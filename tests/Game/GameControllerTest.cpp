@@ -0,0 +1,109 @@
+#include "GameControllerTest.hpp"
+#include "../../src/Game/GameController.hpp"
+#include "../../src/Game/Game.hpp"
+#include "../../src/GameLogic/FourInALine/Game.hpp"
+#include "../../src/GameLogic/FourInALine/ArtificialIntelligence.hpp"
+
+#include <limits>
+#include <vector>
+
+/**
+ * Creates a player which never makes a move.
+ *
+ * @param player Player id used by the game engine.
+ */
+WaitingPlayer::WaitingPlayer(::GameLogic::FourInALine::Game::PlayerType player) :
+    AbstractPlayer(player)
+{
+
+}
+
+/**
+ * Does nothing, the player never makes a move.
+ *
+ * @param game The current game.
+ */
+void WaitingPlayer::requestMove(const QSharedPointer<const ::Game::Game>& game)
+{
+	Q_UNUSED(game)
+}
+
+/**
+ * Does nothing, the player never makes a move.
+ */
+void WaitingPlayer::abortMove()
+{
+
+}
+
+/**
+ * Tests that the column hints only show exact scores.
+ *
+ * In this position the first player wins with column 3. Searched with the default move score
+ * window, the scores of the other moves are only upper bounds, e.g. 23 instead of 1 for column 4,
+ * which must not be shown as scores of the moves.
+ */
+void GameControllerTest::hintScoresAreExact()
+{
+	using ArtificialIntelligence = ::GameLogic::FourInALine::ArtificialIntelligence;
+
+	QSharedPointer< ::GameLogic::FourInALine::Game> gameEngine(new ::GameLogic::FourInALine::Game(6, 7, 1));
+
+	for (unsigned int column : {2u, 6u, 1u, 5u})
+	{
+		gameEngine->makeMove(column);
+	}
+
+	// The scores of the other moves are bounds with the default move score window.
+
+	ArtificialIntelligence artificialIntelligence(4);
+	auto moveScores = artificialIntelligence.computeMoveScores(*gameEngine);
+	bool hasBound = false;
+
+	for (const auto& moveScore : moveScores)
+	{
+		hasBound |= moveScore.bound != ::GameLogic::FourInALine::TranspositionTable::Bound::EXACT;
+	}
+
+	QVERIFY(hasBound);
+
+	// The exact scores of all moves.
+
+	artificialIntelligence.setMoveScoreWindow(std::numeric_limits<ArtificialIntelligence::ScoreType>::max());
+	moveScores = artificialIntelligence.computeMoveScores(*gameEngine);
+
+	std::vector<int> expectedColumnScores(7, -100);
+
+	for (const auto& moveScore : moveScores)
+	{
+		QVERIFY(moveScore.bound == ::GameLogic::FourInALine::TranspositionTable::Bound::EXACT);
+		expectedColumnScores[moveScore.column] = ::Game::GameController::computeHintScore(moveScore.score);
+	}
+
+	QSharedPointer< ::Game::Game> game(new ::Game::Game(gameEngine,
+	                                                    QSharedPointer<WaitingPlayer>(new WaitingPlayer(1)),
+	                                                    QSharedPointer<WaitingPlayer>(new WaitingPlayer(2))));
+
+	::Game::GameController gameController;
+	std::vector<int> columnScores;
+	bool hintShown = false;
+
+	gameController.connect(&gameController, &::Game::GameController::showColumnHints,
+	                       [&](std::vector<int> scores, std::vector<unsigned int> principalVariation)
+	{
+		Q_UNUSED(principalVariation)
+
+		columnScores = scores;
+		hintShown = true;
+	});
+
+	gameController.startGame(game);
+	gameController.showHint();
+
+	QTRY_VERIFY_WITH_TIMEOUT(hintShown, 10000);
+	QVERIFY(columnScores == expectedColumnScores);
+
+	gameController.endGame();
+}
+
+QTEST_MAIN(GameControllerTest)
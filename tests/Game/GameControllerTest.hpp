@@ -0,0 +1,34 @@
+#ifndef TESTS_GAME_GAMECONTROLLERTEST_HPP
+#define TESTS_GAME_GAMECONTROLLERTEST_HPP
+
+#include "../../src/Game/Players/AbstractPlayer.hpp"
+
+#include <QObject>
+#include <QtTest/QTest>
+
+/**
+ * Player which never makes a move, so the game waits while hints are computed.
+ */
+class WaitingPlayer : public ::Game::Players::AbstractPlayer
+{
+		Q_OBJECT
+	public:
+		explicit WaitingPlayer(::GameLogic::FourInALine::Game::PlayerType player);
+
+		virtual void requestMove(const QSharedPointer<const ::Game::Game>& game) override;
+		virtual void abortMove() override;
+};
+
+/**
+ * Tests for the game controller.
+ */
+class GameControllerTest : public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void hintScoresAreExact();
+
+};
+
+#endif // TESTS_GAME_GAMECONTROLLERTEST_HPP
@@ -0,0 +1,15 @@
+# Builds the tool which generates the opening books of the artificial intelligence.
+
+include(../../Defines.pri)
+
+TEMPLATE = app
+TARGET = OpeningBookGenerator
+CONFIG += console
+
+LIBS += $${BUILD_DIRECTORY}/src/GameLogic/FourInALine/libFourInALine.a \
+        $${BUILD_DIRECTORY}/src/GameLogic/libGameLogic.a
+
+PRE_TARGETDEPS += $${BUILD_DIRECTORY}/src/GameLogic/FourInALine/libFourInALine.a \
+                  $${BUILD_DIRECTORY}/src/GameLogic/libGameLogic.a
+
+SOURCES += main.cpp
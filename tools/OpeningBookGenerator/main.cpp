@@ -0,0 +1,98 @@
+#include "../../src/GameLogic/FourInALine/OpeningBookGenerator.hpp"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QStringList>
+#include <QTextStream>
+
+#include <exception>
+
+/**
+ * Generates opening books for the given board sizes.
+ *
+ * Usage: OpeningBookGenerator [--plies n] [--depth n] [--threads n] [--output directory] 7x6 8x7 ...
+ *
+ * The book of a board with c columns and r rows is written to the file "cxr.book" in the output
+ * directory. Copy the books to the directory "openingbooks" next to the FourInALine executable.
+ *
+ * @param argc Argument count.
+ * @param argv Array of command line arguments.
+ * @return 0 on success, an integer >0 if an error occurs.
+ */
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName("OpeningBookGenerator");
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("Generates the opening books of the artificial intelligence.");
+	parser.addHelpOption();
+	parser.addPositionalArgument("sizes", "Board sizes (columns x rows), e.g. 7x6 8x7.", "sizes...");
+
+	QCommandLineOption pliesOption("plies", "The books contain the positions with less tokens.",
+	                               "n", "8");
+	QCommandLineOption depthOption("depth", "Search depth used to compute the moves.", "n", "12");
+	QCommandLineOption threadsOption("threads", "Number of threads, 0 for one per core.", "n", "0");
+	QCommandLineOption outputOption("output", "Directory to which the books are written.",
+	                                "directory", ".");
+
+	parser.addOption(pliesOption);
+	parser.addOption(depthOption);
+	parser.addOption(threadsOption);
+	parser.addOption(outputOption);
+	parser.process(app);
+
+	QTextStream out(stdout);
+	QStringList sizes = parser.positionalArguments();
+
+	if (sizes.isEmpty())
+	{
+		parser.showHelp(1);
+	}
+
+	unsigned int nPlies = parser.value(pliesOption).toUInt();
+	unsigned int searchDepth = parser.value(depthOption).toUInt();
+	unsigned int nThreads = parser.value(threadsOption).toUInt();
+	QDir outputDirectory(parser.value(outputOption));
+
+	for (const QString& size : sizes)
+	{
+		QStringList dimensions = size.split('x');
+		bool isColumnsValid = false;
+		bool isRowsValid = false;
+		unsigned int nColumns = (dimensions.size() == 2) ? dimensions[0].toUInt(&isColumnsValid) : 0;
+		unsigned int nRows = (dimensions.size() == 2) ? dimensions[1].toUInt(&isRowsValid) : 0;
+
+		if (!isColumnsValid || !isRowsValid || nColumns == 0 || nRows == 0)
+		{
+			out << "Invalid board size: " << size << endl;
+			return 1;
+		}
+
+		QString fileName = outputDirectory.filePath(size + ".book");
+		GameLogic::FourInALine::OpeningBookGenerator generator(nColumns, nRows, nPlies, searchDepth);
+
+		generator.setNumberOfThreads(nThreads);
+		generator.setProgressCallback([&out, &size](std::size_t nPositions)
+		{
+			if (nPositions % 1000 == 0)
+			{
+				out << size << ": " << nPositions << " positions" << endl;
+			}
+		});
+
+		try
+		{
+			std::size_t nPositions = generator.generate(fileName);
+			out << "Wrote " << nPositions << " positions to " << fileName << endl;
+		}
+		catch (std::exception& exception)
+		{
+			out << "Could not generate " << fileName << ": " << exception.what() << endl;
+			return 1;
+		}
+	}
+
+	return 0;
+}
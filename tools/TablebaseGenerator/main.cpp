@@ -0,0 +1,95 @@
+#include "../../src/GameLogic/FourInALine/TablebaseGenerator.hpp"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QStringList>
+#include <QTextStream>
+
+#include <exception>
+
+/**
+ * Generates tablebases for the given board sizes.
+ *
+ * Usage: TablebaseGenerator [--threads n] [--output directory] 5x4 4x4 ...
+ *
+ * The tablebase of a board with c columns and r rows is written to the file "cxr.tablebase" in the
+ * output directory. Copy the tablebases to the directory "tablebases" next to the FourInALine
+ * executable.
+ *
+ * @param argc Argument count.
+ * @param argv Array of command line arguments.
+ * @return 0 on success, an integer >0 if an error occurs.
+ */
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName("TablebaseGenerator");
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("Generates the tablebases of the artificial intelligence.");
+	parser.addHelpOption();
+	parser.addPositionalArgument("sizes", "Board sizes (columns x rows), e.g. 5x4 4x5.", "sizes...");
+
+	QCommandLineOption threadsOption("threads", "Number of threads, 0 for one per core.", "n", "0");
+	QCommandLineOption outputOption("output", "Directory to which the tablebases are written.",
+	                                "directory", ".");
+
+	parser.addOption(threadsOption);
+	parser.addOption(outputOption);
+	parser.process(app);
+
+	QTextStream out(stdout);
+	QStringList sizes = parser.positionalArguments();
+
+	if (sizes.isEmpty())
+	{
+		parser.showHelp(1);
+	}
+
+	unsigned int nThreads = parser.value(threadsOption).toUInt();
+	QDir outputDirectory(parser.value(outputOption));
+
+	for (const QString& size : sizes)
+	{
+		QStringList dimensions = size.split('x');
+		bool isColumnsValid = false;
+		bool isRowsValid = false;
+		unsigned int nColumns = (dimensions.size() == 2) ? dimensions[0].toUInt(&isColumnsValid) : 0;
+		unsigned int nRows = (dimensions.size() == 2) ? dimensions[1].toUInt(&isRowsValid) : 0;
+
+		if (!isColumnsValid || !isRowsValid || nColumns == 0 || nRows == 0)
+		{
+			out << "Invalid board size: " << size << endl;
+			return 1;
+		}
+
+		if (!GameLogic::FourInALine::Tablebase::isSupported(nColumns, nRows))
+		{
+			out << "The board is too big for a tablebase: " << size << endl;
+			return 1;
+		}
+
+		QString fileName = outputDirectory.filePath(size + ".tablebase");
+		GameLogic::FourInALine::TablebaseGenerator generator(nColumns, nRows);
+
+		generator.setNumberOfThreads(nThreads);
+		generator.setProgressCallback([&out, &size](unsigned int nTokens)
+		{
+			out << size << ": positions with " << nTokens << " tokens done" << endl;
+		});
+
+		try
+		{
+			std::size_t nPositions = generator.generate(fileName);
+			out << "Wrote " << nPositions << " positions to " << fileName << endl;
+		}
+		catch (std::exception& exception)
+		{
+			out << "Could not generate " << fileName << ": " << exception.what() << endl;
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,19 @@
+# Builds the tool which plays tournaments between engine configurations.
+
+include(../../Defines.pri)
+
+# The tool is headless and only links the game logic, which needs nothing but Qt Core.
+
+QT = core
+
+TEMPLATE = app
+TARGET = Tournament
+CONFIG += console
+
+LIBS += $${BUILD_DIRECTORY}/src/GameLogic/FourInALine/libFourInALine.a \
+        $${BUILD_DIRECTORY}/src/GameLogic/libGameLogic.a
+
+PRE_TARGETDEPS += $${BUILD_DIRECTORY}/src/GameLogic/FourInALine/libFourInALine.a \
+                  $${BUILD_DIRECTORY}/src/GameLogic/libGameLogic.a
+
+SOURCES += main.cpp
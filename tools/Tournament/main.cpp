@@ -0,0 +1,190 @@
+#include "../../src/GameLogic/FourInALine/Tournament.hpp"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QStringList>
+#include <QTextStream>
+
+#include <exception>
+
+using GameLogic::FourInALine::Tournament;
+
+/**
+ * Parses an engine configuration like "type=search,depth=6,time=0,nodes=0,weights=1:10:100".
+ *
+ * Omitted keys keep the values of Tournament::getDefaultConfiguration().
+ *
+ * @param text The configuration.
+ * @param configuration The parsed configuration is stored here.
+ * @return When the configuration is valid true, otherwise false.
+ */
+static bool parseConfiguration(const QString& text, Tournament::EngineConfiguration& configuration)
+{
+	configuration = Tournament::getDefaultConfiguration();
+
+	for (const QString& entry : text.split(','))
+	{
+		// Empty entries are skipped, e.g. after a trailing comma.
+
+		if (entry.isEmpty())
+		{
+			continue;
+		}
+
+		QStringList keyValue = entry.split('=');
+
+		if (keyValue.size() != 2)
+		{
+			return false;
+		}
+
+		const QString& key = keyValue[0];
+		const QString& value = keyValue[1];
+		bool isValid = true;
+
+		if (key == "type" && value == "search")
+		{
+			configuration.type = Tournament::EngineType::SEARCH;
+		}
+		else if (key == "type" && value == "perfect")
+		{
+			configuration.type = Tournament::EngineType::PERFECT;
+		}
+		else if (key == "type" && value == "mcts")
+		{
+			configuration.type = Tournament::EngineType::MONTE_CARLO_TREE_SEARCH;
+		}
+		else if (key == "depth")
+		{
+			configuration.searchDepth = value.toUInt(&isValid);
+		}
+		else if (key == "time")
+		{
+			configuration.timeBudget = std::chrono::milliseconds(value.toUInt(&isValid));
+		}
+		else if (key == "nodes")
+		{
+			configuration.nodeBudget = value.toULongLong(&isValid);
+		}
+		else if (key == "weights")
+		{
+			QStringList weights = value.split(':');
+			bool isOneValid = false;
+			bool isTwoValid = false;
+			bool isThreeValid = false;
+
+			isValid = weights.size() == 3;
+
+			if (isValid)
+			{
+				configuration.evaluationWeights.oneToken = weights[0].toInt(&isOneValid);
+				configuration.evaluationWeights.twoTokens = weights[1].toInt(&isTwoValid);
+				configuration.evaluationWeights.threeTokens = weights[2].toInt(&isThreeValid);
+				isValid = isOneValid && isTwoValid && isThreeValid;
+			}
+		}
+		else
+		{
+			isValid = false;
+		}
+
+		if (!isValid)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Plays a tournament between two engine configurations and prints the result.
+ *
+ * Usage: Tournament [--first config] [--second config] [--games n] [--threads n] [--size 7x6]
+ *                   [--opening-moves n] [--seed n]
+ *
+ * An engine configuration is a comma separated list of key=value pairs: type (search, perfect or
+ * mcts), depth, time (milliseconds per move), nodes (per move, playouts for mcts) and weights
+ * (one:two:three tokens), e.g. "type=search,depth=6,weights=1:10:100" or "type=mcts,nodes=20000".
+ *
+ * @param argc Argument count.
+ * @param argv Array of command line arguments.
+ * @return 0 on success, an integer >0 if an error occurs.
+ */
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName("Tournament");
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("Plays games between two engine configurations.");
+	parser.addHelpOption();
+
+	QCommandLineOption firstOption("first", "Configuration of the first engine.", "config", "depth=4");
+	QCommandLineOption secondOption("second", "Configuration of the second engine.", "config", "depth=4");
+	QCommandLineOption gamesOption("games", "Number of games, rounded up to an even number.", "n", "100");
+	QCommandLineOption threadsOption("threads", "Number of threads, 0 for one per core.", "n", "0");
+	QCommandLineOption sizeOption("size", "Board size (columns x rows).", "size", "7x6");
+	QCommandLineOption openingMovesOption("opening-moves", "Number of random moves at the beginning.",
+	                                      "n", "2");
+	QCommandLineOption seedOption("seed", "Seed of the random openings.", "n", "1");
+
+	parser.addOption(firstOption);
+	parser.addOption(secondOption);
+	parser.addOption(gamesOption);
+	parser.addOption(threadsOption);
+	parser.addOption(sizeOption);
+	parser.addOption(openingMovesOption);
+	parser.addOption(seedOption);
+	parser.process(app);
+
+	QTextStream out(stdout);
+	Tournament::EngineConfiguration configurations[2];
+
+	if (!parseConfiguration(parser.value(firstOption), configurations[0]) ||
+	    !parseConfiguration(parser.value(secondOption), configurations[1]))
+	{
+		out << "Invalid engine configuration." << endl;
+		return 1;
+	}
+
+	QStringList dimensions = parser.value(sizeOption).split('x');
+	bool isColumnsValid = false;
+	bool isRowsValid = false;
+	unsigned int nColumns = (dimensions.size() == 2) ? dimensions[0].toUInt(&isColumnsValid) : 0;
+	unsigned int nRows = (dimensions.size() == 2) ? dimensions[1].toUInt(&isRowsValid) : 0;
+
+	if (!isColumnsValid || !isRowsValid || nColumns == 0 || nRows == 0)
+	{
+		out << "Invalid board size: " << parser.value(sizeOption) << endl;
+		return 1;
+	}
+
+	try
+	{
+		Tournament tournament(configurations[0], configurations[1], nColumns, nRows);
+
+		tournament.setNumberOfGames(parser.value(gamesOption).toUInt());
+		tournament.setNumberOfThreads(parser.value(threadsOption).toUInt());
+		tournament.setNumberOfOpeningMoves(parser.value(openingMovesOption).toUInt());
+		tournament.setSeed(parser.value(seedOption).toUInt());
+
+		Tournament::Result result = tournament.run();
+
+		out << "Games: " << result.getNumberOfGames() << endl;
+		out << "First engine: " << result.nWins << " wins, " << result.nDraws << " draws, "
+		    << result.nLosses << " losses" << endl;
+		out << "Elo difference: " << result.getEloDifference() << " +/- "
+		    << result.getEloErrorMargin() << endl;
+		out << "Average time per move: " << result.getAverageMoveTime(0).count() << " us (first), "
+		    << result.getAverageMoveTime(1).count() << " us (second)" << endl;
+		out << "Games per second: " << result.getGamesPerSecond() << endl;
+	}
+	catch (std::exception& exception)
+	{
+		out << "Could not play the tournament: " << exception.what() << endl;
+		return 1;
+	}
+
+	return 0;
+}